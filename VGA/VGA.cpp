@@ -4,7 +4,125 @@
 
 Vga VGA;
 
-void __attribute__((aligned(64))) TC4_Handler()
+// Display list: find where visible line VGA.line comes from. Called for each
+// visible line in turn, starting with line 0 after _v_dlframe().
+static inline uint32_t _v_dlline()
+{
+  if(VGA.line!=VGA.dlnext)return VGA.dladdr+=VGA.dlstride;
+  while(VGA.line==VGA.dlnext){    // the last of several on one line wins
+    VGA.dladdr=(uint32_t)VGA.dlr->addr;VGA.dlstride=VGA.dlr->stride;
+    VGA.dlr++;VGA.dlnext=VGA.dlr<VGA.dle?VGA.dlr->line:-1;
+  }
+  return VGA.dladdr;
+}
+
+// Display list: start of frame. The list is latched here, so one set mid
+// frame starts with the next. Lines above its first entry show the frame
+// buffer. Leaves dlr 0 if there is no list.
+static inline void _v_dlframe(const void *base, int stride)
+{
+  VGA.dlr=VGA.dl;
+  if(!VGA.dl)return;
+  VGA.dle=VGA.dl+VGA.dln;VGA.dlnext=VGA.dl[0].line;
+  VGA.dlstride=stride;VGA.dladdr=(uint32_t)base-stride;
+}
+
+// Double buffering: show the buffer that has been drawn on, and draw on the
+// one that was shown. Done at the end of a frame when flip() asks.
+static inline void _v_flip()
+{
+  uint16_t *p=VGA.pb;VGA.pb=VGA.pbf;VGA.pbf=p;
+  _v_bitband b=VGA.pbb;VGA.pbb=VGA.pbbf;VGA.pbbf=b;
+  uint8_t *c=VGA.cb;VGA.cb=VGA.cbf;VGA.cbf=c;
+}
+
+// Starts the DWT cycle counter, which times the PAL and NTSC encoder
+static void _v_startcyccnt()
+{
+  CoreDebug->DEMCR|=CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL|=DWT_CTRL_CYCCNTENA_Msk;
+}
+
+// PAL and NTSC: encodes the 320 pixels at src as composite samples at dbo.
+// crt is the table of samples for the colour phase of the first pixel, a row
+// of 256 for each phase, and each pixel moves on a row. Every 16 pixels the
+// table wraps back by wrap bytes if it has passed cre. Past the last phase
+// the tables repeat their first rows: PAL has 30 phases in 44 rows (14
+// spare), NTSC 88 in 96 (8 spare). A PAL line always starts on an even
+// phase and an NTSC one on a multiple of 8, and wrapping keeps that, so a
+// run of 16 starts at row 28 at the latest in PAL and 80 in NTSC, and ends
+// on the last row, 43 or 95, without running off the end. With a colour map
+// (see setColourMap) each pixel goes through it first.
+//
+// Four pixels are read with one ldr and their samples stored in pairs.
+
+// samples for the 4 pixels in r4 to dbo, crt on 4 rows; MAP is blank or the
+// lookups through the colour map
+#define _V_ENC4(MAP0,MAP1,MAP2,MAP3)			\
+  " ldr r4, [%[cbl]], #4             \n\t"		\
+  " uxtb r2, r4                      \n\t"		\
+  MAP0							\
+  " ldrh r2, [%[crt], r2, lsl #1]    \n\t"		\
+  " ubfx r3, r4, #8, #8              \n\t"		\
+  MAP1							\
+  " add r3, %[crt], r3, lsl #1       \n\t"		\
+  " ldrh r3, [r3, #512]              \n\t"		\
+  " orr r2, r2, r3, lsl #16          \n\t"		\
+  " str r2, [%[dbo]], #4             \n\t"		\
+  " ubfx r2, r4, #16, #8             \n\t"		\
+  MAP2							\
+  " add r2, %[crt], r2, lsl #1       \n\t"		\
+  " ldrh r2, [r2, #1024]             \n\t"		\
+  " lsr r3, r4, #24                  \n\t"		\
+  MAP3							\
+  " add r3, %[crt], r3, lsl #1       \n\t"		\
+  " ldrh r3, [r3, #1536]             \n\t"		\
+  " orr r2, r2, r3, lsl #16          \n\t"		\
+  " str r2, [%[dbo]], #4             \n\t"		\
+  " add %[crt], %[crt], #2048        \n\t"
+#define _V_NOMAP _V_ENC4("","","","")
+#define _V_MAP _V_ENC4(" ldrb r2, [%[map], r2] \n\t"," ldrb r3, [%[map], r3] \n\t", \
+		       " ldrb r2, [%[map], r2] \n\t"," ldrb r3, [%[map], r3] \n\t")
+#define _V_WRAP							\
+  " cmp %[crt],%[cre]                \n\t"			\
+  " it gt                            \n\t"			\
+  " subgt %[crt],%[wrp]              \n\t"			\
+  " cmp %[cbl],%[cbe]                \n\t"			\
+  " bne 1b                           \n\t"
+
+static inline void _v_encode(uint16_t *dbo, const uint8_t *src, const uint16_t *crt,
+			     const uint16_t *cre, int wrap, const uint8_t *map)
+{
+  const uint8_t *end=src+320;
+  if(!map)asm volatile(
+        "1:                                \n\t"
+        _V_NOMAP _V_NOMAP _V_NOMAP _V_NOMAP
+        _V_WRAP
+        :[dbo]"+r"(dbo)
+        ,[cbl]"+r"(src)
+        ,[crt]"+r"(crt)
+        :[cbe]"r"(end)
+        ,[cre]"r"(cre)
+        ,[wrp]"r"(wrap)
+        :"r2","r3","r4","cc","memory"
+        );
+  else asm volatile(
+        "1:                                \n\t"
+        _V_MAP _V_MAP _V_MAP _V_MAP
+        _V_WRAP
+        :[dbo]"+r"(dbo)
+        ,[cbl]"+r"(src)
+        ,[crt]"+r"(crt)
+        :[cbe]"r"(end)
+        ,[cre]"r"(cre)
+        ,[wrp]"r"(wrap)
+        ,[map]"r"(map)
+        :"r2","r3","r4","cc","memory"
+        );
+}
+
+// The line interrupt, see TC4_Handler
+static inline __attribute__((always_inline)) void _v_tc4()
 {
   static int disp=0;
     long dummy=REG_TC1_SR1; 
@@ -16,7 +134,12 @@ void __attribute__((aligned(64))) TC4_Handler()
 	VGA.synced=1;
       }
     if(disp==VGA_COLOUR){  
-      REG_DMAC_CTRLA5=0x22060000 + (VGA.cw >> 2); 
+      REG_DMAC_CTRLA5=0x22060000 + (VGA.xsize >> 2); 
+      REG_DMAC_CHER=1<<5;   
+    }    
+    if(disp&VGA_LINES){  
+      REG_DMAC_SADDR5=(uint32_t)VGA.lbuf[VGA.line&1];
+      REG_DMAC_CTRLA5=0x22060000 + (VGA.xsize >> 2); 
       REG_DMAC_CHER=1<<5;   
     }    
     if(disp==VGA_MONO){
@@ -51,43 +174,12 @@ void __attribute__((aligned(64))) TC4_Handler()
 
       if(VGA.line < VGA.ysize){
 	p=VGA.phase + 6;if(p>=30)p-=30;
-	asm volatile(
-        " mov r0,#15360                    \n\t"
-        " mov r1,#512                      \n\t"
-        
-        "1:                                \n\t"
-
-        ".rept 8                           \n\t"
-        " ldrb r2, [%[cbl]], #1           \n\t"
-        " ldrh r3, [%[crt], r2, lsl #1]   \n\t"
-        " strh r3, [%[dbo]], #2           \n\t" 
-        " adds %[crt],r1                    \n\t"
-        ".endr                             \n\t"
-        
-        " cmp %[crt],%[cre]                \n\t"
-        " it gt                            \n\t"
-        " subgt %[crt],r0                  \n\t"       
-        ".rept 8                           \n\t"
-        " ldrb r2, [%[cbl]], #1           \n\t"
-        " ldrh r3, [%[crt], r2, lsl #1]   \n\t"
-        " strh r3, [%[dbo]], #2           \n\t" 
-        " adds %[crt],r1                    \n\t"
-        ".endr                             \n\t"
-        
-        " cmp %[crt],%[cre]                \n\t"
-        " it gt                            \n\t"
-        " subgt %[crt],r0                  \n\t"            
-        " cmp %[cbl],%[cbe]                \n\t"
-        " bne 1b                           \n\t"
-        
-        :
-        :[dbo]"r"(buf+96)
-        ,[cbl]"r"(VGA.cb+VGA.line*320)
-        ,[cbe]"r"(VGA.cb+VGA.line*320+320)
-        ,[crt]"r"(VGA.crt[oe]+p*256)
-        ,[cre]"r"(VGA.crt[oe]+30*256-1)
-        :"r0","r1","r2","r3"
-        );      	
+	uint8_t *src;
+	if(VGA.dlr)src=(uint8_t *)_v_dlline();
+	else{int r=VGA.line+VGA.yoff;if(r>=VGA.ysize)r-=VGA.ysize;src=VGA.cbf+r*VGA.cw+VGA.xoff;}
+	uint32_t t=DWT->CYCCNT;
+	_v_encode(buf+96,src,VGA.crt[oe]+p*256,VGA.crt[oe]+30*256-1,30*512,VGA.cmap);
+	VGA.enccycles=DWT->CYCCNT-t;
 	
       }
       else if ((VGA.line == VGA.ysize)||(VGA.line == VGA.ysize+1))
@@ -108,7 +200,11 @@ void __attribute__((aligned(64))) TC4_Handler()
         for(int i=16;i<223;i++)*lp++=0x3c3c3c3c;   		
       }
       VGA.phase+=VGA.poff;if(VGA.phase >= 30)VGA.phase -= 30;
-      VGA.line++;if(VGA.line == VGA.ytotal)VGA.line=0;
+      VGA.line++;
+      if(VGA.line == VGA.ytotal){
+	VGA.line=0;VGA.yoff=VGA.yscroll;VGA.xoff=VGA.xpan;VGA.framecount++;
+	_v_dlframe(VGA.cbf+VGA.xoff,VGA.cw);
+      }
       return;
     }
     else
@@ -134,45 +230,12 @@ void __attribute__((aligned(64))) TC4_Handler()
 
       if(VGA.line < VGA.ysize){
 	p=VGA.phase + 88;if(p>=88)p-=88;
-	asm volatile(
-        " mov r0,#45056                    \n\t"
-        " mov r1,#512                      \n\t"
-        
-        "1:                                \n\t"
-
-        ".rept 8                           \n\t"
-        " ldrb r2, [%[cbl]], #1           \n\t"
-        " ldrh r3, [%[crt], r2, lsl #1]   \n\t"
-        " strh r3, [%[dbo]], #2           \n\t" 
-        " adds %[crt],r1                    \n\t"
-        ".endr                             \n\t"
-        
-        " cmp %[crt],%[cre]                \n\t"
-        " it gt                            \n\t"
-        " subgt %[crt],r0                  \n\t"       
-        
-	".rept 8                           \n\t"
-        " ldrb r2, [%[cbl]], #1           \n\t"
-        " ldrh r3, [%[crt], r2, lsl #1]   \n\t"
-        " strh r3, [%[dbo]], #2           \n\t" 
-        " adds %[crt],r1                    \n\t"
-        ".endr                             \n\t"
-        
-        " cmp %[crt],%[cre]                \n\t"
-        " it gt                            \n\t"
-        " subgt %[crt],r0                  \n\t"       
-	
-        " cmp %[cbl],%[cbe]                \n\t"
-        " bne 1b                           \n\t"
-        
-        :
-        :[dbo]"r"(buf+88)
-        ,[cbl]"r"(VGA.cb+VGA.line*320)
-        ,[cbe]"r"(VGA.cb+VGA.line*320+320)
-        ,[crt]"r"(VGA.crt[0]+p*256)
-        ,[cre]"r"(VGA.crt[0]+88*256-1)
-        :"r0","r1","r2","r3"
-        );      	
+	uint8_t *src;
+	if(VGA.dlr)src=(uint8_t *)_v_dlline();
+	else{int r=VGA.line+VGA.yoff;if(r>=VGA.ysize)r-=VGA.ysize;src=VGA.cbf+r*VGA.cw+VGA.xoff;}
+	uint32_t t=DWT->CYCCNT;
+	_v_encode(buf+88,src,VGA.crt[0]+p*256,VGA.crt[0]+88*256-1,88*512,VGA.cmap);
+	VGA.enccycles=DWT->CYCCNT-t;
 	
       }
       else if ((VGA.line == VGA.ysize)||(VGA.line == VGA.ysize+1))
@@ -193,7 +256,11 @@ void __attribute__((aligned(64))) TC4_Handler()
         for(int i=16;i<222;i++)*lp++=0x3c3c3c3c;   		
       }
       VGA.phase+=VGA.poff;if(VGA.phase >= 88)VGA.phase -= 88;
-      VGA.line++;if(VGA.line == VGA.ytotal)VGA.line=0;
+      VGA.line++;
+      if(VGA.line == VGA.ytotal){
+	VGA.line=0;VGA.yoff=VGA.yscroll;VGA.xoff=VGA.xpan;VGA.framecount++;
+	_v_dlframe(VGA.cbf+VGA.xoff,VGA.cw);
+      }
       return;
     }
 
@@ -203,28 +270,156 @@ void __attribute__((aligned(64))) TC4_Handler()
     if(VGA.linedouble == VGA.yscale){VGA.linedouble=0;VGA.line++;}
     if(VGA.line == VGA.ysize)disp=0;
     if(VGA.line == VGA.ytotal){
-      if(VGA.mode == VGA_MONO)REG_DMAC_SADDR4=(uint32_t)VGA.pb;
-      else if(VGA.mode == VGA_COLOUR)REG_DMAC_SADDR5=(uint32_t)VGA.cb;
       VGA.line=0;disp=VGA.mode;VGA.framecount++;
+      if(VGA.flipping){_v_flip();VGA.flipping=0;}
+      VGA.yoff=VGA.yscroll;VGA.ywrap=VGA.ysize-VGA.yoff;VGA.xoff=VGA.xpan;
+      if(VGA.mode == VGA_MONO)_v_dlframe(VGA.pbf,VGA.pw<<1);
+      else _v_dlframe(VGA.cbf+VGA.xoff,VGA.cw);
+      if(VGA.dlr){
+	if(VGA.mode == VGA_MONO)REG_DMAC_SADDR4=_v_dlline();
+	else if(VGA.mode == VGA_COLOUR)REG_DMAC_SADDR5=_v_dlline();
+      }
+      else if(VGA.mode == VGA_MONO)REG_DMAC_SADDR4=(uint32_t)(VGA.pbf+VGA.yoff*VGA.pw);
+      else if(VGA.mode == VGA_COLOUR)REG_DMAC_SADDR5=(uint32_t)(VGA.cbf+VGA.yoff*VGA.cw+VGA.xoff);
+    }
+    // VGA_LINES, VGA_4BPP: render the next line while this one goes out. If this line
+    // has ended by the time it is done, the next one will start late.
+    if((VGA.mode & VGA_LINES) && !VGA.linedouble && VGA.line < VGA.ysize){
+      _v_renderline(VGA.line,VGA.lbuf[VGA.line&1]);
+      if(NVIC_GetPendingIRQ(TC4_IRQn)){VGA.lmissed++;VGA.lmissline=VGA.line;}
     }
   
 }
 
+// Profiling (see setProfiling). Each handler adds the cycles it took, less
+// those taken by any handler that interrupted it, to its total for the frame
+// and to the total for the line. TC4 closes each line and each frame.
+static uint32_t _v_pacc[4],_v_pbusy,_v_pline,_v_pworst,_v_pframe;
+static int _v_pworstline,_v_plast;
+
+static void _v_profend(int h, uint32_t t, uint32_t b) // started at t, _v_pbusy was b
+{
+  uint32_t d=DWT->CYCCNT-t-(_v_pbusy-b);
+  _v_pacc[h]+=d;_v_pbusy+=d;_v_pline+=d;
+}
+
+static void _v_proftc4()
+{
+  uint32_t now=DWT->CYCCNT,d=REG_TC1_CV1*2; // TC4 is timed from its timer event
+  if(NVIC_GetPendingIRQ(TC4_IRQn))d+=REG_TC1_RC1*2; // it ran into the next line,
+                                                     // so the timer wrapped
+  _v_pacc[0]+=d;_v_pbusy+=d;_v_pline+=d;
+  if(_v_pline>_v_pworst){_v_pworst=_v_pline;_v_pworstline=VGA.line;}
+  _v_pline=0;
+  if(VGA.line<_v_plast){   // a new frame
+    if(_v_pframe){         // and a whole one before it
+      VgaProfile &p=VGA.prof;
+      p.tc4=_v_pacc[0];p.pwm=_v_pacc[1];p.dmac=_v_pacc[2];p.tc5=_v_pacc[3];
+      p.frame=now-_v_pframe;p.worst=_v_pworst;p.worstline=_v_pworstline;
+      uint32_t busy=p.tc4+p.pwm+p.dmac+p.tc5;
+      p.free=busy<p.frame?100-(int)((uint64_t)busy*100/p.frame):0;
+      p.frames++;
+    }
+    _v_pacc[0]=_v_pacc[1]=_v_pacc[2]=_v_pacc[3]=0;
+    _v_pworst=0;_v_pframe=now;
+  }
+  _v_plast=VGA.line;
+}
+
+// onVBlank and onLine. TC4 only notes which hooks are due, on the first
+// interrupt of each line, and sets PendSV pending; the core's PendSV_Handler
+// calls pendSVHook, which runs them below all the other interrupts, so they
+// can take as long as they need.
+static int _v_hlast= -1,_v_hnext;
+static volatile uint8_t _v_hvb,_v_hdue[VGA_LINEHOOKS];
+
+static inline void _v_hooks()
+{
+  int l=VGA.line;
+  if(l==_v_hlast)return;
+  _v_hlast=l;
+  bool due=0;
+  if(l==0)_v_hnext=0;
+  if(l==VGA.ysize && VGA.vbhook){_v_hvb=1;due=1;}
+  for(;_v_hnext<VGA.hookn && VGA.hookl[_v_hnext]<=l;_v_hnext++)
+    if(VGA.hookl[_v_hnext]==l){_v_hdue[_v_hnext]=1;due=1;}
+  if(due)SCB->ICSR=SCB_ICSR_PENDSVSET_Msk;
+}
+
+extern "C" void pendSVHook()
+{
+  for(int i=0;i<VGA.hookn;i++)
+    if(_v_hdue[i]){_v_hdue[i]=0;VGA.hookf[i]();}
+  if(_v_hvb){_v_hvb=0;if(VGA.vbhook)VGA.vbhook();}
+}
+
+void __attribute__((aligned(64))) TC4_Handler()
+{
+  _v_tc4();
+  if(VGA.vbhook || VGA.hookn)_v_hooks();
+  if(VGA.profiling)_v_proftc4();
+}
+
 void __attribute__((aligned(64))) PWM_Handler()
 {
     long t=(REG_PWM_ISR1);
+    uint32_t pt=0,pb=0;
+    if(VGA.profiling){pt=DWT->CYCCNT;pb=_v_pbusy;}
     if(VGA.linedouble){
       if(VGA.mode == VGA_MONO)REG_DMAC_SADDR4-=(VGA.pw<<1);
-      else REG_DMAC_SADDR5-=(VGA.cw);
+      else REG_DMAC_SADDR5-=(VGA.xsize);
+    }
+    else if(VGA.dlr){             // display list, PAL and NTSC do their own
+      if(VGA.line>0 && VGA.line<VGA.ysize &&
+	 (VGA.mode == VGA_MONO || VGA.mode == VGA_COLOUR)){
+	if(VGA.mode == VGA_MONO)REG_DMAC_SADDR4=_v_dlline();
+	else REG_DMAC_SADDR5=_v_dlline();
+      }
+    }
+    else if(VGA.line == VGA.ywrap){  // scrolled past the end, back to the top
+      if(VGA.mode == VGA_MONO)REG_DMAC_SADDR4=(uint32_t)VGA.pbf;
+      else REG_DMAC_SADDR5=(uint32_t)(VGA.cbf+VGA.xoff);
     }
+    else if(VGA.cw!=VGA.xsize && VGA.mode == VGA_COLOUR && // wide canvas, skip
+	    VGA.line>0 && VGA.line<VGA.ysize)               // the rest of the line
+      REG_DMAC_SADDR5+=VGA.cw-VGA.xsize;
     //VGA.debug=REG_TC0_CV1;
-    asm volatile("wfe \n\t");
+    if(VGA.lwait==VGA_WAIT_LINE)asm volatile("wfe \n\t");
+    if(VGA.profiling)_v_profend(1,pt,pb);
+}
+
+// VGA_WAIT_WINDOW: TC5 runs alongside TC4 and interrupts lwindow cycles before
+// it, so only that long is spent asleep instead of all the time from the end
+// of PWM_Handler. If the line is about to start, or has, there's no sleeping:
+// that line starts with some jitter, and a calibrated window grows. Otherwise
+// a calibrated window shrinks a cycle while there's more than 32 to spare.
+void __attribute__((aligned(64))) TC5_Handler()
+{
+    long dummy=REG_TC1_SR2;
+    uint32_t pt=0,pb=0;
+    if(VGA.profiling){pt=DWT->CYCCNT;pb=_v_pbusy;}
+    uint32_t cv=REG_TC1_CV1;
+    int slack=(REG_TC1_RC1-cv)*2,w=VGA.lwindow;
+    if(slack<16 || slack>w){
+      VGA.lwlate++;
+      if(VGA.lwauto && w<VGA.xstart)w+=16;
+    }
+    else{
+      if(VGA.lwauto && slack>32)w--;
+      while(REG_TC1_CV1>=cv)asm volatile("wfe \n\t"); // until TC4 has been
+    }
+    VGA.lwindow=w;
+    REG_TC1_RA2=(VGA.xclocks-w)>>1;
+    if(VGA.profiling)_v_profend(3,pt,pb);
 }
 
 void __attribute__((aligned(64))) DMAC_Handler()
 {
     REG_PIOA_PER  = 1<<26;     
+    uint32_t pt=0,pb=0;
+    if(VGA.profiling){pt=DWT->CYCCNT;pb=_v_pbusy;}
     uint32_t dummy=REG_DMAC_EBCISR;
+    if(VGA.profiling)_v_profend(2,pt,pb);
 }
 
 int Vga::calcmodeline()
@@ -254,7 +449,7 @@ int Vga::calcmodeline()
   }
   foundmode:;
   if(xscale==1)return -1;
-  if(mode == VGA_COLOUR && xscale < 6)return -1;
+  if((mode == VGA_COLOUR || (mode & VGA_LINES)) && xscale < 6)return -1;
     
   // calculate timings from modeline data
   xclocks=(xtotal*xscale) &~ 1;
@@ -265,30 +460,14 @@ int Vga::calcmodeline()
   return 0;
 }
 
-int Vga::allocvideomem()
+// Show what has been drawn at the end of this frame. With two buffers,
+// drawing then goes to the one that was on screen; with one this just waits.
+void Vga::flip()
 {
-    if(mode==VGA_MONO){
-    pw=((xsize+31)/32)*2+2;
-    pbsize=pw*ysize;
-    pb=(uint16_t *)calloc(pbsize,2);
-    if(pb==0)return -2;
-    
-    pbb=(uint32_t *)((int(pb-0x20000000)*32)+0x22000000);
-    pbw=pw*16;
-  }
-  if((mode & VGA_COLOUR)){
-    cw=xsize;
-    cbsize=cw*ysize;
-    cb=(uint8_t *)calloc(cbsize,1);
-    if(cb==0)return -2;
-  }
-  return 0;
-}
-
-void Vga::freevideomem()
-{
-  if(pb){free(pb);pb=0;}
-  if(cb){free(cb);cb=0;}  
+  if(!up)return;
+  if(!dbuf){waitSync();return;}
+  flipping=1;
+  while(*(volatile int *)&flipping);
 }
 
 void Vga::startinterrupts()
@@ -299,10 +478,13 @@ void Vga::startinterrupts()
   NVIC_SetPriority(PWM_IRQn,3);
   NVIC_SetPriority(TC4_IRQn,1); 
   NVIC_SetPriority(UOTGHS_IRQn,2); 
+  NVIC_SetPriority(TC5_IRQn,4); // below PWM, which must come first
+  NVIC_SetPriority(PendSV_IRQn,7); // onVBlank and onLine, below everything
   
   if(mode==VGA_MONO) NVIC_EnableIRQ(DMAC_IRQn);
   NVIC_EnableIRQ(TC4_IRQn); 
   NVIC_EnableIRQ(PWM_IRQn); 
+  if(lwait==VGA_WAIT_WINDOW) NVIC_EnableIRQ(TC5_IRQn);
 }
 
 void Vga::stopinterrupts()
@@ -310,6 +492,74 @@ void Vga::stopinterrupts()
   NVIC_DisableIRQ(PWM_IRQn);
   NVIC_DisableIRQ(TC4_IRQn);
   NVIC_DisableIRQ(DMAC_IRQn); 
+  NVIC_DisableIRQ(TC5_IRQn);
+}
+
+// Runs fn as line n starts to be shown, or stops doing so if fn is 0.
+// Returns -1 if there are already VGA_LINEHOOKS others.
+int Vga::onLine(int n, void (*fn)())
+{
+  int i,k=hookn;
+  hookn=0;                          // so TC4 and PendSV leave them alone
+  __DMB();                          // before any of them change
+  for(i=0;i<VGA_LINEHOOKS;i++)_v_hdue[i]=0;
+  for(i=0;i<k && hookl[i]<n;i++);
+  if(i<k && hookl[i]==n){
+    if(fn)hookf[i]=fn;
+    else{k--;for(;i<k;i++){hookl[i]=hookl[i+1];hookf[i]=hookf[i+1];}}
+  }
+  else if(fn){
+    if(k==VGA_LINEHOOKS){__DMB();hookn=k;return -1;}
+    for(int j=k++;j>i;j--){hookl[j]=hookl[j-1];hookf[j]=hookf[j-1];}
+    hookl[i]=n;hookf[i]=fn;
+  }
+  __DMB();
+  hookn=k;
+  return 0;
+}
+
+// How each line start waits for TC4 (see TC5_Handler). A window of 0 starts
+// at 64 cycles and is calibrated as it goes.
+void Vga::setLineWait(int scheme, int window)
+{
+  lwauto=window<=0;
+  lwindow=lwauto?64:max(16,min(window,256));
+  lwlate=0;
+  lwait=scheme==VGA_WAIT_WINDOW?VGA_WAIT_WINDOW:VGA_WAIT_LINE;
+  if(!up)return;
+  REG_TC1_RA2=(xclocks-lwindow)>>1;
+  if(lwait==VGA_WAIT_WINDOW)NVIC_EnableIRQ(TC5_IRQn);
+  else NVIC_DisableIRQ(TC5_IRQn);
+}
+
+// Cycles a frame left to the sketch, on average over some whole frames. The
+// cycle counter is read in a loop that takes well under 32 cycles, so any
+// longer gap between reads is time taken by interrupts.
+uint32_t Vga::freeCycles(int frames)
+{
+  if(!up || frames<=0)return 0;
+  _v_startcyccnt();
+  int f=0,l=line,k;
+  uint32_t n=0,last=DWT->CYCCNT;
+  while(f<=frames){          // from the start of a frame to the end of one
+    uint32_t t=DWT->CYCCNT,d=t-last;last=t;
+    if(f && d<32)n+=d;
+    k=*(volatile int *)&line;if(k<l)f++;l=k;
+  }
+  return n/frames;
+}
+
+// Starts or stops timing the video interrupts. VGA.prof is filled in at the
+// start of each frame once a whole frame has been timed.
+void Vga::setProfiling(bool on)
+{
+  profiling=0;
+  if(!on)return;
+  _v_startcyccnt();
+  memset(&prof,0,sizeof(prof));
+  _v_pacc[0]=_v_pacc[1]=_v_pacc[2]=_v_pacc[3]=0;
+  _v_pline=_v_pworst=_v_pframe=0;_v_plast=line;
+  profiling=1;
 }
 
 void Vga::starttimers()
@@ -332,15 +582,26 @@ void Vga::starttimers()
   REG_TC1_CMR1=0b00000000000010011100010000000000;
   REG_TC1_RC1=xclocks/2; 
   REG_TC1_RA1=0;  
-  REG_TC1_CCR1=0b101;    
   REG_TC1_IER1=0b00010000; 
   REG_TC1_IDR1=0b11101111; 
+
+  REG_PMC_PCER1= 1<<0;   // TC5, for VGA_WAIT_WINDOW, counts in step with TC4
+  REG_TC1_CMR2=0b00000000000000001100000000000000;
+  REG_TC1_RC2=xclocks/2;
+  REG_TC1_RA2=(xclocks-lwindow)>>1;
+  REG_TC1_IER2=0b00000100; 
+  REG_TC1_IDR2=0b11111011; 
+  REG_TC1_CCR1=0b1;
+  REG_TC1_CCR2=0b1;
+  REG_TC1_BCR=1;         // start both together
 }
 
 void Vga::stoptimers()
 {
     REG_TC1_CCR1=0b10;    
     REG_TC1_IDR1=0b00010000; 
+    REG_TC1_CCR2=0b10;    
+    REG_TC1_IDR2=0b00000100; 
     REG_PMC_PCDR0= 1<<28;
 
     REG_PWM_DIS= 1<<2;
@@ -356,7 +617,7 @@ void Vga::startmono(){
     REG_DMAC_EN=1;
     REG_DMAC_GCFG=0x00;
     REG_DMAC_EBCIER=1<<4;
-    REG_DMAC_SADDR4=(uint32_t)VGA.pb;
+    REG_DMAC_SADDR4=(uint32_t)VGA.pbf;
     REG_DMAC_DADDR4=(uint32_t)&REG_SPI0_TDR;  
     REG_DMAC_DSCR4=0;
     REG_DMAC_CTRLB4=0x20310000;
@@ -386,7 +647,7 @@ void Vga::startcolour(){
   REG_DMAC_WPMR=DMAC_WPMR_WPKEY(0x444d4143);
   REG_DMAC_EN=1;
   REG_DMAC_GCFG=0x00;
-  REG_DMAC_SADDR5=(uint32_t)VGA.cb;
+  REG_DMAC_SADDR5=(uint32_t)VGA.cbf;
   REG_DMAC_DADDR5=(uint32_t)0x60000000;
   REG_DMAC_DSCR5=0;
   REG_DMAC_CTRLB5=0x20000000;
@@ -429,22 +690,29 @@ void Vga::dmapri()
   MATRIX->MATRIX_PRAS8=0x00000100;
 }
 
-int Vga::begin(int x, int y, int m)
+int Vga::begin(int x, int y, int m, int vx)
 {
   if(up)VGA.end();
   
-  if(m!=VGA_MONO && m!=VGA_COLOUR) return -4;
+  dbuf=(m&VGA_DOUBLE)!=0;flipping=0;
+  m&=~VGA_DOUBLE;
+  if(m!=VGA_MONO && m!=VGA_COLOUR && m!=VGA_LINES && m!=VGA_4BPP) return -4;
   if(m==VGA_COLOUR && y>380)return -3;
   if(lfreqmin==0){lfreqmin=27000;lfreqmax=83000;ffreqmin=57;ffreqmax=70;}
   
   xsize=x;ysize=y;mode=m;
+  vxsize=(m==VGA_COLOUR && vx>x)?vx:x;
   tww=tw=xsize/8;twh=th=ysize/8;twx=twy=tx=ty=0;
   ink=255;paper=0;
   synced=0;framecount=0;line=linedouble=0;
+  lmissed=lmissline=0;lwlate=0;
+  xpan=xoff=0;yscroll=yoff=0;ywrap= -1;dl=dlr=0;dln=0;sprdrawn=0;
     
   int r;
   r=calcmodeline(); if(r)return r;
   r=allocvideomem(); if(r)return r;
+  bindraster();
+  if(mode==VGA_4BPP)setPalette(0);
   
   dmapri();
   
@@ -453,17 +721,18 @@ int Vga::begin(int x, int y, int m)
   starttimers();
 
   if(mode == VGA_MONO)startmono();
-  else if (mode == VGA_COLOUR)startcolour();
+  else if (mode == VGA_COLOUR || (mode & VGA_LINES))startcolour();
   startinterrupts();
   
   up=1;
   return 0;
 }
 
-int Vga::beginPAL()
+int Vga::beginPAL(int vx)
 {
-  mode=VGA_PAL;
+  mode=VGA_PAL;dbuf=flipping=0;
   xsize=320;ysize=240;tww=40;twh=30;twx=twy=tx=ty=0;
+  vxsize=vx>xsize?vx:xsize;
   ink=255;paper=0;
   synced=0;framecount=0;
   xscale=12;yscale=1;
@@ -473,14 +742,17 @@ int Vga::beginPAL()
   xclocks=5376; xstart=126;
   xsyncwidth=394;
   line=linedouble=0;
-  phase=0;poff=28;
+  xpan=xoff=0;yscroll=yoff=0;ywrap= -1;dl=dlr=0;dln=0;sprdrawn=0;
+  phase=0;poff=28;enccycles=0;lwlate=0;
+  _v_startcyccnt();
   
   int r;
   dmabuf=(uint16_t *)malloc(2048);
   crt[0]=(const uint16_t *)cretab;
   crt[1]=(const uint16_t *)crotab;
   cbt[0]=cbetab;cbt[1]=cbotab;
-  r=allocvideomem(); if(r)return r;  
+  r=allocvideomem(); if(r)return r;
+  bindraster();
   pinMode(_v_hsync,OUTPUT); 
   pinMode(_v_vsync,OUTPUT); 
   starttimers();
@@ -513,10 +785,11 @@ int Vga::beginPAL()
 }
 
 
-int Vga::beginNTSC()
+int Vga::beginNTSC(int vx)
 {
-  mode=VGA_NTSC;
+  mode=VGA_NTSC;dbuf=flipping=0;
   xsize=320;ysize=200;tww=40;twh=25;twx=twy=tx=ty=0;
+  vxsize=vx>xsize?vx:xsize;
   ink=255;paper=0;
   synced=0;framecount=0;
   xscale=12;yscale=1;
@@ -526,12 +799,15 @@ int Vga::beginNTSC()
   xclocks=5328; xstart=130;
   xsyncwidth=394;
   line=linedouble=0;
-  phase=0;poff=8;
+  xpan=xoff=0;yscroll=yoff=0;ywrap= -1;dl=dlr=0;dln=0;sprdrawn=0;
+  phase=0;poff=8;enccycles=0;lwlate=0;
+  _v_startcyccnt();
   
   int r;
   dmabuf=(uint16_t *)malloc(2048);
   crt[0]=(const uint16_t *)crtab;cbt[0]=cbtab;
-  r=allocvideomem(); if(r)return r;  
+  r=allocvideomem(); if(r)return r;
+  bindraster();
   pinMode(_v_hsync,OUTPUT); 
   pinMode(_v_vsync,OUTPUT); 
   starttimers();
@@ -570,7 +846,7 @@ void Vga::end()
   
   stopinterrupts();
   if(mode == VGA_MONO)stopmono();
-  else if (mode & VGA_COLOUR)stopcolour(); 
+  else if (mode & (VGA_COLOUR|VGA_LINES))stopcolour(); 
   
   stoptimers();
   pinMode(_v_hsync,INPUT); 
@@ -578,10 +854,12 @@ void Vga::end()
   
   freevideomem();
   if((mode==VGA_NTSC) || (mode==VGA_PAL))free(dmabuf);
+  raster=0;profiling=0;
   
-  pclock=xsize=xsyncstart=xsyncend=xtotal=ysize=ysyncstart=ysyncend=ytotal=0;
+  pclock=xsize=vxsize=xsyncstart=xsyncend=xtotal=ysize=ysyncstart=ysyncend=ytotal=0;
   mode=line=linedouble=synced=xclocks=xstart=xsyncwidth=xscale=yscale=0;
   lfreq=ffreq=ltot=0;
+  xpan=xoff=0;yscroll=yoff=0;ywrap= -1;dl=dlr=0;dln=0;sprdrawn=0;
 
   return;
 }
@@ -55,13 +55,118 @@ inline void _v_digitalWriteDirect(int pin, boolean val){
 #define VGA_COLOR VGA_COLOUR 
 #define VGA_NTSC 18
 #define VGA_PAL 34
+#define VGA_DOUBLE 64 // or with VGA_MONO or VGA_COLOUR for two frame buffers
+#define VGA_LINES 128 // colour with no frame buffer, see setLineRenderer
+#define VGA_4BPP 384  // VGA_LINES with a 16 colour frame buffer, see setPalette
+
+#define VGA_LINEHOOKS 4 // the most onLine hooks
+#define VGA_POLYMAX 64  // the most corners fillPolygon takes; it needs 17
+                        // bytes of stack for each, about 1.1K in all
+
+// Draw command queue opcodes (see beginQueue). A command is its opcode
+// byte, then the arguments of the call as little-endian int16s, in order.
+// VGA_QTEXT is followed by the text and its 0, and VGA_QPOLY by the points.
+#define VGA_QCLEAR 1       // c
+#define VGA_QPIXEL 2       // x,y,c
+#define VGA_QLINE 3        // x0,y0,x1,y1,c
+#define VGA_QLINEX 4       // x0,y0,x1,y1,c
+#define VGA_QHLINE 5       // y,x0,x1,c
+#define VGA_QTRI 6         // x0,y0,x1,y1,x2,y2,c
+#define VGA_QFILLTRI 7     // x0,y0,x1,y1,x2,y2,c
+#define VGA_QRECT 8        // x0,y0,x1,y1,c
+#define VGA_QFILLRECT 9    // x0,y0,x1,y1,c
+#define VGA_QCIRCLE 10     // x,y,r,c
+#define VGA_QFILLCIRCLE 11 // x,y,r,c
+#define VGA_QELLIPSE 12    // x0,y0,x1,y1,c
+#define VGA_QFILLELLIPSE 13 // x0,y0,x1,y1,c
+#define VGA_QPOLY 14       // n,c,rule, then n x,y pairs
+#define VGA_QTEXT 15       // x,y,fgcol,bgcol,dir, then the text
+#define VGA_QSCROLL 16     // x,y,w,h,dx,dy,c
+
+// fillPolygon fill rules
+#define VGA_EVENODD 0
+#define VGA_NONZERO 1
+
+// setLineWait schemes
+#define VGA_WAIT_LINE 0   // the sync interrupt sleeps until the line starts
+#define VGA_WAIT_WINDOW 1 // a timer wakes the processor just before it does
+
+// Hosted builds (see extras/HostBench) have no bit-band region and supply
+// their own _v_bitband and _v_bitbandof; on the Due it is just a pointer
+// into the alias, and _v_bitbandof(p) the alias of bit 0 at SRAM address p.
+#ifndef _V_BITBAND_EMULATED
+typedef uint32_t *_v_bitband;
+static inline _v_bitband _v_bitbandof(void *p)
+{
+  return (uint32_t *)(((uint32_t)p-0x20000000)*32+0x22000000);
+}
+#endif
+
+class Vga;
+
+// One entry of a display list (see setDisplayList). From visible line `line`
+// on, the screen shows the lines starting at addr, stride bytes apart.
+struct VgaRegion {
+  int line;
+  const void *addr;
+  int stride;
+};
+
+// A sprite for setSprites. Moving it is just a change to x and y (and a call
+// to updateSprites in the frame buffer modes).
+#define VGA_SPRITES 32 // the most sprites setSprites will show
+struct VgaSprite {
+  int x,y;             // top left corner on screen
+  int w,h;
+  int key;             // colour that is see-through, -1 for none
+  const uint8_t *bits; // w*h colour bytes a row at a time, 0 to hide
+};
+
+// Where the time went in the last whole frame (see setProfiling), in cycles
+// from the first instruction of each video interrupt, or for TC4 from its
+// timer event, to its last, less any time taken by those that interrupted it.
+struct VgaProfile {
+  uint32_t tc4,pwm,dmac,tc5; // each interrupt, over the frame
+  uint32_t frame;            // the frame
+  uint32_t worst;            // the most the interrupts took in one scan line
+  int worstline;             // and the value of line as it ended
+  int free;                  // percent of the frame left for the sketch
+  int frames;                // frames timed since setProfiling
+};
+
+// How runFrame has been keeping up (see setFrameRate), times in microseconds
+struct VgaFrameStats {
+  uint32_t frames;   // runFrame calls
+  uint32_t updates;  // update calls
+  uint32_t renders;  // render calls
+  uint32_t skipped;  // renders skipped for want of time
+  uint32_t missed;   // frames that went by between runFrame calls
+  uint32_t dropped;  // updates given up on when too far behind
+  int frametime;     // from the frame before the last one to the last
+  int jitter;        // how far frametime strays from whole frames, on average
+  int rendertime;    // the last render call
+};
+
+// The drawing routines for one pixel format, chosen by begin() (see raster.h)
+struct _v_raster {
+  void (*pixel)(Vga &v, int x, int y, int col);
+  void (*span)(Vga &v, int y, int x0, int x1, int col);
+  void (*line)(Vga &v, int x0, int y0, int x1, int y1, int col, bool last);
+  void (*circle)(Vga &v, int x, int y, int r, int col);
+  void (*ellipse)(Vga &v, int x0, int y0, int x1, int y1, int col);
+  void (*text)(Vga &v, const char *text, int x, int y, int fgcol, int bgcol, int dir);
+  void (*filltri)(Vga &v, int x0, int y0, int x1, int y1, int x2, int y2, int col);
+  void (*fillcircle)(Vga &v, int x, int y, int r, int col);
+  void (*fillellipse)(Vga &v, int x0, int y0, int x1, int y1, int col);
+  void (*fillpoly)(Vga &v, const int16_t *xy, int n, int col, int rule);
+};
 
 class Vga : public Print {
     
 public:
-  int  begin(int x, int y, int m=VGA_MONO);
-  int  beginPAL();
-  int  beginNTSC();  
+  int  begin(int x, int y, int m=VGA_MONO, int vx=0);
+  int  beginPAL(int vx=0);
+  int  beginNTSC(int vx=0);  
   void end();
   
   void clear(int c=0);
@@ -77,8 +182,26 @@ public:
   void fillCircle(int x, int y, int r, int col);
   void drawEllipse(int x0, int y0, int x1, int y1, int col);
   void fillEllipse(int x0, int y0, int x1, int y1, int col);
+  int  fillPolygon(const int16_t *xy, int n, int col, int rule=VGA_NONZERO);
   void drawText(char *text, int x, int y, int fgcol, int bgcol= -256, int dir=0);  
   void scroll(int x, int y, int w, int h, int dx, int dy,int col=0);
+  void beginQueue(uint8_t *buf, int size);
+  int  endQueue();
+  int  runQueue(const uint8_t *q, int n);
+  int  flipQueue();
+  void setScrollY(int n){if(ysize){n%=ysize;if(n<0)n+=ysize;yscroll=n;}}
+  void setDisplayList(const VgaRegion *list, int n){dl=n>0?list:0;dln=n>0?n:0;}
+  void setLineRenderer(void (*fn)(int line, uint8_t *buf)){lrender=fn;}
+  void setPalette(const uint8_t *p);
+  void setColourMap(const uint8_t *map){cmap=map;}
+  void setPalette(int i, int c);
+  void setTileMap(const uint8_t *map, int w, int h, const uint8_t *tiles);
+  void setSprites(VgaSprite *list, int n){spr=n>0?list:0;sprn=n>0?min(n,VGA_SPRITES):0;}
+  int  updateSprites();
+  void hideSprites();
+  void setTileScroll(int x, int y){if(tmap){x%=tmw;if(x<0)x+=tmw;y%=tmh;if(y<0)y+=tmh;
+      tsx=x;tsy=y;}}
+  void setPanX(int x){x=max(0,min(x,vxsize-xsize));if(mode&VGA_COLOUR)x&=~3;xpan=x;}
   
   void moveCursor(int column, int line);
   void setPrintWindow(int left, int top, int width, int height);
@@ -90,9 +213,20 @@ public:
   virtual size_t write(const uint8_t *buffer, size_t size);
   virtual size_t write(uint8_t c);
   
+  void flip();
   void waitBeam(){while((*(volatile int *)&line) < ysize);}
-  void waitSync(){while((*(volatile int *)&line) >= ysize);
-		  while((*(volatile int *)&line) < ysize);}
+  void waitSync(){
+    while((*(volatile int *)&line) >= ysize);
+    while((*(volatile int *)&line) < ysize);
+  }
+  void onVBlank(void (*fn)()){vbhook=fn;}
+  int  onLine(int n, void (*fn)());
+  void setFrameRate(int hz);
+  int  runFrame(void (*update)(), void (*render)());
+  void setLineWait(int scheme, int window=0);
+  uint32_t freeCycles(int frames=16);
+  void setProfiling(bool on);
+  void drawProfile(int x=0, int y=0);
   
   int up; // whether we are running or not
   
@@ -100,17 +234,37 @@ public:
   int pclock; // must divide 84000000
   int xsize,xsyncstart,xsyncend,xtotal;
   int ysize,ysyncstart,ysyncend,ytotal;
+  int vxsize; // width that can be drawn on, more than xsize for a wide canvas
   bool vsyncpol, hsyncpol;
   
   //PAL
   const uint16_t *cbt[2];
   const uint16_t *crt[2];
+  const uint8_t *cmap; // colour each pixel value is shown as, 0 for itself
+  int enccycles;       // cycles taken to encode the last line
   uint16_t *dmabuf;
   int phase,poff;
   
   // various display parameters
   int mode,line,linedouble,synced,framecount; 
+  int xpan,xoff;          // pan offset asked for, and the one shown this frame
+  int yscroll,yoff,ywrap; // ring offset asked for, the one shown this frame, and
+                         // the visible line where scan-out wraps to the top
+  const VgaRegion *dl;int dln;    // display list, 0 if none
+  const VgaRegion *dlr,*dle;int dlnext; // this frame: next entry (0 if no list),
+                                        // end, and the line the next starts
+  uint32_t dladdr;int dlstride;  // address of the line last sent, and step
   int xclocks,xstart,xsyncwidth,xscale,yscale,lfreq,ffreq,ltot,debug;
+  int lwait,lwindow,lwauto; // setLineWait scheme, window in cycles, whether
+                            // the window is calibrated as it goes
+  int lwlate;               // lines the window opened too late for
+  int profiling;VgaProfile prof; // setProfiling, and its results
+  void (*vbhook)();               // onVBlank, 0 if none
+  uint8_t *qbuf;int qsize,qlen,qover; // draw commands being recorded, 0 if
+                                      // not, and whether some didn't fit
+  int fstep;VgaFrameStats fstats; // runFrame: microseconds an update, 0 for a frame
+  volatile int hookl[VGA_LINEHOOKS];void (*volatile hookf[VGA_LINEHOOKS])();
+  volatile int hookn;             // onLine, in line order
   
   int lfreqmin,lfreqmax,ffreqmin,ffreqmax;
   void setMonitorFreqRange(int hmin, int hmax, int vmin, int vmax){
@@ -120,8 +274,11 @@ public:
   uint16_t *pb; // Pixel buffer memory address
   int pw;	// Count of words from one line to the next (aka stride or pitch)
   int pbsize;   // Total size of pixel buffer (note these sizes are 16-bit words)
+  uint16_t *pbf; // Pixel buffer being displayed. Drawing goes to pb, which is
+		 // the same buffer unless begin() was asked for VGA_DOUBLE
 
-  uint32_t *pbb; // Pixel buffer bit-banding alias address (read the datasheet p75)
+  _v_bitband pbb; // Pixel buffer bit-banding alias address (read the datasheet p75)
+  _v_bitband pbbf; // Bit-banding alias of pbf
   int pbw;	 // Pixel buffer bit-banding stride (in 32-bit words)
   // To help understand usage of these, look at the following functions:
   void putPPixelFast(int x, int y, int c){pbb[y*pbw+(x^15)]=c;}
@@ -130,8 +287,21 @@ public:
   uint8_t *cb;   // Colour buffer memory address
   int cw;	 // Colour buffer stride, in bytes
   int cbsize;	 // Size of colour buffer in bytes
+  uint8_t *cbf;  // Colour buffer being displayed, as pbf
+  int dbuf;	 // 1 if there are two buffers
+  int flipping;  // flip() is waiting for the end of the frame
   void putCPixelFast(int x, int y, int c){cb[y*cw+x]=c;}
   int getCPixelFast(int x, int y){return cb[y*cw+x];}
+
+  // VGA_LINES: the two line buffers, and the function that fills them
+  uint8_t *lbuf[2];
+  void (*lrender)(int line, uint8_t *buf);
+  int lmissed,lmissline; // lines rendered too late, and the last one
+  const uint8_t *tmap,*ttiles; // tile map (tmw x tmh bytes) and 8x8 tiles
+  int tmw,tmh,tsx,tsy,tmx,tmy; // map size, scroll asked for and shown, in tiles
+  VgaSprite *spr;int sprn;     // sprites, 0 if none
+  uint8_t pal[16];             // VGA_4BPP: the colour of each pixel value
+  int sprdrawn;                // how many of them updateSprites has drawn
   
   int tx,ty;	// Text cursor
   int tw,th;	// Text width / height
@@ -151,10 +321,18 @@ private:
   void startcolour();
   void stopcolour();
   void dmapri();
+  void bindraster();
+  void record(int op, const int *a, int n, const void *data=0, int len=0);
+  
+  const _v_raster *raster; // drawing routines for the current mode, 0 if none
   
 };
 
 extern Vga VGA;
 
+// Fills buf with line `line` in VGA_LINES mode: the line renderer, then the
+// sprites. Called from the video interrupt (see lines.cpp).
+void _v_renderline(int line, uint8_t *buf);
+
 
 #endif
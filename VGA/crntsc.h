@@ -24,7 +24,7 @@ const uint16_t cbtab[176]={
    0x2d57, 0x4a21, 0x2a55, 0x4e24, 0x2752, 0x5126, 0x254f, 0x5429, 
    0x204d, 0x572d, 0x1f47, 0x5830, 0x1e44, 0x5936, 0x1e3e, 0x5938
 };
-const uint16_t crtab[88][256]={
+const uint16_t crtab[96][256]={
    { 
      0x4747, 0x6047, 0x7a48, 0x9348, 0x4d48, 0x6749, 0x8049, 0x994a, 
      0x534a, 0x6d4a, 0x864b, 0xa04b, 0x5a4b, 0x734b, 0x8d4c, 0xa64c, 
@@ -2929,6 +2929,270 @@ const uint16_t crtab[88][256]={
      0xa544, 0x9650, 0x875b, 0x7966, 0xb75a, 0xa865, 0x9970, 0x8a7b, 
      0xc96f, 0xba7b, 0xab86, 0x9c91, 0xdb85, 0xcc90, 0xbd9b, 0xaea6, 
      0xed9b, 0xdea6, 0xcfb1, 0xc0bc, 0xfeb0, 0xefbb, 0xe0c6, 0xd1d1 
+  }, { 
+     0x4747, 0x6047, 0x7a48, 0x9348, 0x4d48, 0x6749, 0x8049, 0x994a, 
+     0x534a, 0x6d4a, 0x864b, 0xa04b, 0x5a4b, 0x734b, 0x8d4c, 0xa64c, 
+     0x604c, 0x7a4d, 0x934d, 0xac4e, 0x664e, 0x804e, 0x994f, 0xb34f, 
+     0x6d4f, 0x8650, 0xa050, 0xb951, 0x7351, 0x8d51, 0xa652, 0xbf52, 
+     0x4959, 0x6359, 0x7c5a, 0x965a, 0x505a, 0x695b, 0x835b, 0x9c5c, 
+     0x565c, 0x6f5c, 0x895d, 0xa25d, 0x5c5d, 0x765e, 0x8f5e, 0xa95f, 
+     0x635f, 0x7c5f, 0x9660, 0xaf60, 0x6960, 0x8261, 0x9c61, 0xb561, 
+     0x6f61, 0x8962, 0xa262, 0xbc63, 0x7663, 0x8f63, 0xa964, 0xc264, 
+     0x4c6b, 0x656c, 0x7f6c, 0x986d, 0x526d, 0x6c6d, 0x856e, 0x9f6e, 
+     0x596e, 0x726e, 0x8b6f, 0xa56f, 0x5f6f, 0x7870, 0x9270, 0xab71, 
+     0x6571, 0x7f71, 0x9872, 0xb272, 0x6c72, 0x8573, 0x9e73, 0xb874, 
+     0x7274, 0x8b74, 0xa575, 0xbe75, 0x7875, 0x9276, 0xab76, 0xc576, 
+     0x4f7d, 0x687e, 0x817e, 0x9b7f, 0x557f, 0x6e7f, 0x8880, 0xa180, 
+     0x5b80, 0x7581, 0x8e81, 0xa882, 0x6182, 0x7b82, 0x9483, 0xae83, 
+     0x6883, 0x8183, 0x9b84, 0xb484, 0x6e84, 0x8885, 0xa185, 0xbb86, 
+     0x7486, 0x8e86, 0xa787, 0xc187, 0x7b87, 0x9488, 0xae88, 0xc789, 
+     0x5190, 0x6b90, 0x8491, 0x9d91, 0x5791, 0x7191, 0x8a92, 0xa492, 
+     0x5e92, 0x7793, 0x9193, 0xaa94, 0x6494, 0x7e94, 0x9795, 0xb095, 
+     0x6a95, 0x8496, 0x9d96, 0xb797, 0x7197, 0x8a97, 0xa498, 0xbd98, 
+     0x7798, 0x9199, 0xaa99, 0xc399, 0x7d99, 0x979a, 0xb09a, 0xca9b, 
+     0x54a2, 0x6da2, 0x87a3, 0xa0a3, 0x5aa3, 0x73a4, 0x8da4, 0xa6a5, 
+     0x60a5, 0x7aa5, 0x93a6, 0xada6, 0x67a6, 0x80a6, 0x9aa7, 0xb3a7, 
+     0x6da7, 0x86a8, 0xa0a8, 0xb9a9, 0x73a9, 0x8da9, 0xa6aa, 0xc0aa, 
+     0x7aaa, 0x93ab, 0xadab, 0xc6ac, 0x80ac, 0x99ac, 0xb3ad, 0xccad, 
+     0x56b4, 0x70b4, 0x89b5, 0xa3b5, 0x5db5, 0x76b6, 0x8fb6, 0xa9b7, 
+     0x63b7, 0x7cb7, 0x96b8, 0xafb8, 0x69b8, 0x83b9, 0x9cb9, 0xb6ba, 
+     0x70ba, 0x89ba, 0xa2bb, 0xbcbb, 0x76bb, 0x8fbc, 0xa9bc, 0xc2bc, 
+     0x7cbc, 0x96bd, 0xafbd, 0xc9be, 0x83be, 0x9cbe, 0xb5bf, 0xcfbf, 
+     0x59c6, 0x72c7, 0x8cc7, 0xa5c8, 0x5fc8, 0x79c8, 0x92c9, 0xacc9, 
+     0x66c9, 0x7fc9, 0x98ca, 0xb2ca, 0x6cca, 0x85cb, 0x9fcb, 0xb8cc, 
+     0x72cc, 0x8ccc, 0xa5cd, 0xbfcd, 0x78cd, 0x92ce, 0xabce, 0xc5cf, 
+     0x7fcf, 0x98cf, 0xb2d0, 0xcbd0, 0x85d0, 0x9fd1, 0xb8d1, 0xd2d2 
+  }, { 
+     0x4747, 0x374f, 0x2857, 0x1860, 0x575d, 0x4865, 0x386e, 0x2976, 
+     0x6773, 0x587c, 0x4884, 0x398c, 0x788a, 0x6892, 0x599a, 0x49a3, 
+     0x88a0, 0x78a8, 0x69b1, 0x59b9, 0x98b7, 0x89bf, 0x79c7, 0x6acf, 
+     0xa9cd, 0x99d5, 0x8add, 0x7ae6, 0xb9e3, 0xa9eb, 0x9af4, 0x8afc, 
+     0x5141, 0x4149, 0x3251, 0x2259, 0x6157, 0x525f, 0x4268, 0x3370, 
+     0x726d, 0x6276, 0x537e, 0x4386, 0x8284, 0x728c, 0x6394, 0x539c, 
+     0x929a, 0x83a2, 0x73ab, 0x64b3, 0xa2b0, 0x93b9, 0x83c1, 0x74c9, 
+     0xb3c7, 0xa3cf, 0x94d7, 0x84e0, 0xc3dd, 0xb4e5, 0xa4ee, 0x95f6, 
+     0x5b3b, 0x4c43, 0x3c4b, 0x2d53, 0x6b51, 0x5c59, 0x4c61, 0x3d6a, 
+     0x7c67, 0x6c70, 0x5d78, 0x4d80, 0x8c7e, 0x7c86, 0x6d8e, 0x5d96, 
+     0x9c94, 0x8d9c, 0x7da5, 0x6ead, 0xadaa, 0x9db3, 0x8ebb, 0x7ec3, 
+     0xbdc1, 0xadc9, 0x9ed1, 0x8ed9, 0xcdd7, 0xbedf, 0xaee8, 0x9ff0, 
+     0x6535, 0x563d, 0x4645, 0x374d, 0x764b, 0x6653, 0x575b, 0x4764, 
+     0x8661, 0x766a, 0x6772, 0x577a, 0x9678, 0x8780, 0x7788, 0x6890, 
+     0xa68e, 0x9796, 0x879e, 0x78a7, 0xb7a4, 0xa7ad, 0x98b5, 0x88bd, 
+     0xc7bb, 0xb8c3, 0xa8cb, 0x99d3, 0xd7d1, 0xc8d9, 0xb8e2, 0xa9ea, 
+     0x6f2e, 0x6037, 0x503f, 0x4147, 0x8045, 0x704d, 0x6155, 0x515e, 
+     0x905b, 0x8163, 0x716c, 0x6274, 0xa072, 0x917a, 0x8182, 0x728a, 
+     0xb188, 0xa190, 0x9298, 0x82a1, 0xc19e, 0xb1a6, 0xa2af, 0x92b7, 
+     0xd1b5, 0xc2bd, 0xb2c5, 0xa3cd, 0xe2cb, 0xd2d3, 0xc3db, 0xb3e4, 
+     0x7a28, 0x6a31, 0x5b39, 0x4b41, 0x8a3f, 0x7a47, 0x6b4f, 0x5b58, 
+     0x9a55, 0x8b5d, 0x7b66, 0x6c6e, 0xaa6b, 0x9b74, 0x8b7c, 0x7c84, 
+     0xbb82, 0xab8a, 0x9c92, 0x8c9b, 0xcb98, 0xbca0, 0xaca9, 0x9db1, 
+     0xdbaf, 0xccb7, 0xbcbf, 0xadc7, 0xecc5, 0xdccd, 0xcdd5, 0xbdde, 
+     0x8422, 0x742b, 0x6533, 0x553b, 0x9439, 0x8541, 0x7549, 0x6651, 
+     0xa44f, 0x9557, 0x8560, 0x7668, 0xb565, 0xa56e, 0x9676, 0x867e, 
+     0xc57c, 0xb584, 0xa68c, 0x9695, 0xd592, 0xc69a, 0xb6a3, 0xa7ab, 
+     0xe6a8, 0xd6b1, 0xc7b9, 0xb7c1, 0xf6bf, 0xe6c7, 0xd7cf, 0xc7d8, 
+     0x8e1c, 0x7e25, 0x6f2d, 0x5f35, 0x9e33, 0x8f3b, 0x7f43, 0x704b, 
+     0xaf49, 0x9f51, 0x9059, 0x8062, 0xbf5f, 0xaf68, 0xa070, 0x9078, 
+     0xcf76, 0xc07e, 0xb086, 0xa18e, 0xdf8c, 0xd094, 0xc09d, 0xb1a5, 
+     0xf0a2, 0xe0ab, 0xd1b3, 0xc1bb, 0xffb9, 0xf0c1, 0xe1c9, 0xd1d1 
+  }, { 
+     0x4747, 0x614a, 0x7a4e, 0x9451, 0x4f47, 0x684b, 0x824e, 0x9c52, 
+     0x5748, 0x704c, 0x8a4f, 0xa452, 0x5e49, 0x784c, 0x9250, 0xac53, 
+     0x664a, 0x804d, 0x9a50, 0xb454, 0x6e4a, 0x884e, 0xa251, 0xbc54, 
+     0x764b, 0x904e, 0xaa52, 0xc355, 0x7e4c, 0x984f, 0xb152, 0xcb56, 
+     0x4858, 0x615c, 0x7b5f, 0x9563, 0x5059, 0x695d, 0x8360, 0x9d63, 
+     0x575a, 0x715d, 0x8b61, 0xa564, 0x5f5b, 0x795e, 0x9361, 0xad65, 
+     0x675b, 0x815f, 0x9b62, 0xb565, 0x6f5c, 0x895f, 0xa363, 0xbc66, 
+     0x775d, 0x9160, 0xaa63, 0xc467, 0x7f5d, 0x9961, 0xb264, 0xcc68, 
+     0x496a, 0x626d, 0x7c71, 0x9674, 0x506b, 0x6a6e, 0x8472, 0x9e75, 
+     0x586b, 0x726f, 0x8c72, 0xa676, 0x606c, 0x7a70, 0x9473, 0xae76, 
+     0x686d, 0x8270, 0x9c74, 0xb577, 0x706e, 0x8a71, 0xa374, 0xbd78, 
+     0x786e, 0x9272, 0xab75, 0xc578, 0x806f, 0x9972, 0xb376, 0xcd79, 
+     0x497c, 0x637f, 0x7d83, 0x9786, 0x517c, 0x6b80, 0x8583, 0x9f87, 
+     0x597d, 0x7381, 0x8d84, 0xa787, 0x617e, 0x7b81, 0x9585, 0xae88, 
+     0x697f, 0x8382, 0x9d85, 0xb689, 0x717f, 0x8b83, 0xa486, 0xbe89, 
+     0x7980, 0x9283, 0xac87, 0xc68a, 0x8181, 0x9a84, 0xb487, 0xce8b, 
+     0x4a8d, 0x6491, 0x7e94, 0x9898, 0x528e, 0x6c91, 0x8695, 0xa098, 
+     0x5a8f, 0x7492, 0x8e96, 0xa799, 0x6290, 0x7c93, 0x9696, 0xaf9a, 
+     0x6a90, 0x8494, 0x9d97, 0xb79a, 0x7291, 0x8b94, 0xa598, 0xbf9b, 
+     0x7a92, 0x9395, 0xad98, 0xc79c, 0x8192, 0x9b96, 0xb599, 0xcf9d, 
+     0x4b9f, 0x65a2, 0x7fa6, 0x99a9, 0x53a0, 0x6da3, 0x87a7, 0xa0aa, 
+     0x5ba0, 0x75a4, 0x8fa7, 0xa8ab, 0x63a1, 0x7da5, 0x96a8, 0xb0ab, 
+     0x6ba2, 0x85a5, 0x9ea9, 0xb8ac, 0x73a3, 0x8ca6, 0xa6a9, 0xc0ad, 
+     0x7aa3, 0x94a7, 0xaeaa, 0xc8ad, 0x82a4, 0x9ca7, 0xb6ab, 0xd0ae, 
+     0x4cb1, 0x66b4, 0x80b8, 0x99bb, 0x54b1, 0x6eb5, 0x88b8, 0xa1bc, 
+     0x5cb2, 0x76b6, 0x8fb9, 0xa9bc, 0x64b3, 0x7eb6, 0x97ba, 0xb1bd, 
+     0x6cb4, 0x85b7, 0x9fba, 0xb9be, 0x73b4, 0x8db8, 0xa7bb, 0xc1be, 
+     0x7bb5, 0x95b8, 0xafbc, 0xc9bf, 0x83b6, 0x9db9, 0xb7bc, 0xd1c0, 
+     0x4dc2, 0x67c6, 0x81c9, 0x9acd, 0x55c3, 0x6fc6, 0x88ca, 0xa2cd, 
+     0x5dc4, 0x77c7, 0x90cb, 0xaace, 0x65c4, 0x7ec8, 0x98cb, 0xb2cf, 
+     0x6cc5, 0x86c9, 0xa0cc, 0xbacf, 0x74c6, 0x8ec9, 0xa8cd, 0xc2d0, 
+     0x7cc7, 0x96ca, 0xb0cd, 0xcad1, 0x84c7, 0x9ecb, 0xb8ce, 0xd2d2 
+  }, { 
+     0x4747, 0x374c, 0x2751, 0x1857, 0x555e, 0x4663, 0x3668, 0x276e, 
+     0x6475, 0x557a, 0x457f, 0x3585, 0x738c, 0x6391, 0x5496, 0x449c, 
+     0x82a3, 0x72a8, 0x62ad, 0x53b2, 0x90ba, 0x81bf, 0x71c4, 0x61c9, 
+     0x9fd0, 0x8fd6, 0x80db, 0x70e0, 0xaee7, 0x9eed, 0x8ef2, 0x7ff7, 
+     0x5341, 0x4347, 0x334c, 0x2451, 0x6158, 0x525e, 0x4263, 0x3268, 
+     0x706f, 0x6075, 0x517a, 0x417f, 0x7f86, 0x6f8c, 0x5f91, 0x5096, 
+     0x8d9d, 0x7ea2, 0x6ea8, 0x5ead, 0x9cb4, 0x8cb9, 0x7dbf, 0x6dc4, 
+     0xabcb, 0x9bd0, 0x8cd6, 0x7cdb, 0xbae2, 0xaae7, 0x9aed, 0x8bf2, 
+     0x5e3c, 0x4f41, 0x3f47, 0x2f4c, 0x6d53, 0x5d58, 0x4e5d, 0x3e63, 
+     0x7c6a, 0x6c6f, 0x5d74, 0x4d7a, 0x8b81, 0x7b86, 0x6b8b, 0x5c91, 
+     0x9998, 0x8a9d, 0x7aa2, 0x6aa8, 0xa8af, 0x98b4, 0x89b9, 0x79bf, 
+     0xb7c6, 0xa7cb, 0x97d0, 0x88d6, 0xc5dd, 0xb6e2, 0xa6e7, 0x96ed, 
+     0x6a37, 0x5b3c, 0x4b41, 0x3b46, 0x794d, 0x6953, 0x5a58, 0x4a5d, 
+     0x8864, 0x786a, 0x686f, 0x5974, 0x967b, 0x8781, 0x7786, 0x678b, 
+     0xa592, 0x9598, 0x869d, 0x76a2, 0xb4a9, 0xa4af, 0x94b4, 0x85b9, 
+     0xc2c0, 0xb3c6, 0xa3cb, 0x94d0, 0xd1d7, 0xc2dd, 0xb2e2, 0xa2e7, 
+     0x7631, 0x6636, 0x573c, 0x4741, 0x8548, 0x754d, 0x6553, 0x5658, 
+     0x935f, 0x8464, 0x746a, 0x656f, 0xa276, 0x927b, 0x8381, 0x7386, 
+     0xb18d, 0xa192, 0x9298, 0x829d, 0xc0a4, 0xb0a9, 0xa0af, 0x91b4, 
+     0xcebb, 0xbfc0, 0xafc5, 0x9fcb, 0xddd2, 0xcdd7, 0xbedc, 0xaee2, 
+     0x822c, 0x7231, 0x6336, 0x533c, 0x9143, 0x8148, 0x714d, 0x6253, 
+     0x9f5a, 0x905f, 0x8064, 0x706a, 0xae71, 0x9e76, 0x8f7b, 0x7f80, 
+     0xbd88, 0xad8d, 0x9d92, 0x8e97, 0xcb9e, 0xbca4, 0xaca9, 0x9cae, 
+     0xdab5, 0xcabb, 0xbbc0, 0xabc5, 0xe9cc, 0xd9d2, 0xcad7, 0xbadc, 
+     0x8e26, 0x7e2c, 0x6e31, 0x5f36, 0x9c3d, 0x8d43, 0x7d48, 0x6d4d, 
+     0xab54, 0x9b5a, 0x8c5f, 0x7c64, 0xba6b, 0xaa70, 0x9a76, 0x8b7b, 
+     0xc882, 0xb987, 0xa98d, 0x9a92, 0xd799, 0xc89e, 0xb8a4, 0xa8a9, 
+     0xe6b0, 0xd6b5, 0xc7bb, 0xb7c0, 0xf5c7, 0xe5cc, 0xd5d2, 0xc6d7, 
+     0x9921, 0x8a26, 0x7a2b, 0x6b31, 0xa838, 0x993d, 0x8942, 0x7948, 
+     0xb74f, 0xa754, 0x9859, 0x885f, 0xc666, 0xb66b, 0xa670, 0x9776, 
+     0xd47d, 0xc582, 0xb587, 0xa58d, 0xe394, 0xd399, 0xc49e, 0xb4a4, 
+     0xf2ab, 0xe2b0, 0xd2b5, 0xc3bb, 0xffc2, 0xf1c7, 0xe1cc, 0xd1d1 
+  }, { 
+     0x4747, 0x604d, 0x7a53, 0x945a, 0x5047, 0x6a4d, 0x8454, 0x9d5a, 
+     0x5a47, 0x734e, 0x8d54, 0xa75a, 0x6347, 0x7d4e, 0x9754, 0xb05a, 
+     0x6d48, 0x864e, 0xa054, 0xba5b, 0x7648, 0x904e, 0xaa55, 0xc35b, 
+     0x8048, 0x994e, 0xb355, 0xcd5b, 0x8948, 0xa34f, 0xbd55, 0xd65b, 
+     0x4658, 0x605e, 0x7964, 0x936b, 0x5058, 0x695e, 0x8365, 0x9d6b, 
+     0x5958, 0x735e, 0x8c65, 0xa66b, 0x6358, 0x7c5f, 0x9665, 0xb06b, 
+     0x6c58, 0x865f, 0x9f65, 0xb96c, 0x7659, 0x8f5f, 0xa965, 0xc36c, 
+     0x7f59, 0x995f, 0xb266, 0xcc6c, 0x8959, 0xa260, 0xbc66, 0xd66c, 
+     0x4569, 0x5f6f, 0x7975, 0x937c, 0x4f69, 0x696f, 0x8275, 0x9c7c, 
+     0x5869, 0x726f, 0x8c76, 0xa67c, 0x6269, 0x7c70, 0x9576, 0xaf7c, 
+     0x6b69, 0x8570, 0x9f76, 0xb97c, 0x756a, 0x8f70, 0xa876, 0xc27d, 
+     0x7e6a, 0x9870, 0xb277, 0xcc7d, 0x886a, 0xa270, 0xbb77, 0xd57d, 
+     0x4579, 0x5e80, 0x7886, 0x928c, 0x4e7a, 0x6880, 0x8286, 0x9b8d, 
+     0x587a, 0x7180, 0x8b87, 0xa58d, 0x617a, 0x7b80, 0x9587, 0xae8d, 
+     0x6b7a, 0x8481, 0x9e87, 0xb88d, 0x747a, 0x8e81, 0xa887, 0xc18e, 
+     0x7e7b, 0x9781, 0xb187, 0xcb8e, 0x877b, 0xa181, 0xbb88, 0xd48e, 
+     0x448a, 0x5e91, 0x7797, 0x919d, 0x4d8a, 0x6791, 0x8197, 0x9b9e, 
+     0x578b, 0x7191, 0x8a97, 0xa49e, 0x608b, 0x7a91, 0x9498, 0xae9e, 
+     0x6a8b, 0x8491, 0x9d98, 0xb79e, 0x738b, 0x8d92, 0xa798, 0xc19e, 
+     0x7d8c, 0x9792, 0xb098, 0xca9f, 0x868c, 0xa092, 0xba99, 0xd49f, 
+     0x439b, 0x5da2, 0x77a8, 0x90ae, 0x4d9b, 0x66a2, 0x80a8, 0x9aae, 
+     0x569c, 0x70a2, 0x8aa8, 0xa3af, 0x609c, 0x79a2, 0x93a9, 0xadaf, 
+     0x699c, 0x83a2, 0x9da9, 0xb6af, 0x739c, 0x8ca3, 0xa6a9, 0xc0af, 
+     0x7c9c, 0x96a3, 0xb0a9, 0xc9b0, 0x869d, 0x9fa3, 0xb9a9, 0xd3b0, 
+     0x43ac, 0x5cb2, 0x76b9, 0x90bf, 0x4cac, 0x66b3, 0x7fb9, 0x99bf, 
+     0x56ac, 0x6fb3, 0x89b9, 0xa3c0, 0x5fad, 0x79b3, 0x92b9, 0xacc0, 
+     0x69ad, 0x82b3, 0x9cba, 0xb6c0, 0x72ad, 0x8cb3, 0xa5ba, 0xbfc0, 
+     0x7cad, 0x95b4, 0xafba, 0xc9c0, 0x85ae, 0x9fb4, 0xb8ba, 0xd2c1, 
+     0x42bd, 0x5cc3, 0x75ca, 0x8fd0, 0x4bbd, 0x65c3, 0x7fca, 0x99d0, 
+     0x55bd, 0x6fc4, 0x88ca, 0xa2d0, 0x5ebe, 0x78c4, 0x92ca, 0xacd1, 
+     0x68be, 0x82c4, 0x9bca, 0xb5d1, 0x71be, 0x8bc4, 0xa5cb, 0xbfd1, 
+     0x7bbe, 0x95c5, 0xaecb, 0xc8d1, 0x84be, 0x9ec5, 0xb8cb, 0xd2d2 
+  }, { 
+     0x4747, 0x3749, 0x284b, 0x194e, 0x545e, 0x4460, 0x3563, 0x2665, 
+     0x6175, 0x5278, 0x427a, 0x337c, 0x6e8d, 0x5f8f, 0x4f91, 0x4094, 
+     0x7ba4, 0x6ca6, 0x5ca9, 0x4dab, 0x88bb, 0x79be, 0x69c0, 0x5ac2, 
+     0x95d3, 0x86d5, 0x76d7, 0x67da, 0xa2ea, 0x93ec, 0x83ef, 0x74f1, 
+     0x5442, 0x4545, 0x3547, 0x2649, 0x615a, 0x525c, 0x425e, 0x3361, 
+     0x6e71, 0x5f73, 0x5076, 0x4078, 0x7b88, 0x6c8b, 0x5d8d, 0x4d8f, 
+     0x88a0, 0x79a2, 0x6aa4, 0x5aa7, 0x95b7, 0x86b9, 0x77bc, 0x67be, 
+     0xa2ce, 0x93d1, 0x84d3, 0x74d5, 0xb0e6, 0xa0e8, 0x91ea, 0x81ed, 
+     0x613e, 0x5240, 0x4342, 0x3345, 0x6e55, 0x5f57, 0x505a, 0x405c, 
+     0x7c6c, 0x6c6f, 0x5d71, 0x4d73, 0x8984, 0x7986, 0x6a88, 0x5b8b, 
+     0x969b, 0x869d, 0x77a0, 0x68a2, 0xa3b2, 0x93b5, 0x84b7, 0x75b9, 
+     0xb0ca, 0xa0cc, 0x91ce, 0x82d1, 0xbde1, 0xaee3, 0x9ee6, 0x8fe8, 
+     0x6f39, 0x5f3c, 0x503e, 0x4140, 0x7c51, 0x6c53, 0x5d55, 0x4e58, 
+     0x8968, 0x7a6a, 0x6a6d, 0x5b6f, 0x967f, 0x8782, 0x7784, 0x6886, 
+     0xa397, 0x9499, 0x849b, 0x759e, 0xb0ae, 0xa1b0, 0x91b3, 0x82b5, 
+     0xbdc5, 0xaec8, 0x9eca, 0x8fcc, 0xcadd, 0xbbdf, 0xabe1, 0x9ce4, 
+     0x7c35, 0x6d37, 0x5d39, 0x4e3c, 0x894c, 0x7a4e, 0x6a51, 0x5b53, 
+     0x9663, 0x8766, 0x7868, 0x686a, 0xa37b, 0x947d, 0x857f, 0x7582, 
+     0xb092, 0xa194, 0x9297, 0x8299, 0xbda9, 0xaeac, 0x9fae, 0x8fb0, 
+     0xcac1, 0xbbc3, 0xacc5, 0x9cc8, 0xd8d8, 0xc8da, 0xb9dd, 0xa9df, 
+     0x8930, 0x7a33, 0x6b35, 0x5b37, 0x9748, 0x874a, 0x784c, 0x684f, 
+     0xa45f, 0x9461, 0x8564, 0x7666, 0xb176, 0xa179, 0x927b, 0x837d, 
+     0xbe8d, 0xae90, 0x9f92, 0x9095, 0xcba5, 0xbba7, 0xacaa, 0x9dac, 
+     0xd8bc, 0xc8bf, 0xb9c1, 0xaac3, 0xe5d3, 0xd6d6, 0xc6d8, 0xb7db, 
+     0x972c, 0x872e, 0x7830, 0x6933, 0xa443, 0x9445, 0x8548, 0x764a, 
+     0xb15a, 0xa25d, 0x925f, 0x8361, 0xbe72, 0xaf74, 0x9f76, 0x9079, 
+     0xcb89, 0xbc8b, 0xac8e, 0x9d90, 0xd8a0, 0xc9a3, 0xb9a5, 0xaaa7, 
+     0xe5b8, 0xd6ba, 0xc6bc, 0xb7bf, 0xf2cf, 0xe3d1, 0xd4d4, 0xc4d6, 
+     0xa427, 0x9529, 0x852c, 0x762e, 0xb13e, 0xa241, 0x9243, 0x8346, 
+     0xbe56, 0xaf58, 0xa05b, 0x905d, 0xcb6d, 0xbc6f, 0xad72, 0x9d74, 
+     0xd884, 0xc987, 0xba89, 0xaa8c, 0xe59c, 0xd69e, 0xc7a0, 0xb7a3, 
+     0xf2b3, 0xe3b5, 0xd4b8, 0xc4ba, 0xffca, 0xf0cd, 0xe1cf, 0xd1d1 
+  }, { 
+     0x4747, 0x6050, 0x7959, 0x9263, 0x5247, 0x6b50, 0x8459, 0x9e63, 
+     0x5d47, 0x7650, 0x9059, 0xa963, 0x6847, 0x8150, 0x9b59, 0xb462, 
+     0x7347, 0x8d50, 0xa659, 0xbf62, 0x7f47, 0x9850, 0xb159, 0xca62, 
+     0x8a47, 0xa350, 0xbc59, 0xd562, 0x9546, 0xae50, 0xc759, 0xe162, 
+     0x4557, 0x5e60, 0x7769, 0x9072, 0x5057, 0x6960, 0x8269, 0x9b72, 
+     0x5b57, 0x7460, 0x8d69, 0xa772, 0x6657, 0x7f60, 0x9969, 0xb272, 
+     0x7156, 0x8a60, 0xa469, 0xbd72, 0x7c56, 0x9660, 0xaf69, 0xc872, 
+     0x8856, 0xa160, 0xba69, 0xd372, 0x9356, 0xac60, 0xc569, 0xde72, 
+     0x4267, 0x5c70, 0x7579, 0x8e82, 0x4e66, 0x6770, 0x8079, 0x9982, 
+     0x5966, 0x7270, 0x8b79, 0xa482, 0x6466, 0x7d70, 0x9679, 0xb082, 
+     0x6f66, 0x8870, 0xa279, 0xbb82, 0x7a66, 0x9370, 0xad79, 0xc682, 
+     0x8566, 0x9f70, 0xb879, 0xd182, 0x9166, 0xaa70, 0xc379, 0xdc82, 
+     0x4076, 0x5a80, 0x7389, 0x8c92, 0x4b76, 0x6580, 0x7e89, 0x9792, 
+     0x5776, 0x7080, 0x8989, 0xa292, 0x6276, 0x7b80, 0x9489, 0xad92, 
+     0x6d76, 0x8680, 0x9f89, 0xb992, 0x7876, 0x917f, 0xab89, 0xc492, 
+     0x8376, 0x9d7f, 0xb689, 0xcf92, 0x8e76, 0xa87f, 0xc189, 0xda92, 
+     0x3e86, 0x5790, 0x7199, 0x8aa2, 0x4986, 0x6390, 0x7c99, 0x95a2, 
+     0x5486, 0x6e8f, 0x8799, 0xa0a2, 0x6086, 0x798f, 0x9299, 0xaba2, 
+     0x6b86, 0x848f, 0x9d99, 0xb6a2, 0x7686, 0x8f8f, 0xa899, 0xc2a2, 
+     0x8186, 0x9a8f, 0xb499, 0xcda2, 0x8c86, 0xa68f, 0xbf99, 0xd8a2, 
+     0x3c96, 0x559f, 0x6ea9, 0x88b2, 0x4796, 0x609f, 0x7aa9, 0x93b2, 
+     0x5296, 0x6c9f, 0x85a9, 0x9eb2, 0x5d96, 0x779f, 0x90a9, 0xa9b2, 
+     0x6996, 0x829f, 0x9ba9, 0xb4b2, 0x7496, 0x8d9f, 0xa6a9, 0xbfb2, 
+     0x7f96, 0x989f, 0xb1a8, 0xcbb2, 0x8a96, 0xa39f, 0xbda8, 0xd6b2, 
+     0x3aa6, 0x53af, 0x6cb9, 0x85c2, 0x45a6, 0x5eaf, 0x77b9, 0x91c2, 
+     0x50a6, 0x69af, 0x83b9, 0x9cc2, 0x5ba6, 0x75af, 0x8eb8, 0xa7c2, 
+     0x66a6, 0x80af, 0x99b8, 0xb2c2, 0x72a6, 0x8baf, 0xa4b8, 0xbdc2, 
+     0x7da6, 0x96af, 0xafb8, 0xc8c2, 0x88a6, 0xa1af, 0xbab8, 0xd4c2, 
+     0x38b6, 0x51bf, 0x6ac8, 0x83d2, 0x43b6, 0x5cbf, 0x75c8, 0x8fd2, 
+     0x4eb6, 0x67bf, 0x80c8, 0x9ad2, 0x59b6, 0x72bf, 0x8cc8, 0xa5d2, 
+     0x64b6, 0x7ebf, 0x97c8, 0xb0d2, 0x6fb6, 0x89bf, 0xa2c8, 0xbbd2, 
+     0x7bb6, 0x94bf, 0xadc8, 0xc6d2, 0x86b6, 0x9fbf, 0xb8c8, 0xd2d2 
+  }, { 
+     0x4747, 0x3846, 0x2946, 0x1b45, 0x525e, 0x435e, 0x355d, 0x265d, 
+     0x5e76, 0x4f75, 0x4075, 0x3274, 0x698d, 0x5a8d, 0x4c8c, 0x3d8c, 
+     0x74a5, 0x66a4, 0x57a4, 0x48a3, 0x80bc, 0x71bc, 0x62bb, 0x54ba, 
+     0x8bd4, 0x7cd3, 0x6ed2, 0x5fd2, 0x96eb, 0x88ea, 0x79ea, 0x6ae9, 
+     0x5543, 0x4743, 0x3842, 0x2a42, 0x615b, 0x525a, 0x445a, 0x3559, 
+     0x6c72, 0x5e72, 0x4f71, 0x4071, 0x788a, 0x6989, 0x5a89, 0x4c88, 
+     0x83a1, 0x74a1, 0x66a0, 0x57a0, 0x8eb9, 0x80b8, 0x71b8, 0x62b7, 
+     0x9ad0, 0x8bd0, 0x7ccf, 0x6ece, 0xa5e8, 0x96e7, 0x88e7, 0x79e6, 
+     0x6440, 0x563f, 0x473f, 0x383e, 0x7057, 0x6157, 0x5256, 0x4456, 
+     0x7b6f, 0x6c6e, 0x5e6e, 0x4f6d, 0x8686, 0x7886, 0x6985, 0x5a85, 
+     0x929e, 0x839d, 0x749d, 0x669c, 0x9db5, 0x8eb5, 0x80b4, 0x71b4, 
+     0xa8cd, 0x9acc, 0x8bcc, 0x7dcb, 0xb4e4, 0xa5e4, 0x97e3, 0x88e3, 
+     0x733d, 0x643c, 0x563b, 0x473b, 0x7e54, 0x7053, 0x6153, 0x5252, 
+     0x8a6b, 0x7b6b, 0x6c6a, 0x5e6a, 0x9583, 0x8682, 0x7882, 0x6981, 
+     0xa09a, 0x929a, 0x8399, 0x7499, 0xacb2, 0x9db1, 0x8fb1, 0x80b0, 
+     0xb7c9, 0xa9c9, 0x9ac8, 0x8bc8, 0xc3e1, 0xb4e0, 0xa5e0, 0x97df, 
+     0x8239, 0x7339, 0x6438, 0x5637, 0x8d51, 0x7e50, 0x704f, 0x614f, 
+     0x9868, 0x8a67, 0x7b67, 0x6c66, 0xa480, 0x957f, 0x867e, 0x787e, 
+     0xaf97, 0xa096, 0x9296, 0x8395, 0xbbae, 0xacae, 0x9dad, 0x8fad, 
+     0xc6c6, 0xb7c5, 0xa9c5, 0x9ac4, 0xd1dd, 0xc3dd, 0xb4dc, 0xa5dc, 
+     0x9036, 0x8235, 0x7335, 0x6434, 0x9c4d, 0x8d4d, 0x7e4c, 0x704c, 
+     0xa765, 0x9864, 0x8a64, 0x7b63, 0xb27c, 0xa47c, 0x957b, 0x877a, 
+     0xbe94, 0xaf93, 0xa192, 0x9292, 0xc9ab, 0xbbaa, 0xacaa, 0x9da9, 
+     0xd5c2, 0xc6c2, 0xb7c1, 0xa9c1, 0xe0da, 0xd1d9, 0xc3d9, 0xb4d8, 
+     0x9f32, 0x9032, 0x8231, 0x7331, 0xaa4a, 0x9c49, 0x8d49, 0x7e48, 
+     0xb661, 0xa761, 0x9960, 0x8a60, 0xc179, 0xb378, 0xa478, 0x9577, 
+     0xcd90, 0xbe90, 0xaf8f, 0xa18f, 0xd8a8, 0xc9a7, 0xbba7, 0xaca6, 
+     0xe3bf, 0xd5bf, 0xc6be, 0xb7bd, 0xefd7, 0xe0d6, 0xd1d5, 0xc3d5, 
+     0xae2f, 0x9f2e, 0x902e, 0x822d, 0xb946, 0xab46, 0x9c45, 0x8d45, 
+     0xc55e, 0xb65d, 0xa75d, 0x995c, 0xd075, 0xc175, 0xb374, 0xa474, 
+     0xdb8d, 0xcd8c, 0xbe8c, 0xaf8b, 0xe7a4, 0xd8a4, 0xc9a3, 0xbba3, 
+     0xf2bc, 0xe3bb, 0xd5bb, 0xc6ba, 0xfdd3, 0xefd3, 0xe0d2, 0xd2d1 
   } 
 };
 
@@ -19,7 +19,7 @@ const uint16_t cbetab[60]={
    0x4d1e, 0x1e4c, 0x5343, 0x3921, 0x2657, 0x5931, 0x282d, 0x3558, 
    0x5522, 0x1f41, 0x494e, 0x471e 
 };
-const uint16_t crotab[36][256]={
+const uint16_t crotab[44][256]={
    { 
      0x3c3c, 0x5346, 0x6a50, 0x825b, 0x3e53, 0x555e, 0x6d68, 0x8472, 
      0x406b, 0x5875, 0x6f80, 0x878a, 0x4383, 0x5a8d, 0x7297, 0x89a2, 
@@ -1208,9 +1208,273 @@ const uint16_t crotab[36][256]={
      0xc441, 0xc75c, 0xca76, 0xcd91, 0xc54e, 0xc869, 0xcb83, 0xce9e, 
      0xc65b, 0xc975, 0xcc90, 0xcfab, 0xc767, 0xca82, 0xcd9d, 0xd0b8, 
      0xc874, 0xcb8f, 0xceaa, 0xd1c5, 0xc981, 0xcc9c, 0xcfb7, 0xd2d2 
+  }, { 
+     0x3c3c, 0x532e, 0x6b20, 0x8312, 0x4c51, 0x6444, 0x7c36, 0x9328, 
+     0x5d67, 0x755a, 0x8c4c, 0xa43e, 0x6e7d, 0x8570, 0x9d62, 0xb554, 
+     0x7f93, 0x9686, 0xae78, 0xc66a, 0x8fa9, 0xa79c, 0xbf8e, 0xd680, 
+     0xa0bf, 0xb8b2, 0xcfa4, 0xe796, 0xb1d5, 0xc9c8, 0xe0ba, 0xf8ac, 
+     0x3641, 0x4e33, 0x6525, 0x7d18, 0x4757, 0x5e49, 0x763b, 0x8e2e, 
+     0x586d, 0x6f5f, 0x8751, 0x9f44, 0x6883, 0x8075, 0x9867, 0xaf5a, 
+     0x7999, 0x918b, 0xa87d, 0xc070, 0x8aaf, 0xa2a1, 0xb993, 0xd185, 
+     0x9bc5, 0xb2b7, 0xcaa9, 0xe29b, 0xabdb, 0xc3cd, 0xdbbf, 0xf2b1, 
+     0x3146, 0x4838, 0x602b, 0x781d, 0x415c, 0x594e, 0x7141, 0x8833, 
+     0x5272, 0x6a64, 0x8157, 0x9949, 0x6388, 0x7b7a, 0x926d, 0xaa5f, 
+     0x749e, 0x8b90, 0xa383, 0xbb75, 0x84b4, 0x9ca6, 0xb499, 0xcb8b, 
+     0x95ca, 0xadbc, 0xc4af, 0xdca1, 0xa6e0, 0xbed2, 0xd5c5, 0xedb7, 
+     0x2b4c, 0x433e, 0x5a30, 0x7222, 0x3c62, 0x5354, 0x6b46, 0x8338, 
+     0x4d77, 0x646a, 0x7c5c, 0x944e, 0x5d8d, 0x7580, 0x8d72, 0xa464, 
+     0x6ea3, 0x8696, 0x9d88, 0xb57a, 0x7fb9, 0x97ac, 0xae9e, 0xc690, 
+     0x90cf, 0xa7c2, 0xbfb4, 0xd7a6, 0xa0e5, 0xb8d8, 0xd0ca, 0xe7bc, 
+     0x2651, 0x3d43, 0x5535, 0x6d28, 0x3667, 0x4e59, 0x664b, 0x7d3e, 
+     0x477d, 0x5f6f, 0x7661, 0x8e54, 0x5893, 0x7085, 0x8777, 0x9f6a, 
+     0x69a9, 0x809b, 0x988d, 0xb080, 0x79bf, 0x91b1, 0xa9a3, 0xc096, 
+     0x8ad5, 0xa2c7, 0xbab9, 0xd1ab, 0x9beb, 0xb3dd, 0xcacf, 0xe2c1, 
+     0x2056, 0x3848, 0x4f3b, 0x672d, 0x316c, 0x495e, 0x6051, 0x7843, 
+     0x4282, 0x5974, 0x7167, 0x8959, 0x5298, 0x6a8a, 0x827d, 0x996f, 
+     0x63ae, 0x7ba0, 0x9293, 0xaa85, 0x74c4, 0x8cb6, 0xa3a9, 0xbb9b, 
+     0x85da, 0x9ccc, 0xb4bf, 0xccb1, 0x95f0, 0xade2, 0xc5d5, 0xdcc7, 
+     0x1b5c, 0x324e, 0x4a40, 0x6232, 0x2b72, 0x4364, 0x5b56, 0x7248, 
+     0x3c88, 0x547a, 0x6b6c, 0x835e, 0x4d9d, 0x6590, 0x7c82, 0x9474, 
+     0x5eb3, 0x75a6, 0x8d98, 0xa58a, 0x6ec9, 0x86bc, 0x9eae, 0xb5a0, 
+     0x7fdf, 0x97d2, 0xafc4, 0xc6b6, 0x90f5, 0xa8e8, 0xbfda, 0xd7cc, 
+     0x1561, 0x2d53, 0x4445, 0x5c38, 0x2677, 0x3e69, 0x555b, 0x6d4e, 
+     0x378d, 0x4e7f, 0x6671, 0x7e64, 0x47a3, 0x5f95, 0x7787, 0x8e7a, 
+     0x58b9, 0x70ab, 0x889d, 0x9f90, 0x69cf, 0x81c1, 0x98b3, 0xb0a6, 
+     0x7ae5, 0x91d7, 0xa9c9, 0xc1bc, 0x8afb, 0xa2ed, 0xbadf, 0xd1d1 
+  }, { 
+     0x3c3c, 0x2b45, 0x1b4f, 0x0b59, 0x4e3b, 0x3e45, 0x2e4f, 0x1d59, 
+     0x613b, 0x5145, 0x414f, 0x3059, 0x743b, 0x6445, 0x534f, 0x4359, 
+     0x873b, 0x7745, 0x664f, 0x5659, 0x9a3b, 0x8945, 0x794f, 0x6959, 
+     0xad3b, 0x9c45, 0x8c4f, 0x7c59, 0xbf3b, 0xaf45, 0x9f4f, 0x8e59, 
+     0x454d, 0x3557, 0x2461, 0x146b, 0x584d, 0x4857, 0x3761, 0x276b, 
+     0x6b4d, 0x5a57, 0x4a61, 0x3a6a, 0x7e4d, 0x6d57, 0x5d60, 0x4d6a, 
+     0x904d, 0x8056, 0x7060, 0x606a, 0xa34d, 0x9356, 0x8360, 0x726a, 
+     0xb64c, 0xa656, 0x9560, 0x856a, 0xc94c, 0xb956, 0xa860, 0x986a, 
+     0x4f5e, 0x3e68, 0x2e72, 0x1e7c, 0x615e, 0x5168, 0x4172, 0x317c, 
+     0x745e, 0x6468, 0x5472, 0x437c, 0x875e, 0x7768, 0x6772, 0x567c, 
+     0x9a5e, 0x8a68, 0x7972, 0x697c, 0xad5e, 0x9d68, 0x8c72, 0x7c7c, 
+     0xc05e, 0xaf68, 0x9f72, 0x8f7c, 0xd35e, 0xc268, 0xb272, 0xa27b, 
+     0x586f, 0x4879, 0x3883, 0x278d, 0x6b6f, 0x5b79, 0x4a83, 0x3a8d, 
+     0x7e6f, 0x6e79, 0x5d83, 0x4d8d, 0x916f, 0x8079, 0x7083, 0x608d, 
+     0xa46f, 0x9379, 0x8383, 0x738d, 0xb66f, 0xa679, 0x9683, 0x868d, 
+     0xc96f, 0xb979, 0xa983, 0x988d, 0xdc6f, 0xcc79, 0xbb83, 0xab8d, 
+     0x6280, 0x528a, 0x4194, 0x319e, 0x7580, 0x648a, 0x5494, 0x449e, 
+     0x8780, 0x778a, 0x6794, 0x579e, 0x9a80, 0x8a8a, 0x7a94, 0x699e, 
+     0xad80, 0x9d8a, 0x8d94, 0x7c9e, 0xc080, 0xb08a, 0x9f94, 0x8f9e, 
+     0xd380, 0xc38a, 0xb294, 0xa29e, 0xe680, 0xd58a, 0xc594, 0xb59e, 
+     0x6b92, 0x5b9b, 0x4ba5, 0x3aaf, 0x7e91, 0x6e9b, 0x5ea5, 0x4daf, 
+     0x9191, 0x819b, 0x70a5, 0x60af, 0xa491, 0x949b, 0x83a5, 0x73af, 
+     0xb791, 0xa69b, 0x96a5, 0x86af, 0xca91, 0xb99b, 0xa9a5, 0x99af, 
+     0xdc91, 0xcc9b, 0xbca5, 0xacaf, 0xef91, 0xdf9b, 0xcfa5, 0xbeaf, 
+     0x75a3, 0x65ad, 0x54b7, 0x44c1, 0x88a3, 0x78ad, 0x67b7, 0x57c1, 
+     0x9ba3, 0x8aad, 0x7ab7, 0x6ac0, 0xada3, 0x9dad, 0x8db7, 0x7dc0, 
+     0xc0a3, 0xb0ad, 0xa0b6, 0x8fc0, 0xd3a3, 0xc3ac, 0xb3b6, 0xa2c0, 
+     0xe6a2, 0xd6ac, 0xc5b6, 0xb5c0, 0xf9a2, 0xe9ac, 0xd8b6, 0xc8c0, 
+     0x7fb4, 0x6ebe, 0x5ec8, 0x4ed2, 0x91b4, 0x81be, 0x71c8, 0x60d2, 
+     0xa4b4, 0x94be, 0x84c8, 0x73d2, 0xb7b4, 0xa7be, 0x96c8, 0x86d2, 
+     0xcab4, 0xbabe, 0xa9c8, 0x99d2, 0xddb4, 0xccbe, 0xbcc8, 0xacd2, 
+     0xf0b4, 0xdfbe, 0xcfc8, 0xbfd2, 0xffb4, 0xf2be, 0xe2c8, 0xd2d2 
+  }, { 
+     0x3c3c, 0x4c4e, 0x5c61, 0x6d74, 0x3c50, 0x4c63, 0x5d75, 0x6d88, 
+     0x3c64, 0x4c77, 0x5d8a, 0x6d9c, 0x3c78, 0x4d8b, 0x5d9e, 0x6eb1, 
+     0x3c8d, 0x4d9f, 0x5db2, 0x6ec5, 0x3da1, 0x4db4, 0x5ec7, 0x6ed9, 
+     0x3db5, 0x4dc8, 0x5edb, 0x6eee, 0x3dca, 0x4edc, 0x5eef, 0x6fff, 
+     0x4a35, 0x5a47, 0x6b5a, 0x7b6d, 0x4a49, 0x5a5c, 0x6b6e, 0x7b81, 
+     0x4a5d, 0x5b70, 0x6b83, 0x7c96, 0x4a71, 0x5b84, 0x6b97, 0x7caa, 
+     0x4b86, 0x5b99, 0x6cab, 0x7cbe, 0x4b9a, 0x5bad, 0x6cc0, 0x7cd2, 
+     0x4bae, 0x5cc1, 0x6cd4, 0x7ce7, 0x4bc3, 0x5cd5, 0x6ce8, 0x7dfb, 
+     0x582e, 0x6840, 0x7953, 0x8966, 0x5842, 0x6855, 0x7968, 0x897a, 
+     0x5856, 0x6969, 0x797c, 0x8a8f, 0x586b, 0x697d, 0x7990, 0x8aa3, 
+     0x597f, 0x6992, 0x7aa4, 0x8ab7, 0x5993, 0x69a6, 0x7ab9, 0x8acb, 
+     0x59a7, 0x6aba, 0x7acd, 0x8be0, 0x59bc, 0x6ace, 0x7ae1, 0x8bf4, 
+     0x6627, 0x763a, 0x874c, 0x975f, 0x663b, 0x774e, 0x8761, 0x9873, 
+     0x664f, 0x7762, 0x8775, 0x9888, 0x6764, 0x7776, 0x8889, 0x989c, 
+     0x6778, 0x778b, 0x889d, 0x98b0, 0x678c, 0x789f, 0x88b2, 0x99c5, 
+     0x67a0, 0x78b3, 0x88c6, 0x99d9, 0x67b5, 0x78c8, 0x88da, 0x99ed, 
+     0x7420, 0x8533, 0x9545, 0xa658, 0x7434, 0x8547, 0x955a, 0xa66d, 
+     0x7448, 0x855b, 0x956e, 0xa681, 0x755d, 0x8570, 0x9682, 0xa695, 
+     0x7571, 0x8584, 0x9697, 0xa6a9, 0x7585, 0x8698, 0x96ab, 0xa7be, 
+     0x759a, 0x86ac, 0x96bf, 0xa7d2, 0x76ae, 0x86c1, 0x97d3, 0xa7e6, 
+     0x8219, 0x932c, 0xa33f, 0xb451, 0x822d, 0x9340, 0xa353, 0xb466, 
+     0x8342, 0x9354, 0xa467, 0xb47a, 0x8356, 0x9369, 0xa47b, 0xb48e, 
+     0x836a, 0x947d, 0xa490, 0xb5a2, 0x837e, 0x9491, 0xa4a4, 0xb5b7, 
+     0x8493, 0x94a5, 0xa5b8, 0xb5cb, 0x84a7, 0x94ba, 0xa5cd, 0xb5df, 
+     0x9012, 0xa125, 0xb138, 0xc24a, 0x9126, 0xa139, 0xb14c, 0xc25f, 
+     0x913b, 0xa14d, 0xb260, 0xc273, 0x914f, 0xa162, 0xb274, 0xc287, 
+     0x9163, 0xa276, 0xb289, 0xc39c, 0x9177, 0xa28a, 0xb29d, 0xc3b0, 
+     0x928c, 0xa29f, 0xb3b1, 0xc3c4, 0x92a0, 0xa2b3, 0xb3c6, 0xc3d8, 
+     0x9e0b, 0xaf1e, 0xbf31, 0xd043, 0x9f1f, 0xaf32, 0xc045, 0xd058, 
+     0x9f34, 0xaf46, 0xc059, 0xd06c, 0x9f48, 0xb05b, 0xc06e, 0xd180, 
+     0x9f5c, 0xb06f, 0xc082, 0xd195, 0xa071, 0xb083, 0xc196, 0xd1a9, 
+     0xa085, 0xb098, 0xc1aa, 0xd1bd, 0xa099, 0xb1ac, 0xc1bf, 0xd2d1 
+  }, { 
+     0x3c3c, 0x482b, 0x551a, 0x6109, 0x534b, 0x5f3a, 0x6c29, 0x7818, 
+     0x6a5a, 0x7649, 0x8338, 0x8f27, 0x8169, 0x8d58, 0x9a47, 0xa637, 
+     0x9878, 0xa467, 0xb156, 0xbe46, 0xaf87, 0xbb76, 0xc866, 0xd555, 
+     0xc696, 0xd285, 0xdf75, 0xec64, 0xdda5, 0xea94, 0xf684, 0xff73, 
+     0x3449, 0x4138, 0x4e28, 0x5a17, 0x4c58, 0x5847, 0x6537, 0x7126, 
+     0x6367, 0x6f56, 0x7c46, 0x8835, 0x7a76, 0x8666, 0x9355, 0x9f44, 
+     0x9185, 0x9d75, 0xaa64, 0xb653, 0xa894, 0xb484, 0xc173, 0xce62, 
+     0xbfa4, 0xcb93, 0xd882, 0xe571, 0xd6b3, 0xe2a2, 0xef91, 0xfc80, 
+     0x2d57, 0x3a46, 0x4735, 0x5324, 0x4566, 0x5155, 0x5e44, 0x6a33, 
+     0x5c75, 0x6864, 0x7553, 0x8142, 0x7384, 0x7f73, 0x8c62, 0x9852, 
+     0x8a93, 0x9682, 0xa371, 0xaf61, 0xa1a2, 0xad91, 0xba81, 0xc770, 
+     0xb8b1, 0xc4a0, 0xd190, 0xde7f, 0xcfc0, 0xdbaf, 0xe89f, 0xf58e, 
+     0x2664, 0x3353, 0x4043, 0x4c32, 0x3d73, 0x4a62, 0x5752, 0x6341, 
+     0x5582, 0x6171, 0x6e61, 0x7a50, 0x6c91, 0x7881, 0x8570, 0x915f, 
+     0x83a0, 0x8f90, 0x9c7f, 0xa86e, 0x9aaf, 0xa69f, 0xb38e, 0xbf7d, 
+     0xb1bf, 0xbdae, 0xca9d, 0xd78c, 0xc8ce, 0xd4bd, 0xe1ac, 0xee9b, 
+     0x1f72, 0x2c61, 0x3950, 0x453f, 0x3681, 0x4370, 0x505f, 0x5c4e, 
+     0x4e90, 0x5a7f, 0x676e, 0x735e, 0x659f, 0x718e, 0x7e7d, 0x8a6d, 
+     0x7cae, 0x889d, 0x958c, 0xa17c, 0x93bd, 0x9fac, 0xac9c, 0xb88b, 
+     0xaacc, 0xb6bb, 0xc3ab, 0xd09a, 0xc1db, 0xcdca, 0xdaba, 0xe7a9, 
+     0x187f, 0x256e, 0x325e, 0x3e4d, 0x2f8e, 0x3c7d, 0x496d, 0x555c, 
+     0x469d, 0x538c, 0x607c, 0x6c6b, 0x5eac, 0x6a9c, 0x778b, 0x837a, 
+     0x75bb, 0x81ab, 0x8e9a, 0x9a89, 0x8ccb, 0x98ba, 0xa5a9, 0xb198, 
+     0xa3da, 0xafc9, 0xbcb8, 0xc8a7, 0xbae9, 0xc6d8, 0xd3c7, 0xe0b6, 
+     0x118d, 0x1e7c, 0x2b6b, 0x375a, 0x289c, 0x358b, 0x427a, 0x4e69, 
+     0x3fab, 0x4c9a, 0x5989, 0x6579, 0x57ba, 0x63a9, 0x7098, 0x7c88, 
+     0x6ec9, 0x7ab8, 0x87a7, 0x9397, 0x85d8, 0x91c7, 0x9eb7, 0xaaa6, 
+     0x9ce7, 0xa8d6, 0xb5c6, 0xc1b5, 0xb3f6, 0xbfe5, 0xccd5, 0xd9c4, 
+     0x0a9a, 0x1789, 0x2379, 0x3068, 0x21a9, 0x2e98, 0x3b88, 0x4777, 
+     0x38b8, 0x45a7, 0x5297, 0x5e86, 0x4fc7, 0x5cb7, 0x69a6, 0x7595, 
+     0x67d6, 0x73c6, 0x80b5, 0x8ca4, 0x7ee6, 0x8ad5, 0x97c4, 0xa3b3, 
+     0x95f5, 0xa1e4, 0xaed3, 0xbac2, 0xacff, 0xb8f3, 0xc5e2, 0xd1d2 
+  }, { 
+     0x3c3c, 0x2d51, 0x1e67, 0x0f7d, 0x473d, 0x3853, 0x2969, 0x1a7f, 
+     0x523f, 0x4355, 0x346b, 0x2581, 0x5d41, 0x4e57, 0x3f6d, 0x3083, 
+     0x6842, 0x5958, 0x4a6e, 0x3b84, 0x7344, 0x645a, 0x5570, 0x4686, 
+     0x7e46, 0x6f5c, 0x6072, 0x5188, 0x8948, 0x7a5d, 0x6b73, 0x5c89, 
+     0x4c46, 0x3d5c, 0x2e72, 0x1f88, 0x5748, 0x485d, 0x3973, 0x2a89, 
+     0x6249, 0x535f, 0x4475, 0x368b, 0x6e4b, 0x5f61, 0x5077, 0x418d, 
+     0x794d, 0x6a63, 0x5b79, 0x4c8f, 0x844e, 0x7564, 0x667a, 0x5790, 
+     0x8f50, 0x8066, 0x717c, 0x6292, 0x9a52, 0x8b68, 0x7c7e, 0x6d94, 
+     0x5d50, 0x4e66, 0x3f7c, 0x3092, 0x6852, 0x5968, 0x4a7e, 0x3b94, 
+     0x7354, 0x6469, 0x557f, 0x4695, 0x7e55, 0x6f6b, 0x6081, 0x5197, 
+     0x8957, 0x7a6d, 0x6b83, 0x5c99, 0x9559, 0x866f, 0x7785, 0x689b, 
+     0xa05a, 0x9170, 0x8286, 0x739c, 0xab5c, 0x9c72, 0x8d88, 0x7e9e, 
+     0x6e5a, 0x5f70, 0x5086, 0x419c, 0x795c, 0x6a72, 0x5b88, 0x4c9e, 
+     0x845e, 0x7574, 0x668a, 0x57a0, 0x8f60, 0x8076, 0x718b, 0x62a1, 
+     0x9a61, 0x8b77, 0x7c8d, 0x6da3, 0xa563, 0x9679, 0x878f, 0x78a5, 
+     0xb065, 0xa17b, 0x9291, 0x83a7, 0xbc66, 0xad7c, 0x9e92, 0x8fa8, 
+     0x7e65, 0x6f7b, 0x6091, 0x51a7, 0x8a66, 0x7b7c, 0x6c92, 0x5da8, 
+     0x9568, 0x867e, 0x7794, 0x68aa, 0xa06a, 0x9180, 0x8296, 0x73ac, 
+     0xab6c, 0x9c82, 0x8d97, 0x7ead, 0xb66d, 0xa783, 0x9899, 0x89af, 
+     0xc16f, 0xb285, 0xa39b, 0x94b1, 0xcc71, 0xbd87, 0xae9d, 0x9fb3, 
+     0x8f6f, 0x8085, 0x719b, 0x62b1, 0x9a71, 0x8b87, 0x7c9d, 0x6db3, 
+     0xa572, 0x9688, 0x879e, 0x78b4, 0xb174, 0xa28a, 0x93a0, 0x84b6, 
+     0xbc76, 0xad8c, 0x9ea2, 0x8fb8, 0xc778, 0xb88e, 0xa9a4, 0x9ab9, 
+     0xd279, 0xc38f, 0xb4a5, 0xa5bb, 0xdd7b, 0xce91, 0xbfa7, 0xb0bd, 
+     0xa079, 0x918f, 0x82a5, 0x73bb, 0xab7b, 0x9c91, 0x8da7, 0x7ebd, 
+     0xb67d, 0xa793, 0x98a9, 0x89bf, 0xc17e, 0xb294, 0xa3aa, 0x94c0, 
+     0xcc80, 0xbd96, 0xaeac, 0x9fc2, 0xd782, 0xc998, 0xbaae, 0xabc4, 
+     0xe384, 0xd49a, 0xc5b0, 0xb6c5, 0xee85, 0xdf9b, 0xd0b1, 0xc1c7, 
+     0xb184, 0xa29a, 0x93b0, 0x84c5, 0xbc85, 0xad9b, 0x9eb1, 0x8fc7, 
+     0xc787, 0xb89d, 0xa9b3, 0x9ac9, 0xd289, 0xc39f, 0xb4b5, 0xa5cb, 
+     0xdd8a, 0xcea0, 0xbfb6, 0xb0cc, 0xe88c, 0xd9a2, 0xcab8, 0xbbce, 
+     0xf38e, 0xe4a4, 0xd5ba, 0xc6d0, 0xfe90, 0xefa6, 0xe0bc, 0xd2d2 
+  }, { 
+     0x3c3c, 0x5541, 0x6f47, 0x894d, 0x4054, 0x5a5a, 0x7360, 0x8d65, 
+     0x446d, 0x5e73, 0x7879, 0x927e, 0x4886, 0x628c, 0x7c91, 0x9697, 
+     0x4d9f, 0x66a4, 0x80aa, 0x9ab0, 0x51b8, 0x6bbd, 0x84c3, 0x9ec9, 
+     0x55d0, 0x6fd6, 0x89dc, 0xa3e1, 0x59e9, 0x73ef, 0x8df5, 0xa7fa, 
+     0x4236, 0x5b3b, 0x7541, 0x8f47, 0x464e, 0x6054, 0x7a5a, 0x9360, 
+     0x4a67, 0x646d, 0x7e73, 0x9878, 0x4e80, 0x6886, 0x828c, 0x9c91, 
+     0x5399, 0x6c9f, 0x86a4, 0xa0aa, 0x57b2, 0x71b7, 0x8bbd, 0xa4c3, 
+     0x5bcb, 0x75d0, 0x8fd6, 0xa9dc, 0x5fe3, 0x79e9, 0x93ef, 0xadf4, 
+     0x4830, 0x6236, 0x7b3b, 0x9541, 0x4c49, 0x664e, 0x8054, 0x995a, 
+     0x5061, 0x6a67, 0x846d, 0x9e73, 0x547a, 0x6e80, 0x8886, 0xa28b, 
+     0x5993, 0x7399, 0x8c9e, 0xa6a4, 0x5dac, 0x77b2, 0x91b7, 0xabbd, 
+     0x61c5, 0x7bca, 0x95d0, 0xafd6, 0x66de, 0x7fe3, 0x99e9, 0xb3ef, 
+     0x4e2a, 0x6830, 0x8135, 0x9b3b, 0x5243, 0x6c49, 0x864e, 0xa054, 
+     0x565c, 0x7061, 0x8a67, 0xa46d, 0x5b74, 0x747a, 0x8e80, 0xa886, 
+     0x5f8d, 0x7993, 0x9399, 0xac9e, 0x63a6, 0x7dac, 0x97b1, 0xb1b7, 
+     0x67bf, 0x81c5, 0x9bca, 0xb5d0, 0x6cd8, 0x85dd, 0x9fe3, 0xb9e9, 
+     0x5424, 0x6e2a, 0x8830, 0xa135, 0x583d, 0x7243, 0x8c48, 0xa64e, 
+     0x5c56, 0x765c, 0x9061, 0xaa67, 0x616f, 0x7a74, 0x947a, 0xae80, 
+     0x6587, 0x7f8d, 0x9993, 0xb299, 0x69a0, 0x83a6, 0x9dac, 0xb7b1, 
+     0x6db9, 0x87bf, 0xa1c4, 0xbbca, 0x72d2, 0x8cd8, 0xa5dd, 0xbfe3, 
+     0x5a1e, 0x7424, 0x8e2a, 0xa72f, 0x5e37, 0x783d, 0x9243, 0xac48, 
+     0x6250, 0x7c56, 0x965b, 0xb061, 0x6769, 0x816f, 0x9a74, 0xb47a, 
+     0x6b82, 0x8587, 0x9f8d, 0xb993, 0x6f9a, 0x89a0, 0xa3a6, 0xbdac, 
+     0x74b3, 0x8db9, 0xa7bf, 0xc1c4, 0x78cc, 0x92d2, 0xabd7, 0xc5dd, 
+     0x6019, 0x7a1e, 0x9424, 0xae2a, 0x6431, 0x7e37, 0x983d, 0xb242, 
+     0x694a, 0x8250, 0x9c56, 0xb65b, 0x6d63, 0x8769, 0xa16e, 0xba74, 
+     0x717c, 0x8b81, 0xa587, 0xbf8d, 0x7595, 0x8f9a, 0xa9a0, 0xc3a6, 
+     0x7aad, 0x93b3, 0xadb9, 0xc7bf, 0x7ec6, 0x98cc, 0xb2d2, 0xcbd7, 
+     0x6613, 0x8018, 0x9a1e, 0xb424, 0x6a2c, 0x8431, 0x9e37, 0xb83d, 
+     0x6f44, 0x894a, 0xa250, 0xbc55, 0x735d, 0x8d63, 0xa769, 0xc06e, 
+     0x7776, 0x917c, 0xab81, 0xc587, 0x7b8f, 0x9594, 0xaf9a, 0xc9a0, 
+     0x80a8, 0x9aad, 0xb3b3, 0xcdb9, 0x84c0, 0x9ec6, 0xb8cc, 0xd2d1 
+  }, { 
+     0x3c3c, 0x3a30, 0x3925, 0x381a, 0x5543, 0x5438, 0x522c, 0x5121, 
+     0x6e4a, 0x6d3f, 0x6c34, 0x6b28, 0x8851, 0x8646, 0x853b, 0x8430, 
+     0xa159, 0xa04d, 0x9f42, 0x9d37, 0xba60, 0xb955, 0xb849, 0xb73e, 
+     0xd467, 0xd35c, 0xd151, 0xd046, 0xed6e, 0xec63, 0xeb58, 0xe94d, 
+     0x384e, 0x3743, 0x3638, 0x342d, 0x5156, 0x504b, 0x4f3f, 0x4e34, 
+     0x6b5d, 0x6a52, 0x6847, 0x673b, 0x8464, 0x8359, 0x824e, 0x8143, 
+     0x9e6c, 0x9c60, 0x9b55, 0x9a4a, 0xb773, 0xb668, 0xb55c, 0xb351, 
+     0xd07a, 0xcf6f, 0xce64, 0xcd58, 0xea81, 0xe876, 0xe76b, 0xe660, 
+     0x3561, 0x3356, 0x324b, 0x3140, 0x4e69, 0x4d5d, 0x4c52, 0x4a47, 
+     0x6770, 0x6665, 0x655a, 0x644e, 0x8177, 0x806c, 0x7e61, 0x7d56, 
+     0x9a7f, 0x9973, 0x9868, 0x975d, 0xb486, 0xb27b, 0xb16f, 0xb064, 
+     0xcd8d, 0xcc82, 0xca77, 0xc96b, 0xe694, 0xe589, 0xe47e, 0xe373, 
+     0x3174, 0x3069, 0x2f5e, 0x2e53, 0x4b7c, 0x4970, 0x4865, 0x475a, 
+     0x6483, 0x6378, 0x626c, 0x6061, 0x7d8a, 0x7c7f, 0x7b74, 0x7a69, 
+     0x9792, 0x9686, 0x947b, 0x9370, 0xb099, 0xaf8e, 0xae82, 0xac77, 
+     0xc9a0, 0xc895, 0xc78a, 0xc67e, 0xe3a7, 0xe29c, 0xe091, 0xdf86, 
+     0x2e87, 0x2d7c, 0x2b71, 0x2a66, 0x478f, 0x4683, 0x4578, 0x446d, 
+     0x6196, 0x5f8b, 0x5e7f, 0x5d74, 0x7a9d, 0x7992, 0x7787, 0x767b, 
+     0x93a4, 0x9299, 0x918e, 0x9083, 0xadac, 0xaba1, 0xaa95, 0xa98a, 
+     0xc6b3, 0xc5a8, 0xc49d, 0xc291, 0xdfba, 0xdeaf, 0xdda4, 0xdc99, 
+     0x2a9a, 0x298f, 0x2884, 0x2779, 0x44a2, 0x4396, 0x418b, 0x4080, 
+     0x5da9, 0x5c9e, 0x5b92, 0x5987, 0x76b0, 0x75a5, 0x749a, 0x738e, 
+     0x90b7, 0x8fac, 0x8da1, 0x8c96, 0xa9bf, 0xa8b3, 0xa7a8, 0xa69d, 
+     0xc3c6, 0xc1bb, 0xc0b0, 0xbfa4, 0xdccd, 0xdbc2, 0xdab7, 0xd8ac, 
+     0x27ad, 0x26a2, 0x2597, 0x238c, 0x40b5, 0x3fa9, 0x3e9e, 0x3d93, 
+     0x5abc, 0x58b1, 0x57a5, 0x569a, 0x73c3, 0x72b8, 0x71ad, 0x6fa1, 
+     0x8cca, 0x8bbf, 0x8ab4, 0x89a9, 0xa6d2, 0xa5c6, 0xa3bb, 0xa2b0, 
+     0xbfd9, 0xbece, 0xbdc2, 0xbcb7, 0xd9e0, 0xd7d5, 0xd6ca, 0xd5bf, 
+     0x24c0, 0x22b5, 0x21aa, 0x209f, 0x3dc7, 0x3cbc, 0x3ab1, 0x39a6, 
+     0x56cf, 0x55c4, 0x54b8, 0x53ad, 0x70d6, 0x6ecb, 0x6dc0, 0x6cb4, 
+     0x89dd, 0x88d2, 0x87c7, 0x85bc, 0xa2e5, 0xa1d9, 0xa0ce, 0x9fc3, 
+     0xbcec, 0xbbe1, 0xb9d5, 0xb8ca, 0xd5f3, 0xd4e8, 0xd3dd, 0xd1d2 
+  }, { 
+     0x3c3c, 0x3657, 0x3073, 0x2a8f, 0x3f43, 0x3a5f, 0x347b, 0x2e96, 
+     0x434b, 0x3e66, 0x3882, 0x329e, 0x4752, 0x426e, 0x3c8a, 0x36a6, 
+     0x4b5a, 0x4676, 0x4091, 0x3aad, 0x4f62, 0x4a7d, 0x4499, 0x3eb5, 
+     0x5369, 0x4e85, 0x48a1, 0x42bc, 0x5771, 0x518d, 0x4ca8, 0x46c4, 
+     0x4f3d, 0x4a59, 0x4475, 0x3e90, 0x5345, 0x4e61, 0x487c, 0x4298, 
+     0x574d, 0x5268, 0x4c84, 0x46a0, 0x5b54, 0x5670, 0x508c, 0x4aa7, 
+     0x5f5c, 0x5a78, 0x5493, 0x4eaf, 0x6364, 0x5d7f, 0x589b, 0x52b7, 
+     0x676b, 0x6187, 0x5ca3, 0x56be, 0x6b73, 0x658f, 0x60aa, 0x5ac6, 
+     0x633f, 0x5e5b, 0x5877, 0x5292, 0x6747, 0x6263, 0x5c7e, 0x569a, 
+     0x6b4f, 0x666a, 0x6086, 0x5aa2, 0x6f56, 0x6972, 0x648e, 0x5ea9, 
+     0x735e, 0x6d7a, 0x6895, 0x62b1, 0x7766, 0x7181, 0x6c9d, 0x66b9, 
+     0x7b6d, 0x7589, 0x70a5, 0x6ac0, 0x7f75, 0x7991, 0x74ac, 0x6ec8, 
+     0x7741, 0x725d, 0x6c79, 0x6694, 0x7b49, 0x7665, 0x7080, 0x6a9c, 
+     0x7f51, 0x796c, 0x7488, 0x6ea4, 0x8358, 0x7d74, 0x7890, 0x72ab, 
+     0x8760, 0x817c, 0x7c97, 0x76b3, 0x8b67, 0x8583, 0x809f, 0x7abb, 
+     0x8f6f, 0x898b, 0x84a6, 0x7ec2, 0x9377, 0x8d92, 0x88ae, 0x82ca, 
+     0x8b43, 0x855f, 0x807b, 0x7a96, 0x8f4b, 0x8967, 0x8482, 0x7e9e, 
+     0x9352, 0x8d6e, 0x888a, 0x82a6, 0x975a, 0x9176, 0x8c91, 0x86ad, 
+     0x9b62, 0x957d, 0x9099, 0x8ab5, 0x9f69, 0x9985, 0x94a1, 0x8ebc, 
+     0xa371, 0x9d8d, 0x97a8, 0x92c4, 0xa779, 0xa194, 0x9bb0, 0x96cc, 
+     0x9f45, 0x9961, 0x947c, 0x8e98, 0xa34d, 0x9d68, 0x9884, 0x92a0, 
+     0xa754, 0xa170, 0x9c8c, 0x96a7, 0xab5c, 0xa578, 0xa093, 0x9aaf, 
+     0xaf64, 0xa97f, 0xa49b, 0x9eb7, 0xb36b, 0xad87, 0xa7a3, 0xa2be, 
+     0xb773, 0xb18f, 0xabaa, 0xa6c6, 0xbb7b, 0xb596, 0xafb2, 0xaace, 
+     0xb347, 0xad63, 0xa87e, 0xa29a, 0xb74f, 0xb16a, 0xac86, 0xa6a2, 
+     0xbb56, 0xb572, 0xb08e, 0xaaa9, 0xbf5e, 0xb97a, 0xb395, 0xaeb1, 
+     0xc366, 0xbd81, 0xb79d, 0xb2b9, 0xc76d, 0xc189, 0xbba5, 0xb6c0, 
+     0xcb75, 0xc591, 0xbfac, 0xbac8, 0xcf7d, 0xc998, 0xc3b4, 0xbed0, 
+     0xc749, 0xc165, 0xbc80, 0xb69c, 0xcb51, 0xc56c, 0xbf88, 0xbaa4, 
+     0xcf58, 0xc974, 0xc390, 0xbeab, 0xd360, 0xcd7c, 0xc797, 0xc2b3, 
+     0xd767, 0xd183, 0xcb9f, 0xc6bb, 0xdb6f, 0xd58b, 0xcfa7, 0xcac2, 
+     0xdf77, 0xd992, 0xd3ae, 0xceca, 0xe37e, 0xdd9a, 0xd7b6, 0xd2d2 
   } 
 };
-const uint16_t cretab[36][256]={
+const uint16_t cretab[44][256]={
    { 
      0x3c3c, 0x573c, 0x723d, 0x8e3d, 0x473d, 0x623e, 0x7e3e, 0x993f, 
      0x533f, 0x6e3f, 0x8940, 0xa541, 0x5e40, 0x7941, 0x9541, 0xb042, 
@@ -1245,1159 +1509,1423 @@ const uint16_t cretab[36][256]={
      0x5dcb, 0x78cc, 0x94cc, 0xafcd, 0x68cc, 0x84cd, 0x9fce, 0xbace, 
      0x74ce, 0x8fcf, 0xabcf, 0xc6d0, 0x7fd0, 0x9bd0, 0xb6d1, 0xd2d2 
   }, { 
-     0x3c3c, 0x3634, 0x302d, 0x2a25, 0x3f54, 0x3a4d, 0x3445, 0x2e3e, 
-     0x436d, 0x3e65, 0x385e, 0x3256, 0x4786, 0x427e, 0x3c77, 0x366f, 
-     0x4b9e, 0x4697, 0x408f, 0x3a88, 0x4fb7, 0x4aaf, 0x44a8, 0x3ea1, 
-     0x53d0, 0x4ec8, 0x48c1, 0x42b9, 0x57e8, 0x51e1, 0x4cd9, 0x46d2, 
-     0x4f3b, 0x4a34, 0x442d, 0x3e25, 0x5354, 0x4e4d, 0x4845, 0x423e, 
-     0x576d, 0x5265, 0x4c5e, 0x4656, 0x5b86, 0x567e, 0x5077, 0x4a6f, 
-     0x5f9e, 0x5a97, 0x548f, 0x4e88, 0x63b7, 0x5daf, 0x58a8, 0x52a0, 
-     0x67d0, 0x61c8, 0x5cc1, 0x56b9, 0x6be8, 0x65e1, 0x60d9, 0x5ad2, 
-     0x633b, 0x5e34, 0x582c, 0x5225, 0x6754, 0x624d, 0x5c45, 0x563e, 
-     0x6b6d, 0x6665, 0x605e, 0x5a56, 0x6f85, 0x697e, 0x6477, 0x5e6f, 
-     0x739e, 0x6d97, 0x688f, 0x6288, 0x77b7, 0x71af, 0x6ca8, 0x66a0, 
-     0x7bd0, 0x75c8, 0x70c1, 0x6ab9, 0x7fe8, 0x79e1, 0x74d9, 0x6ed2, 
-     0x773b, 0x7234, 0x6c2c, 0x6625, 0x7b54, 0x764d, 0x7045, 0x6a3e, 
-     0x7f6d, 0x7965, 0x745e, 0x6e56, 0x8385, 0x7d7e, 0x7876, 0x726f, 
-     0x879e, 0x8197, 0x7c8f, 0x7688, 0x8bb7, 0x85af, 0x80a8, 0x7aa0, 
-     0x8fcf, 0x89c8, 0x84c1, 0x7eb9, 0x93e8, 0x8de1, 0x88d9, 0x82d2, 
-     0x8b3b, 0x8534, 0x802c, 0x7a25, 0x8f54, 0x894c, 0x8445, 0x7e3e, 
-     0x936d, 0x8d65, 0x885e, 0x8256, 0x9785, 0x917e, 0x8c76, 0x866f, 
-     0x9b9e, 0x9597, 0x908f, 0x8a88, 0x9fb7, 0x99af, 0x94a8, 0x8ea0, 
-     0xa3cf, 0x9dc8, 0x97c0, 0x92b9, 0xa7e8, 0xa1e1, 0x9bd9, 0x96d2, 
-     0x9f3b, 0x9934, 0x942c, 0x8e25, 0xa354, 0x9d4c, 0x9845, 0x923d, 
-     0xa76d, 0xa165, 0x9c5e, 0x9656, 0xab85, 0xa57e, 0xa076, 0x9a6f, 
-     0xaf9e, 0xa996, 0xa48f, 0x9e88, 0xb3b7, 0xadaf, 0xa7a8, 0xa2a0, 
-     0xb7cf, 0xb1c8, 0xabc0, 0xa6b9, 0xbbe8, 0xb5e1, 0xafd9, 0xaad2, 
-     0xb33b, 0xad34, 0xa82c, 0xa225, 0xb754, 0xb14c, 0xac45, 0xa63d, 
-     0xbb6d, 0xb565, 0xb05e, 0xaa56, 0xbf85, 0xb97e, 0xb376, 0xae6f, 
-     0xc39e, 0xbd96, 0xb78f, 0xb287, 0xc7b7, 0xc1af, 0xbba8, 0xb6a0, 
-     0xcbcf, 0xc5c8, 0xbfc0, 0xbab9, 0xcfe8, 0xc9e0, 0xc3d9, 0xbed2, 
-     0xc73b, 0xc134, 0xbc2c, 0xb625, 0xcb54, 0xc54c, 0xbf45, 0xba3d, 
-     0xcf6c, 0xc965, 0xc35e, 0xbe56, 0xd385, 0xcd7e, 0xc776, 0xc26f, 
-     0xd79e, 0xd196, 0xcb8f, 0xc687, 0xdbb7, 0xd5af, 0xcfa8, 0xcaa0, 
-     0xdfcf, 0xd9c8, 0xd3c0, 0xceb9, 0xe3e8, 0xdde0, 0xd7d9, 0xd2d1 
+     0x3c3c, 0x3634, 0x302d, 0x2a25, 0x3f54, 0x3a4d, 0x3445, 0x2e3e, 
+     0x436d, 0x3e65, 0x385e, 0x3256, 0x4786, 0x427e, 0x3c77, 0x366f, 
+     0x4b9e, 0x4697, 0x408f, 0x3a88, 0x4fb7, 0x4aaf, 0x44a8, 0x3ea1, 
+     0x53d0, 0x4ec8, 0x48c1, 0x42b9, 0x57e8, 0x51e1, 0x4cd9, 0x46d2, 
+     0x4f3b, 0x4a34, 0x442d, 0x3e25, 0x5354, 0x4e4d, 0x4845, 0x423e, 
+     0x576d, 0x5265, 0x4c5e, 0x4656, 0x5b86, 0x567e, 0x5077, 0x4a6f, 
+     0x5f9e, 0x5a97, 0x548f, 0x4e88, 0x63b7, 0x5daf, 0x58a8, 0x52a0, 
+     0x67d0, 0x61c8, 0x5cc1, 0x56b9, 0x6be8, 0x65e1, 0x60d9, 0x5ad2, 
+     0x633b, 0x5e34, 0x582c, 0x5225, 0x6754, 0x624d, 0x5c45, 0x563e, 
+     0x6b6d, 0x6665, 0x605e, 0x5a56, 0x6f85, 0x697e, 0x6477, 0x5e6f, 
+     0x739e, 0x6d97, 0x688f, 0x6288, 0x77b7, 0x71af, 0x6ca8, 0x66a0, 
+     0x7bd0, 0x75c8, 0x70c1, 0x6ab9, 0x7fe8, 0x79e1, 0x74d9, 0x6ed2, 
+     0x773b, 0x7234, 0x6c2c, 0x6625, 0x7b54, 0x764d, 0x7045, 0x6a3e, 
+     0x7f6d, 0x7965, 0x745e, 0x6e56, 0x8385, 0x7d7e, 0x7876, 0x726f, 
+     0x879e, 0x8197, 0x7c8f, 0x7688, 0x8bb7, 0x85af, 0x80a8, 0x7aa0, 
+     0x8fcf, 0x89c8, 0x84c1, 0x7eb9, 0x93e8, 0x8de1, 0x88d9, 0x82d2, 
+     0x8b3b, 0x8534, 0x802c, 0x7a25, 0x8f54, 0x894c, 0x8445, 0x7e3e, 
+     0x936d, 0x8d65, 0x885e, 0x8256, 0x9785, 0x917e, 0x8c76, 0x866f, 
+     0x9b9e, 0x9597, 0x908f, 0x8a88, 0x9fb7, 0x99af, 0x94a8, 0x8ea0, 
+     0xa3cf, 0x9dc8, 0x97c0, 0x92b9, 0xa7e8, 0xa1e1, 0x9bd9, 0x96d2, 
+     0x9f3b, 0x9934, 0x942c, 0x8e25, 0xa354, 0x9d4c, 0x9845, 0x923d, 
+     0xa76d, 0xa165, 0x9c5e, 0x9656, 0xab85, 0xa57e, 0xa076, 0x9a6f, 
+     0xaf9e, 0xa996, 0xa48f, 0x9e88, 0xb3b7, 0xadaf, 0xa7a8, 0xa2a0, 
+     0xb7cf, 0xb1c8, 0xabc0, 0xa6b9, 0xbbe8, 0xb5e1, 0xafd9, 0xaad2, 
+     0xb33b, 0xad34, 0xa82c, 0xa225, 0xb754, 0xb14c, 0xac45, 0xa63d, 
+     0xbb6d, 0xb565, 0xb05e, 0xaa56, 0xbf85, 0xb97e, 0xb376, 0xae6f, 
+     0xc39e, 0xbd96, 0xb78f, 0xb287, 0xc7b7, 0xc1af, 0xbba8, 0xb6a0, 
+     0xcbcf, 0xc5c8, 0xbfc0, 0xbab9, 0xcfe8, 0xc9e0, 0xc3d9, 0xbed2, 
+     0xc73b, 0xc134, 0xbc2c, 0xb625, 0xcb54, 0xc54c, 0xbf45, 0xba3d, 
+     0xcf6c, 0xc965, 0xc35e, 0xbe56, 0xd385, 0xcd7e, 0xc776, 0xc26f, 
+     0xd79e, 0xd196, 0xcb8f, 0xc687, 0xdbb7, 0xd5af, 0xcfa8, 0xcaa0, 
+     0xdfcf, 0xd9c8, 0xd3c0, 0xceb9, 0xe3e8, 0xdde0, 0xd7d9, 0xd2d1 
+  }, { 
+     0x3c3c, 0x3a57, 0x3973, 0x388f, 0x5543, 0x545f, 0x527b, 0x5196, 
+     0x6e4b, 0x6d66, 0x6c82, 0x6b9e, 0x8852, 0x866e, 0x858a, 0x84a6, 
+     0xa15a, 0xa076, 0x9f91, 0x9dad, 0xba62, 0xb97d, 0xb899, 0xb7b5, 
+     0xd469, 0xd385, 0xd1a1, 0xd0bc, 0xed71, 0xec8d, 0xeba8, 0xe9c4, 
+     0x383d, 0x3759, 0x3675, 0x3490, 0x5145, 0x5061, 0x4f7c, 0x4e98, 
+     0x6b4d, 0x6a68, 0x6884, 0x67a0, 0x8454, 0x8370, 0x828c, 0x81a7, 
+     0x9e5c, 0x9c78, 0x9b93, 0x9aaf, 0xb764, 0xb67f, 0xb59b, 0xb3b7, 
+     0xd06b, 0xcf87, 0xcea3, 0xcdbe, 0xea73, 0xe88f, 0xe7aa, 0xe6c6, 
+     0x353f, 0x335b, 0x3277, 0x3192, 0x4e47, 0x4d63, 0x4c7e, 0x4a9a, 
+     0x674f, 0x666a, 0x6586, 0x64a2, 0x8156, 0x8072, 0x7e8e, 0x7da9, 
+     0x9a5e, 0x997a, 0x9895, 0x97b1, 0xb466, 0xb281, 0xb19d, 0xb0b9, 
+     0xcd6d, 0xcc89, 0xcaa5, 0xc9c0, 0xe675, 0xe591, 0xe4ac, 0xe3c8, 
+     0x3141, 0x305d, 0x2f79, 0x2e94, 0x4b49, 0x4965, 0x4880, 0x479c, 
+     0x6451, 0x636c, 0x6288, 0x60a4, 0x7d58, 0x7c74, 0x7b90, 0x7aab, 
+     0x9760, 0x967c, 0x9497, 0x93b3, 0xb067, 0xaf83, 0xae9f, 0xacbb, 
+     0xc96f, 0xc88b, 0xc7a6, 0xc6c2, 0xe377, 0xe292, 0xe0ae, 0xdfca, 
+     0x2e43, 0x2d5f, 0x2b7b, 0x2a96, 0x474b, 0x4667, 0x4582, 0x449e, 
+     0x6152, 0x5f6e, 0x5e8a, 0x5da6, 0x7a5a, 0x7976, 0x7791, 0x76ad, 
+     0x9362, 0x927d, 0x9199, 0x90b5, 0xad69, 0xab85, 0xaaa1, 0xa9bc, 
+     0xc671, 0xc58d, 0xc4a8, 0xc2c4, 0xdf79, 0xde94, 0xddb0, 0xdccc, 
+     0x2a45, 0x2961, 0x287c, 0x2798, 0x444d, 0x4368, 0x4184, 0x40a0, 
+     0x5d54, 0x5c70, 0x5b8c, 0x59a7, 0x765c, 0x7578, 0x7493, 0x73af, 
+     0x9064, 0x8f7f, 0x8d9b, 0x8cb7, 0xa96b, 0xa887, 0xa7a3, 0xa6be, 
+     0xc373, 0xc18f, 0xc0aa, 0xbfc6, 0xdc7b, 0xdb96, 0xdab2, 0xd8ce, 
+     0x2747, 0x2663, 0x257e, 0x239a, 0x404f, 0x3f6a, 0x3e86, 0x3da2, 
+     0x5a56, 0x5872, 0x578e, 0x56a9, 0x735e, 0x727a, 0x7195, 0x6fb1, 
+     0x8c66, 0x8b81, 0x8a9d, 0x89b9, 0xa66d, 0xa589, 0xa3a5, 0xa2c0, 
+     0xbf75, 0xbe91, 0xbdac, 0xbcc8, 0xd97d, 0xd798, 0xd6b4, 0xd5d0, 
+     0x2449, 0x2265, 0x2180, 0x209c, 0x3d51, 0x3c6c, 0x3a88, 0x39a4, 
+     0x5658, 0x5574, 0x5490, 0x53ab, 0x7060, 0x6e7c, 0x6d97, 0x6cb3, 
+     0x8967, 0x8883, 0x879f, 0x85bb, 0xa26f, 0xa18b, 0xa0a7, 0x9fc2, 
+     0xbc77, 0xbb92, 0xb9ae, 0xb8ca, 0xd57e, 0xd49a, 0xd3b6, 0xd1d2 
+  }, { 
+     0x3c3c, 0x5530, 0x6f25, 0x891a, 0x4043, 0x5a38, 0x732c, 0x8d21, 
+     0x444a, 0x5e3f, 0x7834, 0x9228, 0x4851, 0x6246, 0x7c3b, 0x9630, 
+     0x4d59, 0x664d, 0x8042, 0x9a37, 0x5160, 0x6b55, 0x8449, 0x9e3e, 
+     0x5567, 0x6f5c, 0x8951, 0xa346, 0x596e, 0x7363, 0x8d58, 0xa74d, 
+     0x424e, 0x5b43, 0x7538, 0x8f2d, 0x4656, 0x604b, 0x7a3f, 0x9334, 
+     0x4a5d, 0x6452, 0x7e47, 0x983b, 0x4e64, 0x6859, 0x824e, 0x9c43, 
+     0x536c, 0x6c60, 0x8655, 0xa04a, 0x5773, 0x7168, 0x8b5c, 0xa451, 
+     0x5b7a, 0x756f, 0x8f64, 0xa958, 0x5f81, 0x7976, 0x936b, 0xad60, 
+     0x4861, 0x6256, 0x7b4b, 0x9540, 0x4c69, 0x665d, 0x8052, 0x9947, 
+     0x5070, 0x6a65, 0x845a, 0x9e4e, 0x5477, 0x6e6c, 0x8861, 0xa256, 
+     0x597f, 0x7373, 0x8c68, 0xa65d, 0x5d86, 0x777b, 0x916f, 0xab64, 
+     0x618d, 0x7b82, 0x9577, 0xaf6b, 0x6694, 0x7f89, 0x997e, 0xb373, 
+     0x4e74, 0x6869, 0x815e, 0x9b53, 0x527c, 0x6c70, 0x8665, 0xa05a, 
+     0x5683, 0x7078, 0x8a6c, 0xa461, 0x5b8a, 0x747f, 0x8e74, 0xa869, 
+     0x5f92, 0x7986, 0x937b, 0xac70, 0x6399, 0x7d8e, 0x9782, 0xb177, 
+     0x67a0, 0x8195, 0x9b8a, 0xb57e, 0x6ca7, 0x859c, 0x9f91, 0xb986, 
+     0x5487, 0x6e7c, 0x8871, 0xa166, 0x588f, 0x7283, 0x8c78, 0xa66d, 
+     0x5c96, 0x768b, 0x907f, 0xaa74, 0x619d, 0x7a92, 0x9487, 0xae7b, 
+     0x65a4, 0x7f99, 0x998e, 0xb283, 0x69ac, 0x83a1, 0x9d95, 0xb78a, 
+     0x6db3, 0x87a8, 0xa19d, 0xbb91, 0x72ba, 0x8caf, 0xa5a4, 0xbf99, 
+     0x5a9a, 0x748f, 0x8e84, 0xa779, 0x5ea2, 0x7896, 0x928b, 0xac80, 
+     0x62a9, 0x7c9e, 0x9692, 0xb087, 0x67b0, 0x81a5, 0x9a9a, 0xb48e, 
+     0x6bb7, 0x85ac, 0x9fa1, 0xb996, 0x6fbf, 0x89b3, 0xa3a8, 0xbd9d, 
+     0x74c6, 0x8dbb, 0xa7b0, 0xc1a4, 0x78cd, 0x92c2, 0xabb7, 0xc5ac, 
+     0x60ad, 0x7aa2, 0x9497, 0xae8c, 0x64b5, 0x7ea9, 0x989e, 0xb293, 
+     0x69bc, 0x82b1, 0x9ca5, 0xb69a, 0x6dc3, 0x87b8, 0xa1ad, 0xbaa1, 
+     0x71ca, 0x8bbf, 0xa5b4, 0xbfa9, 0x75d2, 0x8fc6, 0xa9bb, 0xc3b0, 
+     0x7ad9, 0x93ce, 0xadc2, 0xc7b7, 0x7ee0, 0x98d5, 0xb2ca, 0xcbbf, 
+     0x66c0, 0x80b5, 0x9aaa, 0xb49f, 0x6ac7, 0x84bc, 0x9eb1, 0xb8a6, 
+     0x6fcf, 0x89c4, 0xa2b8, 0xbcad, 0x73d6, 0x8dcb, 0xa7c0, 0xc0b4, 
+     0x77dd, 0x91d2, 0xabc7, 0xc5bc, 0x7be5, 0x95d9, 0xafce, 0xc9c3, 
+     0x80ec, 0x9ae1, 0xb3d5, 0xcdca, 0x84f3, 0x9ee8, 0xb8dd, 0xd2d2 
+  }, { 
+     0x3c3c, 0x2d41, 0x1e47, 0x0f4d, 0x4754, 0x385a, 0x2960, 0x1a65, 
+     0x526d, 0x4373, 0x3479, 0x257e, 0x5d86, 0x4e8c, 0x3f91, 0x3097, 
+     0x689f, 0x59a4, 0x4aaa, 0x3bb0, 0x73b8, 0x64bd, 0x55c3, 0x46c9, 
+     0x7ed0, 0x6fd6, 0x60dc, 0x51e1, 0x89e9, 0x7aef, 0x6bf5, 0x5cfa, 
+     0x4c36, 0x3d3b, 0x2e41, 0x1f47, 0x574e, 0x4854, 0x395a, 0x2a60, 
+     0x6267, 0x536d, 0x4473, 0x3678, 0x6e80, 0x5f86, 0x508c, 0x4191, 
+     0x7999, 0x6a9f, 0x5ba4, 0x4caa, 0x84b2, 0x75b7, 0x66bd, 0x57c3, 
+     0x8fcb, 0x80d0, 0x71d6, 0x62dc, 0x9ae3, 0x8be9, 0x7cef, 0x6df4, 
+     0x5d30, 0x4e36, 0x3f3b, 0x3041, 0x6849, 0x594e, 0x4a54, 0x3b5a, 
+     0x7361, 0x6467, 0x556d, 0x4673, 0x7e7a, 0x6f80, 0x6086, 0x518b, 
+     0x8993, 0x7a99, 0x6b9e, 0x5ca4, 0x95ac, 0x86b2, 0x77b7, 0x68bd, 
+     0xa0c5, 0x91ca, 0x82d0, 0x73d6, 0xabde, 0x9ce3, 0x8de9, 0x7eef, 
+     0x6e2a, 0x5f30, 0x5035, 0x413b, 0x7943, 0x6a49, 0x5b4e, 0x4c54, 
+     0x845c, 0x7561, 0x6667, 0x576d, 0x8f74, 0x807a, 0x7180, 0x6286, 
+     0x9a8d, 0x8b93, 0x7c99, 0x6d9e, 0xa5a6, 0x96ac, 0x87b1, 0x78b7, 
+     0xb0bf, 0xa1c5, 0x92ca, 0x83d0, 0xbcd8, 0xaddd, 0x9ee3, 0x8fe9, 
+     0x7e24, 0x6f2a, 0x6030, 0x5135, 0x8a3d, 0x7b43, 0x6c48, 0x5d4e, 
+     0x9556, 0x865c, 0x7761, 0x6867, 0xa06f, 0x9174, 0x827a, 0x7380, 
+     0xab87, 0x9c8d, 0x8d93, 0x7e99, 0xb6a0, 0xa7a6, 0x98ac, 0x89b1, 
+     0xc1b9, 0xb2bf, 0xa3c4, 0x94ca, 0xccd2, 0xbdd8, 0xaedd, 0x9fe3, 
+     0x8f1e, 0x8024, 0x712a, 0x622f, 0x9a37, 0x8b3d, 0x7c43, 0x6d48, 
+     0xa550, 0x9656, 0x875b, 0x7861, 0xb169, 0xa26f, 0x9374, 0x847a, 
+     0xbc82, 0xad87, 0x9e8d, 0x8f93, 0xc79a, 0xb8a0, 0xa9a6, 0x9aac, 
+     0xd2b3, 0xc3b9, 0xb4bf, 0xa5c4, 0xddcc, 0xced2, 0xbfd7, 0xb0dd, 
+     0xa019, 0x911e, 0x8224, 0x732a, 0xab31, 0x9c37, 0x8d3d, 0x7e42, 
+     0xb64a, 0xa750, 0x9856, 0x895b, 0xc163, 0xb269, 0xa36e, 0x9474, 
+     0xcc7c, 0xbd81, 0xae87, 0x9f8d, 0xd795, 0xc99a, 0xbaa0, 0xaba6, 
+     0xe3ad, 0xd4b3, 0xc5b9, 0xb6bf, 0xeec6, 0xdfcc, 0xd0d2, 0xc1d7, 
+     0xb113, 0xa218, 0x931e, 0x8424, 0xbc2c, 0xad31, 0x9e37, 0x8f3d, 
+     0xc744, 0xb84a, 0xa950, 0x9a55, 0xd25d, 0xc363, 0xb469, 0xa56e, 
+     0xdd76, 0xce7c, 0xbf81, 0xb087, 0xe88f, 0xd994, 0xca9a, 0xbba0, 
+     0xf3a8, 0xe4ad, 0xd5b3, 0xc6b9, 0xfec0, 0xefc6, 0xe0cc, 0xd2d1 
+  }, { 
+     0x3c3c, 0x4851, 0x5567, 0x617d, 0x533d, 0x5f53, 0x6c69, 0x787f, 
+     0x6a3f, 0x7655, 0x836b, 0x8f81, 0x8141, 0x8d57, 0x9a6d, 0xa683, 
+     0x9842, 0xa458, 0xb16e, 0xbe84, 0xaf44, 0xbb5a, 0xc870, 0xd586, 
+     0xc646, 0xd25c, 0xdf72, 0xec88, 0xdd48, 0xea5d, 0xf673, 0xff89, 
+     0x3446, 0x415c, 0x4e72, 0x5a88, 0x4c48, 0x585d, 0x6573, 0x7189, 
+     0x6349, 0x6f5f, 0x7c75, 0x888b, 0x7a4b, 0x8661, 0x9377, 0x9f8d, 
+     0x914d, 0x9d63, 0xaa79, 0xb68f, 0xa84e, 0xb464, 0xc17a, 0xce90, 
+     0xbf50, 0xcb66, 0xd87c, 0xe592, 0xd652, 0xe268, 0xef7e, 0xfc94, 
+     0x2d50, 0x3a66, 0x477c, 0x5392, 0x4552, 0x5168, 0x5e7e, 0x6a94, 
+     0x5c54, 0x6869, 0x757f, 0x8195, 0x7355, 0x7f6b, 0x8c81, 0x9897, 
+     0x8a57, 0x966d, 0xa383, 0xaf99, 0xa159, 0xad6f, 0xba85, 0xc79b, 
+     0xb85a, 0xc470, 0xd186, 0xde9c, 0xcf5c, 0xdb72, 0xe888, 0xf59e, 
+     0x265a, 0x3370, 0x4086, 0x4c9c, 0x3d5c, 0x4a72, 0x5788, 0x639e, 
+     0x555e, 0x6174, 0x6e8a, 0x7aa0, 0x6c60, 0x7876, 0x858b, 0x91a1, 
+     0x8361, 0x8f77, 0x9c8d, 0xa8a3, 0x9a63, 0xa679, 0xb38f, 0xbfa5, 
+     0xb165, 0xbd7b, 0xca91, 0xd7a7, 0xc866, 0xd47c, 0xe192, 0xeea8, 
+     0x1f65, 0x2c7b, 0x3991, 0x45a7, 0x3666, 0x437c, 0x5092, 0x5ca8, 
+     0x4e68, 0x5a7e, 0x6794, 0x73aa, 0x656a, 0x7180, 0x7e96, 0x8aac, 
+     0x7c6c, 0x8882, 0x9597, 0xa1ad, 0x936d, 0x9f83, 0xac99, 0xb8af, 
+     0xaa6f, 0xb685, 0xc39b, 0xd0b1, 0xc171, 0xcd87, 0xda9d, 0xe7b3, 
+     0x186f, 0x2585, 0x329b, 0x3eb1, 0x2f71, 0x3c87, 0x499d, 0x55b3, 
+     0x4672, 0x5388, 0x609e, 0x6cb4, 0x5e74, 0x6a8a, 0x77a0, 0x83b6, 
+     0x7576, 0x818c, 0x8ea2, 0x9ab8, 0x8c78, 0x988e, 0xa5a4, 0xb1b9, 
+     0xa379, 0xaf8f, 0xbca5, 0xc8bb, 0xba7b, 0xc691, 0xd3a7, 0xe0bd, 
+     0x1179, 0x1e8f, 0x2ba5, 0x37bb, 0x287b, 0x3591, 0x42a7, 0x4ebd, 
+     0x3f7d, 0x4c93, 0x59a9, 0x65bf, 0x577e, 0x6394, 0x70aa, 0x7cc0, 
+     0x6e80, 0x7a96, 0x87ac, 0x93c2, 0x8582, 0x9198, 0x9eae, 0xaac4, 
+     0x9c84, 0xa89a, 0xb5b0, 0xc1c5, 0xb385, 0xbf9b, 0xccb1, 0xd9c7, 
+     0x0a84, 0x179a, 0x23b0, 0x30c5, 0x2185, 0x2e9b, 0x3bb1, 0x47c7, 
+     0x3887, 0x459d, 0x52b3, 0x5ec9, 0x4f89, 0x5c9f, 0x69b5, 0x75cb, 
+     0x678a, 0x73a0, 0x80b6, 0x8ccc, 0x7e8c, 0x8aa2, 0x97b8, 0xa3ce, 
+     0x958e, 0xa1a4, 0xaeba, 0xbad0, 0xac90, 0xb8a6, 0xc5bc, 0xd1d2 
+  }, { 
+     0x3c3c, 0x4c2b, 0x5c1a, 0x6d09, 0x3c4b, 0x4c3a, 0x5d29, 0x6d18, 
+     0x3c5a, 0x4c49, 0x5d38, 0x6d27, 0x3c69, 0x4d58, 0x5d47, 0x6e37, 
+     0x3c78, 0x4d67, 0x5d56, 0x6e46, 0x3d87, 0x4d76, 0x5e66, 0x6e55, 
+     0x3d96, 0x4d85, 0x5e75, 0x6e64, 0x3da5, 0x4e94, 0x5e84, 0x6f73, 
+     0x4a49, 0x5a38, 0x6b28, 0x7b17, 0x4a58, 0x5a47, 0x6b37, 0x7b26, 
+     0x4a67, 0x5b56, 0x6b46, 0x7c35, 0x4a76, 0x5b66, 0x6b55, 0x7c44, 
+     0x4b85, 0x5b75, 0x6c64, 0x7c53, 0x4b94, 0x5b84, 0x6c73, 0x7c62, 
+     0x4ba4, 0x5c93, 0x6c82, 0x7c71, 0x4bb3, 0x5ca2, 0x6c91, 0x7d80, 
+     0x5857, 0x6846, 0x7935, 0x8924, 0x5866, 0x6855, 0x7944, 0x8933, 
+     0x5875, 0x6964, 0x7953, 0x8a42, 0x5884, 0x6973, 0x7962, 0x8a52, 
+     0x5993, 0x6982, 0x7a71, 0x8a61, 0x59a2, 0x6991, 0x7a81, 0x8a70, 
+     0x59b1, 0x6aa0, 0x7a90, 0x8b7f, 0x59c0, 0x6aaf, 0x7a9f, 0x8b8e, 
+     0x6664, 0x7653, 0x8743, 0x9732, 0x6673, 0x7762, 0x8752, 0x9841, 
+     0x6682, 0x7771, 0x8761, 0x9850, 0x6791, 0x7781, 0x8870, 0x985f, 
+     0x67a0, 0x7790, 0x887f, 0x986e, 0x67af, 0x789f, 0x888e, 0x997d, 
+     0x67bf, 0x78ae, 0x889d, 0x998c, 0x67ce, 0x78bd, 0x88ac, 0x999b, 
+     0x7472, 0x8561, 0x9550, 0xa63f, 0x7481, 0x8570, 0x955f, 0xa64e, 
+     0x7490, 0x857f, 0x956e, 0xa65e, 0x759f, 0x858e, 0x967d, 0xa66d, 
+     0x75ae, 0x859d, 0x968c, 0xa67c, 0x75bd, 0x86ac, 0x969c, 0xa78b, 
+     0x75cc, 0x86bb, 0x96ab, 0xa79a, 0x76db, 0x86ca, 0x97ba, 0xa7a9, 
+     0x827f, 0x936e, 0xa35e, 0xb44d, 0x828e, 0x937d, 0xa36d, 0xb45c, 
+     0x839d, 0x938c, 0xa47c, 0xb46b, 0x83ac, 0x939c, 0xa48b, 0xb47a, 
+     0x83bb, 0x94ab, 0xa49a, 0xb589, 0x83cb, 0x94ba, 0xa4a9, 0xb598, 
+     0x84da, 0x94c9, 0xa5b8, 0xb5a7, 0x84e9, 0x94d8, 0xa5c7, 0xb5b6, 
+     0x908d, 0xa17c, 0xb16b, 0xc25a, 0x919c, 0xa18b, 0xb17a, 0xc269, 
+     0x91ab, 0xa19a, 0xb289, 0xc279, 0x91ba, 0xa1a9, 0xb298, 0xc288, 
+     0x91c9, 0xa2b8, 0xb2a7, 0xc397, 0x91d8, 0xa2c7, 0xb2b7, 0xc3a6, 
+     0x92e7, 0xa2d6, 0xb3c6, 0xc3b5, 0x92f6, 0xa2e5, 0xb3d5, 0xc3c4, 
+     0x9e9a, 0xaf89, 0xbf79, 0xd068, 0x9fa9, 0xaf98, 0xc088, 0xd077, 
+     0x9fb8, 0xafa7, 0xc097, 0xd086, 0x9fc7, 0xb0b7, 0xc0a6, 0xd195, 
+     0x9fd6, 0xb0c6, 0xc0b5, 0xd1a4, 0xa0e6, 0xb0d5, 0xc1c4, 0xd1b3, 
+     0xa0f5, 0xb0e4, 0xc1d3, 0xd1c2, 0xa0ff, 0xb1f3, 0xc1e2, 0xd2d2 
+  }, { 
+     0x3c3c, 0x2b4e, 0x1b61, 0x0b74, 0x4e50, 0x3e63, 0x2e75, 0x1d88, 
+     0x6164, 0x5177, 0x418a, 0x309c, 0x7478, 0x648b, 0x539e, 0x43b1, 
+     0x878d, 0x779f, 0x66b2, 0x56c5, 0x9aa1, 0x89b4, 0x79c7, 0x69d9, 
+     0xadb5, 0x9cc8, 0x8cdb, 0x7cee, 0xbfca, 0xafdc, 0x9fef, 0x8eff, 
+     0x4535, 0x3547, 0x245a, 0x146d, 0x5849, 0x485c, 0x376e, 0x2781, 
+     0x6b5d, 0x5a70, 0x4a83, 0x3a96, 0x7e71, 0x6d84, 0x5d97, 0x4daa, 
+     0x9086, 0x8099, 0x70ab, 0x60be, 0xa39a, 0x93ad, 0x83c0, 0x72d2, 
+     0xb6ae, 0xa6c1, 0x95d4, 0x85e7, 0xc9c3, 0xb9d5, 0xa8e8, 0x98fb, 
+     0x4f2e, 0x3e40, 0x2e53, 0x1e66, 0x6142, 0x5155, 0x4168, 0x317a, 
+     0x7456, 0x6469, 0x547c, 0x438f, 0x876b, 0x777d, 0x6790, 0x56a3, 
+     0x9a7f, 0x8a92, 0x79a4, 0x69b7, 0xad93, 0x9da6, 0x8cb9, 0x7ccb, 
+     0xc0a7, 0xafba, 0x9fcd, 0x8fe0, 0xd3bc, 0xc2ce, 0xb2e1, 0xa2f4, 
+     0x5827, 0x483a, 0x384c, 0x275f, 0x6b3b, 0x5b4e, 0x4a61, 0x3a73, 
+     0x7e4f, 0x6e62, 0x5d75, 0x4d88, 0x9164, 0x8076, 0x7089, 0x609c, 
+     0xa478, 0x938b, 0x839d, 0x73b0, 0xb68c, 0xa69f, 0x96b2, 0x86c5, 
+     0xc9a0, 0xb9b3, 0xa9c6, 0x98d9, 0xdcb5, 0xccc8, 0xbbda, 0xabed, 
+     0x6220, 0x5233, 0x4145, 0x3158, 0x7534, 0x6447, 0x545a, 0x446d, 
+     0x8748, 0x775b, 0x676e, 0x5781, 0x9a5d, 0x8a70, 0x7a82, 0x6995, 
+     0xad71, 0x9d84, 0x8d97, 0x7ca9, 0xc085, 0xb098, 0x9fab, 0x8fbe, 
+     0xd39a, 0xc3ac, 0xb2bf, 0xa2d2, 0xe6ae, 0xd5c1, 0xc5d3, 0xb5e6, 
+     0x6b19, 0x5b2c, 0x4b3f, 0x3a51, 0x7e2d, 0x6e40, 0x5e53, 0x4d66, 
+     0x9142, 0x8154, 0x7067, 0x607a, 0xa456, 0x9469, 0x837b, 0x738e, 
+     0xb76a, 0xa67d, 0x9690, 0x86a2, 0xca7e, 0xb991, 0xa9a4, 0x99b7, 
+     0xdc93, 0xcca5, 0xbcb8, 0xaccb, 0xefa7, 0xdfba, 0xcfcd, 0xbedf, 
+     0x7512, 0x6525, 0x5438, 0x444a, 0x8826, 0x7839, 0x674c, 0x575f, 
+     0x9b3b, 0x8a4d, 0x7a60, 0x6a73, 0xad4f, 0x9d62, 0x8d74, 0x7d87, 
+     0xc063, 0xb076, 0xa089, 0x8f9c, 0xd377, 0xc38a, 0xb39d, 0xa2b0, 
+     0xe68c, 0xd69f, 0xc5b1, 0xb5c4, 0xf9a0, 0xe9b3, 0xd8c6, 0xc8d8, 
+     0x7f0b, 0x6e1e, 0x5e31, 0x4e43, 0x911f, 0x8132, 0x7145, 0x6058, 
+     0xa434, 0x9446, 0x8459, 0x736c, 0xb748, 0xa75b, 0x966e, 0x8680, 
+     0xca5c, 0xba6f, 0xa982, 0x9995, 0xdd71, 0xcc83, 0xbc96, 0xaca9, 
+     0xf085, 0xdf98, 0xcfaa, 0xbfbd, 0xff99, 0xf2ac, 0xe2bf, 0xd2d1 
+  }, { 
+     0x3c3c, 0x5345, 0x6b4f, 0x8359, 0x4c3b, 0x6445, 0x7c4f, 0x9359, 
+     0x5d3b, 0x7545, 0x8c4f, 0xa459, 0x6e3b, 0x8545, 0x9d4f, 0xb559, 
+     0x7f3b, 0x9645, 0xae4f, 0xc659, 0x8f3b, 0xa745, 0xbf4f, 0xd659, 
+     0xa03b, 0xb845, 0xcf4f, 0xe759, 0xb13b, 0xc945, 0xe04f, 0xf859, 
+     0x364d, 0x4e57, 0x6561, 0x7d6b, 0x474d, 0x5e57, 0x7661, 0x8e6b, 
+     0x584d, 0x6f57, 0x8761, 0x9f6a, 0x684d, 0x8057, 0x9860, 0xaf6a, 
+     0x794d, 0x9156, 0xa860, 0xc06a, 0x8a4d, 0xa256, 0xb960, 0xd16a, 
+     0x9b4c, 0xb256, 0xca60, 0xe26a, 0xab4c, 0xc356, 0xdb60, 0xf26a, 
+     0x315e, 0x4868, 0x6072, 0x787c, 0x415e, 0x5968, 0x7172, 0x887c, 
+     0x525e, 0x6a68, 0x8172, 0x997c, 0x635e, 0x7b68, 0x9272, 0xaa7c, 
+     0x745e, 0x8b68, 0xa372, 0xbb7c, 0x845e, 0x9c68, 0xb472, 0xcb7c, 
+     0x955e, 0xad68, 0xc472, 0xdc7c, 0xa65e, 0xbe68, 0xd572, 0xed7b, 
+     0x2b6f, 0x4379, 0x5a83, 0x728d, 0x3c6f, 0x5379, 0x6b83, 0x838d, 
+     0x4d6f, 0x6479, 0x7c83, 0x948d, 0x5d6f, 0x7579, 0x8d83, 0xa48d, 
+     0x6e6f, 0x8679, 0x9d83, 0xb58d, 0x7f6f, 0x9779, 0xae83, 0xc68d, 
+     0x906f, 0xa779, 0xbf83, 0xd78d, 0xa06f, 0xb879, 0xd083, 0xe78d, 
+     0x2680, 0x3d8a, 0x5594, 0x6d9e, 0x3680, 0x4e8a, 0x6694, 0x7d9e, 
+     0x4780, 0x5f8a, 0x7694, 0x8e9e, 0x5880, 0x708a, 0x8794, 0x9f9e, 
+     0x6980, 0x808a, 0x9894, 0xb09e, 0x7980, 0x918a, 0xa994, 0xc09e, 
+     0x8a80, 0xa28a, 0xba94, 0xd19e, 0x9b80, 0xb38a, 0xca94, 0xe29e, 
+     0x2092, 0x389b, 0x4fa5, 0x67af, 0x3191, 0x499b, 0x60a5, 0x78af, 
+     0x4291, 0x599b, 0x71a5, 0x89af, 0x5291, 0x6a9b, 0x82a5, 0x99af, 
+     0x6391, 0x7b9b, 0x92a5, 0xaaaf, 0x7491, 0x8c9b, 0xa3a5, 0xbbaf, 
+     0x8591, 0x9c9b, 0xb4a5, 0xccaf, 0x9591, 0xad9b, 0xc5a5, 0xdcaf, 
+     0x1ba3, 0x32ad, 0x4ab7, 0x62c1, 0x2ba3, 0x43ad, 0x5bb7, 0x72c1, 
+     0x3ca3, 0x54ad, 0x6bb7, 0x83c0, 0x4da3, 0x65ad, 0x7cb7, 0x94c0, 
+     0x5ea3, 0x75ad, 0x8db6, 0xa5c0, 0x6ea3, 0x86ac, 0x9eb6, 0xb5c0, 
+     0x7fa2, 0x97ac, 0xafb6, 0xc6c0, 0x90a2, 0xa8ac, 0xbfb6, 0xd7c0, 
+     0x15b4, 0x2dbe, 0x44c8, 0x5cd2, 0x26b4, 0x3ebe, 0x55c8, 0x6dd2, 
+     0x37b4, 0x4ebe, 0x66c8, 0x7ed2, 0x47b4, 0x5fbe, 0x77c8, 0x8ed2, 
+     0x58b4, 0x70be, 0x88c8, 0x9fd2, 0x69b4, 0x81be, 0x98c8, 0xb0d2, 
+     0x7ab4, 0x91be, 0xa9c8, 0xc1d2, 0x8ab4, 0xa2be, 0xbac8, 0xd1d2 
   }, { 
-     0x3c3c, 0x3a57, 0x3973, 0x388f, 0x5543, 0x545f, 0x527b, 0x5196, 
-     0x6e4b, 0x6d66, 0x6c82, 0x6b9e, 0x8852, 0x866e, 0x858a, 0x84a6, 
-     0xa15a, 0xa076, 0x9f91, 0x9dad, 0xba62, 0xb97d, 0xb899, 0xb7b5, 
-     0xd469, 0xd385, 0xd1a1, 0xd0bc, 0xed71, 0xec8d, 0xeba8, 0xe9c4, 
-     0x383d, 0x3759, 0x3675, 0x3490, 0x5145, 0x5061, 0x4f7c, 0x4e98, 
-     0x6b4d, 0x6a68, 0x6884, 0x67a0, 0x8454, 0x8370, 0x828c, 0x81a7, 
-     0x9e5c, 0x9c78, 0x9b93, 0x9aaf, 0xb764, 0xb67f, 0xb59b, 0xb3b7, 
-     0xd06b, 0xcf87, 0xcea3, 0xcdbe, 0xea73, 0xe88f, 0xe7aa, 0xe6c6, 
-     0x353f, 0x335b, 0x3277, 0x3192, 0x4e47, 0x4d63, 0x4c7e, 0x4a9a, 
-     0x674f, 0x666a, 0x6586, 0x64a2, 0x8156, 0x8072, 0x7e8e, 0x7da9, 
-     0x9a5e, 0x997a, 0x9895, 0x97b1, 0xb466, 0xb281, 0xb19d, 0xb0b9, 
-     0xcd6d, 0xcc89, 0xcaa5, 0xc9c0, 0xe675, 0xe591, 0xe4ac, 0xe3c8, 
-     0x3141, 0x305d, 0x2f79, 0x2e94, 0x4b49, 0x4965, 0x4880, 0x479c, 
-     0x6451, 0x636c, 0x6288, 0x60a4, 0x7d58, 0x7c74, 0x7b90, 0x7aab, 
-     0x9760, 0x967c, 0x9497, 0x93b3, 0xb067, 0xaf83, 0xae9f, 0xacbb, 
-     0xc96f, 0xc88b, 0xc7a6, 0xc6c2, 0xe377, 0xe292, 0xe0ae, 0xdfca, 
-     0x2e43, 0x2d5f, 0x2b7b, 0x2a96, 0x474b, 0x4667, 0x4582, 0x449e, 
-     0x6152, 0x5f6e, 0x5e8a, 0x5da6, 0x7a5a, 0x7976, 0x7791, 0x76ad, 
-     0x9362, 0x927d, 0x9199, 0x90b5, 0xad69, 0xab85, 0xaaa1, 0xa9bc, 
-     0xc671, 0xc58d, 0xc4a8, 0xc2c4, 0xdf79, 0xde94, 0xddb0, 0xdccc, 
-     0x2a45, 0x2961, 0x287c, 0x2798, 0x444d, 0x4368, 0x4184, 0x40a0, 
-     0x5d54, 0x5c70, 0x5b8c, 0x59a7, 0x765c, 0x7578, 0x7493, 0x73af, 
-     0x9064, 0x8f7f, 0x8d9b, 0x8cb7, 0xa96b, 0xa887, 0xa7a3, 0xa6be, 
-     0xc373, 0xc18f, 0xc0aa, 0xbfc6, 0xdc7b, 0xdb96, 0xdab2, 0xd8ce, 
-     0x2747, 0x2663, 0x257e, 0x239a, 0x404f, 0x3f6a, 0x3e86, 0x3da2, 
-     0x5a56, 0x5872, 0x578e, 0x56a9, 0x735e, 0x727a, 0x7195, 0x6fb1, 
-     0x8c66, 0x8b81, 0x8a9d, 0x89b9, 0xa66d, 0xa589, 0xa3a5, 0xa2c0, 
-     0xbf75, 0xbe91, 0xbdac, 0xbcc8, 0xd97d, 0xd798, 0xd6b4, 0xd5d0, 
-     0x2449, 0x2265, 0x2180, 0x209c, 0x3d51, 0x3c6c, 0x3a88, 0x39a4, 
-     0x5658, 0x5574, 0x5490, 0x53ab, 0x7060, 0x6e7c, 0x6d97, 0x6cb3, 
-     0x8967, 0x8883, 0x879f, 0x85bb, 0xa26f, 0xa18b, 0xa0a7, 0x9fc2, 
-     0xbc77, 0xbb92, 0xb9ae, 0xb8ca, 0xd57e, 0xd49a, 0xd3b6, 0xd1d2 
+     0x3c3c, 0x3e2e, 0x4120, 0x4412, 0x3c51, 0x3f44, 0x4236, 0x4528, 
+     0x3d67, 0x405a, 0x434c, 0x463e, 0x3e7d, 0x4170, 0x4462, 0x4754, 
+     0x3f93, 0x4286, 0x4578, 0x486a, 0x40a9, 0x439c, 0x468e, 0x4980, 
+     0x41bf, 0x44b2, 0x47a4, 0x4a96, 0x42d5, 0x45c8, 0x48ba, 0x4bac, 
+     0x4f41, 0x5233, 0x5525, 0x5818, 0x5057, 0x5349, 0x563b, 0x592e, 
+     0x516d, 0x545f, 0x5751, 0x5944, 0x5283, 0x5475, 0x5767, 0x5a5a, 
+     0x5299, 0x558b, 0x587d, 0x5b70, 0x53af, 0x56a1, 0x5993, 0x5c85, 
+     0x54c5, 0x57b7, 0x5aa9, 0x5d9b, 0x55db, 0x58cd, 0x5bbf, 0x5eb1, 
+     0x6246, 0x6538, 0x682b, 0x6b1d, 0x635c, 0x664e, 0x6941, 0x6c33, 
+     0x6472, 0x6764, 0x6a57, 0x6d49, 0x6588, 0x687a, 0x6b6d, 0x6e5f, 
+     0x669e, 0x6990, 0x6c83, 0x6f75, 0x67b4, 0x6aa6, 0x6d99, 0x708b, 
+     0x68ca, 0x6bbc, 0x6daf, 0x70a1, 0x68e0, 0x6bd2, 0x6ec5, 0x71b7, 
+     0x754c, 0x783e, 0x7b30, 0x7e22, 0x7662, 0x7954, 0x7c46, 0x7f38, 
+     0x7777, 0x7a6a, 0x7d5c, 0x804e, 0x788d, 0x7b80, 0x7e72, 0x8164, 
+     0x79a3, 0x7c96, 0x7f88, 0x827a, 0x7ab9, 0x7dac, 0x809e, 0x8390, 
+     0x7bcf, 0x7ec2, 0x81b4, 0x84a6, 0x7ce5, 0x7fd8, 0x82ca, 0x85bc, 
+     0x8851, 0x8b43, 0x8e35, 0x9128, 0x8967, 0x8c59, 0x8f4b, 0x923e, 
+     0x8a7d, 0x8d6f, 0x9061, 0x9354, 0x8b93, 0x8e85, 0x9177, 0x946a, 
+     0x8ca9, 0x8f9b, 0x928d, 0x9580, 0x8dbf, 0x90b1, 0x93a3, 0x9696, 
+     0x8ed5, 0x91c7, 0x94b9, 0x97ab, 0x8feb, 0x92dd, 0x95cf, 0x98c1, 
+     0x9c56, 0x9f48, 0xa23b, 0xa52d, 0x9d6c, 0xa05e, 0xa251, 0xa543, 
+     0x9d82, 0xa074, 0xa367, 0xa659, 0x9e98, 0xa18a, 0xa47d, 0xa76f, 
+     0x9fae, 0xa2a0, 0xa593, 0xa885, 0xa0c4, 0xa3b6, 0xa6a9, 0xa99b, 
+     0xa1da, 0xa4cc, 0xa7bf, 0xaab1, 0xa2f0, 0xa5e2, 0xa8d5, 0xabc7, 
+     0xaf5c, 0xb24e, 0xb540, 0xb832, 0xb072, 0xb364, 0xb656, 0xb948, 
+     0xb188, 0xb47a, 0xb76c, 0xba5e, 0xb29d, 0xb590, 0xb882, 0xbb74, 
+     0xb3b3, 0xb6a6, 0xb998, 0xbb8a, 0xb4c9, 0xb6bc, 0xb9ae, 0xbca0, 
+     0xb4df, 0xb7d2, 0xbac4, 0xbdb6, 0xb5f5, 0xb8e8, 0xbbda, 0xbecc, 
+     0xc261, 0xc553, 0xc845, 0xcb38, 0xc377, 0xc669, 0xc95b, 0xcc4e, 
+     0xc48d, 0xc77f, 0xca71, 0xcd64, 0xc5a3, 0xc895, 0xcb87, 0xce7a, 
+     0xc6b9, 0xc9ab, 0xcc9d, 0xcf90, 0xc7cf, 0xcac1, 0xcdb3, 0xd0a6, 
+     0xc8e5, 0xcbd7, 0xcec9, 0xd1bc, 0xc9fb, 0xcced, 0xcfdf, 0xd2d1 
   }, { 
-     0x3c3c, 0x5530, 0x6f25, 0x891a, 0x4043, 0x5a38, 0x732c, 0x8d21, 
-     0x444a, 0x5e3f, 0x7834, 0x9228, 0x4851, 0x6246, 0x7c3b, 0x9630, 
-     0x4d59, 0x664d, 0x8042, 0x9a37, 0x5160, 0x6b55, 0x8449, 0x9e3e, 
-     0x5567, 0x6f5c, 0x8951, 0xa346, 0x596e, 0x7363, 0x8d58, 0xa74d, 
-     0x424e, 0x5b43, 0x7538, 0x8f2d, 0x4656, 0x604b, 0x7a3f, 0x9334, 
-     0x4a5d, 0x6452, 0x7e47, 0x983b, 0x4e64, 0x6859, 0x824e, 0x9c43, 
-     0x536c, 0x6c60, 0x8655, 0xa04a, 0x5773, 0x7168, 0x8b5c, 0xa451, 
-     0x5b7a, 0x756f, 0x8f64, 0xa958, 0x5f81, 0x7976, 0x936b, 0xad60, 
-     0x4861, 0x6256, 0x7b4b, 0x9540, 0x4c69, 0x665d, 0x8052, 0x9947, 
-     0x5070, 0x6a65, 0x845a, 0x9e4e, 0x5477, 0x6e6c, 0x8861, 0xa256, 
-     0x597f, 0x7373, 0x8c68, 0xa65d, 0x5d86, 0x777b, 0x916f, 0xab64, 
-     0x618d, 0x7b82, 0x9577, 0xaf6b, 0x6694, 0x7f89, 0x997e, 0xb373, 
-     0x4e74, 0x6869, 0x815e, 0x9b53, 0x527c, 0x6c70, 0x8665, 0xa05a, 
-     0x5683, 0x7078, 0x8a6c, 0xa461, 0x5b8a, 0x747f, 0x8e74, 0xa869, 
-     0x5f92, 0x7986, 0x937b, 0xac70, 0x6399, 0x7d8e, 0x9782, 0xb177, 
-     0x67a0, 0x8195, 0x9b8a, 0xb57e, 0x6ca7, 0x859c, 0x9f91, 0xb986, 
-     0x5487, 0x6e7c, 0x8871, 0xa166, 0x588f, 0x7283, 0x8c78, 0xa66d, 
-     0x5c96, 0x768b, 0x907f, 0xaa74, 0x619d, 0x7a92, 0x9487, 0xae7b, 
-     0x65a4, 0x7f99, 0x998e, 0xb283, 0x69ac, 0x83a1, 0x9d95, 0xb78a, 
-     0x6db3, 0x87a8, 0xa19d, 0xbb91, 0x72ba, 0x8caf, 0xa5a4, 0xbf99, 
-     0x5a9a, 0x748f, 0x8e84, 0xa779, 0x5ea2, 0x7896, 0x928b, 0xac80, 
-     0x62a9, 0x7c9e, 0x9692, 0xb087, 0x67b0, 0x81a5, 0x9a9a, 0xb48e, 
-     0x6bb7, 0x85ac, 0x9fa1, 0xb996, 0x6fbf, 0x89b3, 0xa3a8, 0xbd9d, 
-     0x74c6, 0x8dbb, 0xa7b0, 0xc1a4, 0x78cd, 0x92c2, 0xabb7, 0xc5ac, 
-     0x60ad, 0x7aa2, 0x9497, 0xae8c, 0x64b5, 0x7ea9, 0x989e, 0xb293, 
-     0x69bc, 0x82b1, 0x9ca5, 0xb69a, 0x6dc3, 0x87b8, 0xa1ad, 0xbaa1, 
-     0x71ca, 0x8bbf, 0xa5b4, 0xbfa9, 0x75d2, 0x8fc6, 0xa9bb, 0xc3b0, 
-     0x7ad9, 0x93ce, 0xadc2, 0xc7b7, 0x7ee0, 0x98d5, 0xb2ca, 0xcbbf, 
-     0x66c0, 0x80b5, 0x9aaa, 0xb49f, 0x6ac7, 0x84bc, 0x9eb1, 0xb8a6, 
-     0x6fcf, 0x89c4, 0xa2b8, 0xbcad, 0x73d6, 0x8dcb, 0xa7c0, 0xc0b4, 
-     0x77dd, 0x91d2, 0xabc7, 0xc5bc, 0x7be5, 0x95d9, 0xafce, 0xc9c3, 
-     0x80ec, 0x9ae1, 0xb3d5, 0xcdca, 0x84f3, 0x9ee8, 0xb8dd, 0xd2d2 
+     0x3c3c, 0x3256, 0x2971, 0x208c, 0x5448, 0x4a63, 0x417e, 0x3899, 
+     0x6c55, 0x6370, 0x598b, 0x50a6, 0x8462, 0x7b7d, 0x7198, 0x68b2, 
+     0x9c6f, 0x938a, 0x8aa4, 0x80bf, 0xb47c, 0xab97, 0xa2b1, 0x99cc, 
+     0xcd89, 0xc3a3, 0xbabe, 0xb1d9, 0xe595, 0xdcb0, 0xd2cb, 0xc9e6, 
+     0x3d39, 0x3353, 0x2a6e, 0x2189, 0x5545, 0x4c60, 0x427b, 0x3996, 
+     0x6d52, 0x646d, 0x5b88, 0x51a3, 0x855f, 0x7c7a, 0x7395, 0x69b0, 
+     0x9d6c, 0x9487, 0x8ba2, 0x82bc, 0xb679, 0xac94, 0xa3ae, 0x9ac9, 
+     0xce86, 0xc5a0, 0xbbbb, 0xb2d6, 0xe692, 0xddad, 0xd3c8, 0xcae3, 
+     0x3e36, 0x3551, 0x2b6b, 0x2286, 0x5643, 0x4d5d, 0x4478, 0x3a93, 
+     0x6e4f, 0x656a, 0x5c85, 0x52a0, 0x875c, 0x7d77, 0x7492, 0x6bad, 
+     0x9f69, 0x9584, 0x8c9f, 0x83b9, 0xb776, 0xae91, 0xa4ac, 0x9bc6, 
+     0xcf83, 0xc69e, 0xbdb8, 0xb3d3, 0xe790, 0xdeaa, 0xd5c5, 0xcbe0, 
+     0x3f33, 0x364e, 0x2d68, 0x2383, 0x5740, 0x4e5a, 0x4575, 0x3b90, 
+     0x704c, 0x6667, 0x5d82, 0x549d, 0x8859, 0x7e74, 0x758f, 0x6caa, 
+     0xa066, 0x9781, 0x8d9c, 0x84b7, 0xb873, 0xaf8e, 0xa6a9, 0x9cc3, 
+     0xd080, 0xc79b, 0xbeb5, 0xb4d0, 0xe98d, 0xdfa7, 0xd6c2, 0xcddd, 
+     0x4030, 0x374b, 0x2e66, 0x2480, 0x593d, 0x4f58, 0x4672, 0x3d8d, 
+     0x714a, 0x6764, 0x5e7f, 0x559a, 0x8956, 0x8071, 0x768c, 0x6da7, 
+     0xa163, 0x987e, 0x8f99, 0x85b4, 0xb970, 0xb08b, 0xa7a6, 0x9dc1, 
+     0xd27d, 0xc898, 0xbfb3, 0xb6cd, 0xea8a, 0xe0a5, 0xd7bf, 0xceda, 
+     0x422d, 0x3848, 0x2f63, 0x267d, 0x5a3a, 0x5055, 0x476f, 0x3e8a, 
+     0x7247, 0x6961, 0x5f7c, 0x5697, 0x8a54, 0x816e, 0x7889, 0x6ea4, 
+     0xa260, 0x997b, 0x9096, 0x86b1, 0xbb6d, 0xb188, 0xa8a3, 0x9fbe, 
+     0xd37a, 0xc995, 0xc0b0, 0xb7ca, 0xeb87, 0xe2a2, 0xd8bc, 0xcfd7, 
+     0x432a, 0x3a45, 0x3060, 0x277b, 0x5b37, 0x5252, 0x486d, 0x3f87, 
+     0x7344, 0x6a5f, 0x6179, 0x5794, 0x8b51, 0x826b, 0x7986, 0x70a1, 
+     0xa45d, 0x9a78, 0x9193, 0x88ae, 0xbc6a, 0xb285, 0xa9a0, 0xa0bb, 
+     0xd477, 0xcb92, 0xc1ad, 0xb8c8, 0xec84, 0xe39f, 0xdaba, 0xd0d4, 
+     0x4427, 0x3b42, 0x315d, 0x2878, 0x5c34, 0x534f, 0x4a6a, 0x4084, 
+     0x7441, 0x6b5c, 0x6276, 0x5991, 0x8d4e, 0x8369, 0x7a83, 0x719e, 
+     0xa55b, 0x9c75, 0x9290, 0x89ab, 0xbd67, 0xb482, 0xaa9d, 0xa1b8, 
+     0xd574, 0xcc8f, 0xc3aa, 0xb9c5, 0xed81, 0xe49c, 0xdbb7, 0xd1d2 
+  }, { 
+     0x3c3c, 0x5738, 0x7334, 0x8f30, 0x443f, 0x603b, 0x7c37, 0x9833, 
+     0x4d42, 0x693e, 0x853a, 0xa136, 0x5645, 0x7241, 0x8e3d, 0xaa39, 
+     0x5f48, 0x7b44, 0x9740, 0xb33c, 0x684b, 0x8447, 0xa043, 0xbb3f, 
+     0x714e, 0x8d4a, 0xa946, 0xc442, 0x7a51, 0x964d, 0xb149, 0xcd46, 
+     0x3c4f, 0x584c, 0x7448, 0x9044, 0x4553, 0x614f, 0x7d4b, 0x9947, 
+     0x4e56, 0x6a52, 0x864e, 0xa14a, 0x5759, 0x7355, 0x8e51, 0xaa4d, 
+     0x605c, 0x7c58, 0x9754, 0xb350, 0x695f, 0x845b, 0xa057, 0xbc53, 
+     0x7162, 0x8d5e, 0xa95a, 0xc556, 0x7a65, 0x9661, 0xb25d, 0xce5a, 
+     0x3d63, 0x5960, 0x745c, 0x9058, 0x4667, 0x6163, 0x7d5f, 0x995b, 
+     0x4e6a, 0x6a66, 0x8662, 0xa25e, 0x576d, 0x7369, 0x8f65, 0xab61, 
+     0x6070, 0x7c6c, 0x9868, 0xb464, 0x6973, 0x856f, 0xa16b, 0xbd67, 
+     0x7276, 0x8e72, 0xaa6e, 0xc66a, 0x7b79, 0x9775, 0xb371, 0xce6e, 
+     0x3d77, 0x5974, 0x7570, 0x916c, 0x467b, 0x6277, 0x7e73, 0x9a6f, 
+     0x4f7e, 0x6b7a, 0x8776, 0xa372, 0x5881, 0x747d, 0x9079, 0xac75, 
+     0x6184, 0x7d80, 0x997c, 0xb478, 0x6a87, 0x8683, 0xa17f, 0xbd7b, 
+     0x738a, 0x8f86, 0xaa82, 0xc67e, 0x7c8d, 0x9789, 0xb385, 0xcf82, 
+     0x3e8b, 0x5a88, 0x7684, 0x9180, 0x478f, 0x638b, 0x7e87, 0x9a83, 
+     0x5092, 0x6c8e, 0x878a, 0xa386, 0x5995, 0x7491, 0x908d, 0xac89, 
+     0x6198, 0x7d94, 0x9990, 0xb58c, 0x6a9b, 0x8697, 0xa293, 0xbe8f, 
+     0x739e, 0x8f9a, 0xab96, 0xc792, 0x7ca1, 0x989d, 0xb499, 0xd096, 
+     0x3f9f, 0x5a9c, 0x7698, 0x9294, 0x47a3, 0x639f, 0x7f9b, 0x9b97, 
+     0x50a6, 0x6ca2, 0x889e, 0xa49a, 0x59a9, 0x75a5, 0x91a1, 0xad9d, 
+     0x62ac, 0x7ea8, 0x9aa4, 0xb6a0, 0x6baf, 0x87ab, 0xa3a7, 0xbfa3, 
+     0x74b2, 0x90ae, 0xacaa, 0xc7a6, 0x7db5, 0x99b1, 0xb4ad, 0xd0aa, 
+     0x3fb3, 0x5bb0, 0x77ac, 0x93a8, 0x48b7, 0x64b3, 0x80af, 0x9cab, 
+     0x51ba, 0x6db6, 0x89b2, 0xa4ae, 0x5abd, 0x76b9, 0x91b5, 0xadb1, 
+     0x63c0, 0x7fbc, 0x9ab8, 0xb6b4, 0x6cc3, 0x87bf, 0xa3bb, 0xbfb7, 
+     0x74c6, 0x90c2, 0xacbe, 0xc8ba, 0x7dc9, 0x99c5, 0xb5c1, 0xd1be, 
+     0x40c7, 0x5cc4, 0x77c0, 0x93bc, 0x49cb, 0x64c7, 0x80c3, 0x9cbf, 
+     0x52ce, 0x6dca, 0x89c6, 0xa5c2, 0x5ad1, 0x76cd, 0x92c9, 0xaec5, 
+     0x63d4, 0x7fd0, 0x9bcc, 0xb7c8, 0x6cd7, 0x88d3, 0xa4cf, 0xc0cb, 
+     0x75da, 0x91d6, 0xadd2, 0xc9ce, 0x7edd, 0x9ad9, 0xb6d5, 0xd2d2 
   }, { 
-     0x3c3c, 0x2d41, 0x1e47, 0x0f4d, 0x4754, 0x385a, 0x2960, 0x1a65, 
-     0x526d, 0x4373, 0x3479, 0x257e, 0x5d86, 0x4e8c, 0x3f91, 0x3097, 
-     0x689f, 0x59a4, 0x4aaa, 0x3bb0, 0x73b8, 0x64bd, 0x55c3, 0x46c9, 
-     0x7ed0, 0x6fd6, 0x60dc, 0x51e1, 0x89e9, 0x7aef, 0x6bf5, 0x5cfa, 
-     0x4c36, 0x3d3b, 0x2e41, 0x1f47, 0x574e, 0x4854, 0x395a, 0x2a60, 
-     0x6267, 0x536d, 0x4473, 0x3678, 0x6e80, 0x5f86, 0x508c, 0x4191, 
-     0x7999, 0x6a9f, 0x5ba4, 0x4caa, 0x84b2, 0x75b7, 0x66bd, 0x57c3, 
-     0x8fcb, 0x80d0, 0x71d6, 0x62dc, 0x9ae3, 0x8be9, 0x7cef, 0x6df4, 
-     0x5d30, 0x4e36, 0x3f3b, 0x3041, 0x6849, 0x594e, 0x4a54, 0x3b5a, 
-     0x7361, 0x6467, 0x556d, 0x4673, 0x7e7a, 0x6f80, 0x6086, 0x518b, 
-     0x8993, 0x7a99, 0x6b9e, 0x5ca4, 0x95ac, 0x86b2, 0x77b7, 0x68bd, 
-     0xa0c5, 0x91ca, 0x82d0, 0x73d6, 0xabde, 0x9ce3, 0x8de9, 0x7eef, 
-     0x6e2a, 0x5f30, 0x5035, 0x413b, 0x7943, 0x6a49, 0x5b4e, 0x4c54, 
-     0x845c, 0x7561, 0x6667, 0x576d, 0x8f74, 0x807a, 0x7180, 0x6286, 
-     0x9a8d, 0x8b93, 0x7c99, 0x6d9e, 0xa5a6, 0x96ac, 0x87b1, 0x78b7, 
-     0xb0bf, 0xa1c5, 0x92ca, 0x83d0, 0xbcd8, 0xaddd, 0x9ee3, 0x8fe9, 
-     0x7e24, 0x6f2a, 0x6030, 0x5135, 0x8a3d, 0x7b43, 0x6c48, 0x5d4e, 
-     0x9556, 0x865c, 0x7761, 0x6867, 0xa06f, 0x9174, 0x827a, 0x7380, 
-     0xab87, 0x9c8d, 0x8d93, 0x7e99, 0xb6a0, 0xa7a6, 0x98ac, 0x89b1, 
-     0xc1b9, 0xb2bf, 0xa3c4, 0x94ca, 0xccd2, 0xbdd8, 0xaedd, 0x9fe3, 
-     0x8f1e, 0x8024, 0x712a, 0x622f, 0x9a37, 0x8b3d, 0x7c43, 0x6d48, 
-     0xa550, 0x9656, 0x875b, 0x7861, 0xb169, 0xa26f, 0x9374, 0x847a, 
-     0xbc82, 0xad87, 0x9e8d, 0x8f93, 0xc79a, 0xb8a0, 0xa9a6, 0x9aac, 
-     0xd2b3, 0xc3b9, 0xb4bf, 0xa5c4, 0xddcc, 0xced2, 0xbfd7, 0xb0dd, 
-     0xa019, 0x911e, 0x8224, 0x732a, 0xab31, 0x9c37, 0x8d3d, 0x7e42, 
-     0xb64a, 0xa750, 0x9856, 0x895b, 0xc163, 0xb269, 0xa36e, 0x9474, 
-     0xcc7c, 0xbd81, 0xae87, 0x9f8d, 0xd795, 0xc99a, 0xbaa0, 0xaba6, 
-     0xe3ad, 0xd4b3, 0xc5b9, 0xb6bf, 0xeec6, 0xdfcc, 0xd0d2, 0xc1d7, 
-     0xb113, 0xa218, 0x931e, 0x8424, 0xbc2c, 0xad31, 0x9e37, 0x8f3d, 
-     0xc744, 0xb84a, 0xa950, 0x9a55, 0xd25d, 0xc363, 0xb469, 0xa56e, 
-     0xdd76, 0xce7c, 0xbf81, 0xb087, 0xe88f, 0xd994, 0xca9a, 0xbba0, 
-     0xf3a8, 0xe4ad, 0xd5b3, 0xc6b9, 0xfec0, 0xefc6, 0xe0cc, 0xd2d1 
+     0x3c3c, 0x3238, 0x2835, 0x1f31, 0x4255, 0x3851, 0x2e4e, 0x254b, 
+     0x486e, 0x3e6b, 0x3567, 0x2b64, 0x4e87, 0x4484, 0x3b81, 0x317d, 
+     0x54a1, 0x4a9d, 0x419a, 0x3796, 0x5aba, 0x50b7, 0x47b3, 0x3db0, 
+     0x60d3, 0x57d0, 0x4dcc, 0x43c9, 0x66ec, 0x5de9, 0x53e6, 0x49e2, 
+     0x4f39, 0x4536, 0x3c32, 0x322f, 0x5552, 0x4b4f, 0x424c, 0x3848, 
+     0x5b6c, 0x5268, 0x4865, 0x3e61, 0x6185, 0x5882, 0x4e7e, 0x447b, 
+     0x679e, 0x5e9b, 0x5497, 0x4b94, 0x6db8, 0x64b4, 0x5ab1, 0x51ad, 
+     0x74d1, 0x6acd, 0x60ca, 0x57c7, 0x7aea, 0x70e7, 0x66e3, 0x5de0, 
+     0x6237, 0x5933, 0x4f30, 0x462c, 0x6850, 0x5f4d, 0x5549, 0x4c46, 
+     0x6f69, 0x6566, 0x5b62, 0x525f, 0x7583, 0x6b7f, 0x617c, 0x5878, 
+     0x7b9c, 0x7198, 0x6895, 0x5e92, 0x81b5, 0x77b2, 0x6eae, 0x64ab, 
+     0x87ce, 0x7dcb, 0x74c8, 0x6ac4, 0x8de8, 0x84e4, 0x7ae1, 0x70dd, 
+     0x7634, 0x6c31, 0x632e, 0x592a, 0x7c4e, 0x724a, 0x6947, 0x5f43, 
+     0x8267, 0x7863, 0x6f60, 0x655d, 0x8880, 0x7f7d, 0x7579, 0x6b76, 
+     0x8e99, 0x8596, 0x7b93, 0x718f, 0x94b3, 0x8baf, 0x81ac, 0x78a9, 
+     0x9acc, 0x91c9, 0x87c5, 0x7ec2, 0xa1e5, 0x97e2, 0x8dde, 0x84db, 
+     0x8932, 0x802f, 0x762b, 0x6c28, 0x8f4b, 0x8648, 0x7c44, 0x7341, 
+     0x9564, 0x8c61, 0x825e, 0x795a, 0x9c7e, 0x927a, 0x8877, 0x7f74, 
+     0xa297, 0x9894, 0x8e90, 0x858d, 0xa8b0, 0x9ead, 0x95aa, 0x8ba6, 
+     0xaeca, 0xa4c6, 0x9bc3, 0x91bf, 0xb4e3, 0xaadf, 0xa1dc, 0x97d9, 
+     0x9d30, 0x932c, 0x8929, 0x8025, 0xa349, 0x9945, 0x9042, 0x863f, 
+     0xa962, 0x9f5f, 0x965b, 0x8c58, 0xaf7b, 0xa578, 0x9c75, 0x9271, 
+     0xb595, 0xac91, 0xa28e, 0x988a, 0xbbae, 0xb2ab, 0xa8a7, 0x9ea4, 
+     0xc1c7, 0xb8c4, 0xaec0, 0xa5bd, 0xc7e1, 0xbedd, 0xb4da, 0xabd6, 
+     0xb02d, 0xa72a, 0x9d26, 0x9323, 0xb646, 0xad43, 0xa340, 0x993c, 
+     0xbc60, 0xb35c, 0xa959, 0xa055, 0xc279, 0xb976, 0xaf72, 0xa66f, 
+     0xc992, 0xbf8f, 0xb58b, 0xac88, 0xcfac, 0xc5a8, 0xbba5, 0xb2a1, 
+     0xd5c5, 0xcbc1, 0xc2be, 0xb8bb, 0xdbde, 0xd1db, 0xc8d7, 0xbed4, 
+     0xc42b, 0xba27, 0xb024, 0xa721, 0xca44, 0xc041, 0xb63d, 0xad3a, 
+     0xd05d, 0xc65a, 0xbd56, 0xb353, 0xd677, 0xcc73, 0xc370, 0xb96c, 
+     0xdc90, 0xd28c, 0xc989, 0xbf86, 0xe2a9, 0xd8a6, 0xcfa2, 0xc59f, 
+     0xe8c2, 0xdfbf, 0xd5bc, 0xcbb8, 0xeedc, 0xe5d8, 0xdbd5, 0xd2d1 
   }, { 
-     0x3c3c, 0x4851, 0x5567, 0x617d, 0x533d, 0x5f53, 0x6c69, 0x787f, 
-     0x6a3f, 0x7655, 0x836b, 0x8f81, 0x8141, 0x8d57, 0x9a6d, 0xa683, 
-     0x9842, 0xa458, 0xb16e, 0xbe84, 0xaf44, 0xbb5a, 0xc870, 0xd586, 
-     0xc646, 0xd25c, 0xdf72, 0xec88, 0xdd48, 0xea5d, 0xf673, 0xff89, 
-     0x3446, 0x415c, 0x4e72, 0x5a88, 0x4c48, 0x585d, 0x6573, 0x7189, 
-     0x6349, 0x6f5f, 0x7c75, 0x888b, 0x7a4b, 0x8661, 0x9377, 0x9f8d, 
-     0x914d, 0x9d63, 0xaa79, 0xb68f, 0xa84e, 0xb464, 0xc17a, 0xce90, 
-     0xbf50, 0xcb66, 0xd87c, 0xe592, 0xd652, 0xe268, 0xef7e, 0xfc94, 
-     0x2d50, 0x3a66, 0x477c, 0x5392, 0x4552, 0x5168, 0x5e7e, 0x6a94, 
-     0x5c54, 0x6869, 0x757f, 0x8195, 0x7355, 0x7f6b, 0x8c81, 0x9897, 
-     0x8a57, 0x966d, 0xa383, 0xaf99, 0xa159, 0xad6f, 0xba85, 0xc79b, 
-     0xb85a, 0xc470, 0xd186, 0xde9c, 0xcf5c, 0xdb72, 0xe888, 0xf59e, 
-     0x265a, 0x3370, 0x4086, 0x4c9c, 0x3d5c, 0x4a72, 0x5788, 0x639e, 
-     0x555e, 0x6174, 0x6e8a, 0x7aa0, 0x6c60, 0x7876, 0x858b, 0x91a1, 
-     0x8361, 0x8f77, 0x9c8d, 0xa8a3, 0x9a63, 0xa679, 0xb38f, 0xbfa5, 
-     0xb165, 0xbd7b, 0xca91, 0xd7a7, 0xc866, 0xd47c, 0xe192, 0xeea8, 
-     0x1f65, 0x2c7b, 0x3991, 0x45a7, 0x3666, 0x437c, 0x5092, 0x5ca8, 
-     0x4e68, 0x5a7e, 0x6794, 0x73aa, 0x656a, 0x7180, 0x7e96, 0x8aac, 
-     0x7c6c, 0x8882, 0x9597, 0xa1ad, 0x936d, 0x9f83, 0xac99, 0xb8af, 
-     0xaa6f, 0xb685, 0xc39b, 0xd0b1, 0xc171, 0xcd87, 0xda9d, 0xe7b3, 
-     0x186f, 0x2585, 0x329b, 0x3eb1, 0x2f71, 0x3c87, 0x499d, 0x55b3, 
-     0x4672, 0x5388, 0x609e, 0x6cb4, 0x5e74, 0x6a8a, 0x77a0, 0x83b6, 
-     0x7576, 0x818c, 0x8ea2, 0x9ab8, 0x8c78, 0x988e, 0xa5a4, 0xb1b9, 
-     0xa379, 0xaf8f, 0xbca5, 0xc8bb, 0xba7b, 0xc691, 0xd3a7, 0xe0bd, 
-     0x1179, 0x1e8f, 0x2ba5, 0x37bb, 0x287b, 0x3591, 0x42a7, 0x4ebd, 
-     0x3f7d, 0x4c93, 0x59a9, 0x65bf, 0x577e, 0x6394, 0x70aa, 0x7cc0, 
-     0x6e80, 0x7a96, 0x87ac, 0x93c2, 0x8582, 0x9198, 0x9eae, 0xaac4, 
-     0x9c84, 0xa89a, 0xb5b0, 0xc1c5, 0xb385, 0xbf9b, 0xccb1, 0xd9c7, 
-     0x0a84, 0x179a, 0x23b0, 0x30c5, 0x2185, 0x2e9b, 0x3bb1, 0x47c7, 
-     0x3887, 0x459d, 0x52b3, 0x5ec9, 0x4f89, 0x5c9f, 0x69b5, 0x75cb, 
-     0x678a, 0x73a0, 0x80b6, 0x8ccc, 0x7e8c, 0x8aa2, 0x97b8, 0xa3ce, 
-     0x958e, 0xa1a4, 0xaeba, 0xbad0, 0xac90, 0xb8a6, 0xc5bc, 0xd1d2 
+     0x3c3c, 0x3f56, 0x4271, 0x468c, 0x5541, 0x585b, 0x5b76, 0x5f91, 
+     0x6e46, 0x7161, 0x757b, 0x7896, 0x874b, 0x8a66, 0x8e81, 0x919b, 
+     0xa051, 0xa36b, 0xa786, 0xaaa1, 0xb956, 0xbd71, 0xc08b, 0xc3a6, 
+     0xd25b, 0xd676, 0xd991, 0xdcab, 0xeb61, 0xef7b, 0xf296, 0xf6b1, 
+     0x3640, 0x3a5b, 0x3d76, 0x4090, 0x4f45, 0x5360, 0x567b, 0x5a96, 
+     0x694b, 0x6c65, 0x6f80, 0x739b, 0x8250, 0x856b, 0x8885, 0x8ca0, 
+     0x9b55, 0x9e70, 0xa28b, 0xa5a5, 0xb45b, 0xb775, 0xbb90, 0xbeab, 
+     0xcd60, 0xd17b, 0xd495, 0xd7b0, 0xe665, 0xea80, 0xed9b, 0xf0b5, 
+     0x3145, 0x3560, 0x387a, 0x3b95, 0x4a4a, 0x4e65, 0x5180, 0x549a, 
+     0x634f, 0x676a, 0x6a85, 0x6ea0, 0x7d55, 0x806f, 0x838a, 0x87a5, 
+     0x965a, 0x9975, 0x9c8f, 0xa0aa, 0xaf5f, 0xb27a, 0xb695, 0xb9af, 
+     0xc865, 0xcb7f, 0xcf9a, 0xd2b5, 0xe16a, 0xe585, 0xe89f, 0xebba, 
+     0x2c4a, 0x2f64, 0x337f, 0x369a, 0x454f, 0x496a, 0x4c84, 0x4f9f, 
+     0x5e54, 0x626f, 0x658a, 0x68a4, 0x7759, 0x7b74, 0x7e8f, 0x82aa, 
+     0x915f, 0x9479, 0x9794, 0x9baf, 0xaa64, 0xad7f, 0xb099, 0xb4b4, 
+     0xc369, 0xc684, 0xca9f, 0xcdb9, 0xdc6f, 0xdf89, 0xe3a4, 0xe6bf, 
+     0x274e, 0x2a69, 0x2e84, 0x319e, 0x4054, 0x436e, 0x4789, 0x4aa4, 
+     0x5959, 0x5d74, 0x608e, 0x63a9, 0x725e, 0x7679, 0x7994, 0x7cae, 
+     0x8b63, 0x8f7e, 0x9299, 0x96b4, 0xa569, 0xa883, 0xab9e, 0xafb9, 
+     0xbe6e, 0xc189, 0xc4a3, 0xc8be, 0xd773, 0xda8e, 0xdea9, 0xe1c3, 
+     0x2253, 0x256e, 0x2888, 0x2ca3, 0x3b58, 0x3e73, 0x428e, 0x45a8, 
+     0x545e, 0x5778, 0x5b93, 0x5eae, 0x6d63, 0x717e, 0x7498, 0x77b3, 
+     0x8668, 0x8a83, 0x8d9e, 0x90b8, 0x9f6d, 0xa388, 0xa6a3, 0xaabe, 
+     0xb973, 0xbc8d, 0xbfa8, 0xc3c3, 0xd278, 0xd593, 0xd8ad, 0xdcc8, 
+     0x1d58, 0x2072, 0x238d, 0x27a8, 0x365d, 0x3978, 0x3c92, 0x40ad, 
+     0x4f62, 0x527d, 0x5698, 0x59b2, 0x6868, 0x6b82, 0x6f9d, 0x72b8, 
+     0x816d, 0x8588, 0x88a2, 0x8bbd, 0x9a72, 0x9e8d, 0xa1a8, 0xa4c2, 
+     0xb377, 0xb792, 0xbaad, 0xbec8, 0xcd7d, 0xd097, 0xd3b2, 0xd7cd, 
+     0x175c, 0x1b77, 0x1e92, 0x22ac, 0x3162, 0x347c, 0x3797, 0x3bb2, 
+     0x4a67, 0x4d82, 0x509c, 0x54b7, 0x636c, 0x6687, 0x6aa2, 0x6dbc, 
+     0x7c72, 0x7f8c, 0x83a7, 0x86c2, 0x9577, 0x9892, 0x9cac, 0x9fc7, 
+     0xae7c, 0xb297, 0xb5b2, 0xb8cc, 0xc781, 0xcb9c, 0xceb7, 0xd1d2 
   }, { 
-     0x3c3c, 0x4c2b, 0x5c1a, 0x6d09, 0x3c4b, 0x4c3a, 0x5d29, 0x6d18, 
-     0x3c5a, 0x4c49, 0x5d38, 0x6d27, 0x3c69, 0x4d58, 0x5d47, 0x6e37, 
-     0x3c78, 0x4d67, 0x5d56, 0x6e46, 0x3d87, 0x4d76, 0x5e66, 0x6e55, 
-     0x3d96, 0x4d85, 0x5e75, 0x6e64, 0x3da5, 0x4e94, 0x5e84, 0x6f73, 
-     0x4a49, 0x5a38, 0x6b28, 0x7b17, 0x4a58, 0x5a47, 0x6b37, 0x7b26, 
-     0x4a67, 0x5b56, 0x6b46, 0x7c35, 0x4a76, 0x5b66, 0x6b55, 0x7c44, 
-     0x4b85, 0x5b75, 0x6c64, 0x7c53, 0x4b94, 0x5b84, 0x6c73, 0x7c62, 
-     0x4ba4, 0x5c93, 0x6c82, 0x7c71, 0x4bb3, 0x5ca2, 0x6c91, 0x7d80, 
-     0x5857, 0x6846, 0x7935, 0x8924, 0x5866, 0x6855, 0x7944, 0x8933, 
-     0x5875, 0x6964, 0x7953, 0x8a42, 0x5884, 0x6973, 0x7962, 0x8a52, 
-     0x5993, 0x6982, 0x7a71, 0x8a61, 0x59a2, 0x6991, 0x7a81, 0x8a70, 
-     0x59b1, 0x6aa0, 0x7a90, 0x8b7f, 0x59c0, 0x6aaf, 0x7a9f, 0x8b8e, 
-     0x6664, 0x7653, 0x8743, 0x9732, 0x6673, 0x7762, 0x8752, 0x9841, 
-     0x6682, 0x7771, 0x8761, 0x9850, 0x6791, 0x7781, 0x8870, 0x985f, 
-     0x67a0, 0x7790, 0x887f, 0x986e, 0x67af, 0x789f, 0x888e, 0x997d, 
-     0x67bf, 0x78ae, 0x889d, 0x998c, 0x67ce, 0x78bd, 0x88ac, 0x999b, 
-     0x7472, 0x8561, 0x9550, 0xa63f, 0x7481, 0x8570, 0x955f, 0xa64e, 
-     0x7490, 0x857f, 0x956e, 0xa65e, 0x759f, 0x858e, 0x967d, 0xa66d, 
-     0x75ae, 0x859d, 0x968c, 0xa67c, 0x75bd, 0x86ac, 0x969c, 0xa78b, 
-     0x75cc, 0x86bb, 0x96ab, 0xa79a, 0x76db, 0x86ca, 0x97ba, 0xa7a9, 
-     0x827f, 0x936e, 0xa35e, 0xb44d, 0x828e, 0x937d, 0xa36d, 0xb45c, 
-     0x839d, 0x938c, 0xa47c, 0xb46b, 0x83ac, 0x939c, 0xa48b, 0xb47a, 
-     0x83bb, 0x94ab, 0xa49a, 0xb589, 0x83cb, 0x94ba, 0xa4a9, 0xb598, 
-     0x84da, 0x94c9, 0xa5b8, 0xb5a7, 0x84e9, 0x94d8, 0xa5c7, 0xb5b6, 
-     0x908d, 0xa17c, 0xb16b, 0xc25a, 0x919c, 0xa18b, 0xb17a, 0xc269, 
-     0x91ab, 0xa19a, 0xb289, 0xc279, 0x91ba, 0xa1a9, 0xb298, 0xc288, 
-     0x91c9, 0xa2b8, 0xb2a7, 0xc397, 0x91d8, 0xa2c7, 0xb2b7, 0xc3a6, 
-     0x92e7, 0xa2d6, 0xb3c6, 0xc3b5, 0x92f6, 0xa2e5, 0xb3d5, 0xc3c4, 
-     0x9e9a, 0xaf89, 0xbf79, 0xd068, 0x9fa9, 0xaf98, 0xc088, 0xd077, 
-     0x9fb8, 0xafa7, 0xc097, 0xd086, 0x9fc7, 0xb0b7, 0xc0a6, 0xd195, 
-     0x9fd6, 0xb0c6, 0xc0b5, 0xd1a4, 0xa0e6, 0xb0d5, 0xc1c4, 0xd1b3, 
-     0xa0f5, 0xb0e4, 0xc1d3, 0xd1c2, 0xa0ff, 0xb1f3, 0xc1e2, 0xd2d2 
+     0x3c3c, 0x532e, 0x6a20, 0x8212, 0x3e45, 0x5537, 0x6d29, 0x841b, 
+     0x404f, 0x5841, 0x6f33, 0x8725, 0x4359, 0x5a4b, 0x723d, 0x892f, 
+     0x4563, 0x5d55, 0x7447, 0x8c39, 0x486d, 0x5f5f, 0x7751, 0x8e43, 
+     0x4a76, 0x6268, 0x795a, 0x914c, 0x4d80, 0x6472, 0x7c64, 0x9356, 
+     0x444d, 0x5c3f, 0x7331, 0x8b23, 0x4757, 0x5e49, 0x763b, 0x8d2d, 
+     0x4961, 0x6153, 0x7845, 0x9037, 0x4c6b, 0x635d, 0x7b4f, 0x9241, 
+     0x4e74, 0x6666, 0x7d58, 0x954a, 0x517e, 0x6870, 0x8062, 0x9754, 
+     0x5388, 0x6b7a, 0x826c, 0x9a5e, 0x5692, 0x6d84, 0x8576, 0x9c68, 
+     0x4d5f, 0x6551, 0x7c43, 0x9435, 0x5069, 0x675b, 0x7f4d, 0x963f, 
+     0x5272, 0x6a64, 0x8156, 0x9948, 0x557c, 0x6c6e, 0x8460, 0x9b52, 
+     0x5786, 0x6f78, 0x866a, 0x9e5c, 0x5a90, 0x7182, 0x8974, 0xa066, 
+     0x5c9a, 0x748c, 0x8b7e, 0xa270, 0x5fa3, 0x7695, 0x8d87, 0xa579, 
+     0x5670, 0x6e62, 0x8554, 0x9d46, 0x597a, 0x706c, 0x885e, 0x9f50, 
+     0x5b84, 0x7376, 0x8a68, 0xa25a, 0x5e8e, 0x7580, 0x8d72, 0xa464, 
+     0x6098, 0x788a, 0x8f7c, 0xa66e, 0x63a1, 0x7a93, 0x9185, 0xa977, 
+     0x65ab, 0x7c9d, 0x948f, 0xab81, 0x67b5, 0x7fa7, 0x9699, 0xae8b, 
+     0x5f82, 0x7774, 0x8e66, 0xa658, 0x628c, 0x797e, 0x9170, 0xa862, 
+     0x6496, 0x7c88, 0x937a, 0xaa6c, 0x679f, 0x7e91, 0x9583, 0xad75, 
+     0x69a9, 0x809b, 0x988d, 0xaf7f, 0x6bb3, 0x83a5, 0x9a97, 0xb289, 
+     0x6ebd, 0x85af, 0x9da1, 0xb493, 0x70c7, 0x88b9, 0x9fab, 0xb79d, 
+     0x6894, 0x8086, 0x9778, 0xae6a, 0x6b9d, 0x828f, 0x9981, 0xb173, 
+     0x6da7, 0x8499, 0x9c8b, 0xb37d, 0x6fb1, 0x87a3, 0x9e95, 0xb687, 
+     0x72bb, 0x89ad, 0xa19f, 0xb891, 0x74c5, 0x8cb7, 0xa3a9, 0xbb9b, 
+     0x77ce, 0x8ec0, 0xa6b2, 0xbda4, 0x79d8, 0x91ca, 0xa8bc, 0xc0ae, 
+     0x71a5, 0x8897, 0xa089, 0xb77b, 0x73af, 0x8ba1, 0xa293, 0xba85, 
+     0x76b9, 0x8dab, 0xa59d, 0xbc8f, 0x78c3, 0x90b5, 0xa7a7, 0xbf99, 
+     0x7bcc, 0x92be, 0xaab0, 0xc1a2, 0x7dd6, 0x95c8, 0xacba, 0xc4ac, 
+     0x80e0, 0x97d2, 0xafc4, 0xc6b6, 0x82ea, 0x9adc, 0xb1ce, 0xc9c0, 
+     0x7ab7, 0x91a9, 0xa99b, 0xc08d, 0x7cc1, 0x94b3, 0xaba5, 0xc397, 
+     0x7fca, 0x96bc, 0xaeae, 0xc5a0, 0x81d4, 0x99c6, 0xb0b8, 0xc8aa, 
+     0x84de, 0x9bd0, 0xb3c2, 0xcab4, 0x86e8, 0x9eda, 0xb5cc, 0xcdbe, 
+     0x89f2, 0xa0e4, 0xb8d6, 0xcfc8, 0x8bfb, 0xa3ed, 0xbadf, 0xd2d2 
   }, { 
-     0x3c3c, 0x2b4e, 0x1b61, 0x0b74, 0x4e50, 0x3e63, 0x2e75, 0x1d88, 
-     0x6164, 0x5177, 0x418a, 0x309c, 0x7478, 0x648b, 0x539e, 0x43b1, 
-     0x878d, 0x779f, 0x66b2, 0x56c5, 0x9aa1, 0x89b4, 0x79c7, 0x69d9, 
-     0xadb5, 0x9cc8, 0x8cdb, 0x7cee, 0xbfca, 0xafdc, 0x9fef, 0x8eff, 
-     0x4535, 0x3547, 0x245a, 0x146d, 0x5849, 0x485c, 0x376e, 0x2781, 
-     0x6b5d, 0x5a70, 0x4a83, 0x3a96, 0x7e71, 0x6d84, 0x5d97, 0x4daa, 
-     0x9086, 0x8099, 0x70ab, 0x60be, 0xa39a, 0x93ad, 0x83c0, 0x72d2, 
-     0xb6ae, 0xa6c1, 0x95d4, 0x85e7, 0xc9c3, 0xb9d5, 0xa8e8, 0x98fb, 
-     0x4f2e, 0x3e40, 0x2e53, 0x1e66, 0x6142, 0x5155, 0x4168, 0x317a, 
-     0x7456, 0x6469, 0x547c, 0x438f, 0x876b, 0x777d, 0x6790, 0x56a3, 
-     0x9a7f, 0x8a92, 0x79a4, 0x69b7, 0xad93, 0x9da6, 0x8cb9, 0x7ccb, 
-     0xc0a7, 0xafba, 0x9fcd, 0x8fe0, 0xd3bc, 0xc2ce, 0xb2e1, 0xa2f4, 
-     0x5827, 0x483a, 0x384c, 0x275f, 0x6b3b, 0x5b4e, 0x4a61, 0x3a73, 
-     0x7e4f, 0x6e62, 0x5d75, 0x4d88, 0x9164, 0x8076, 0x7089, 0x609c, 
-     0xa478, 0x938b, 0x839d, 0x73b0, 0xb68c, 0xa69f, 0x96b2, 0x86c5, 
-     0xc9a0, 0xb9b3, 0xa9c6, 0x98d9, 0xdcb5, 0xccc8, 0xbbda, 0xabed, 
-     0x6220, 0x5233, 0x4145, 0x3158, 0x7534, 0x6447, 0x545a, 0x446d, 
-     0x8748, 0x775b, 0x676e, 0x5781, 0x9a5d, 0x8a70, 0x7a82, 0x6995, 
-     0xad71, 0x9d84, 0x8d97, 0x7ca9, 0xc085, 0xb098, 0x9fab, 0x8fbe, 
-     0xd39a, 0xc3ac, 0xb2bf, 0xa2d2, 0xe6ae, 0xd5c1, 0xc5d3, 0xb5e6, 
-     0x6b19, 0x5b2c, 0x4b3f, 0x3a51, 0x7e2d, 0x6e40, 0x5e53, 0x4d66, 
-     0x9142, 0x8154, 0x7067, 0x607a, 0xa456, 0x9469, 0x837b, 0x738e, 
-     0xb76a, 0xa67d, 0x9690, 0x86a2, 0xca7e, 0xb991, 0xa9a4, 0x99b7, 
-     0xdc93, 0xcca5, 0xbcb8, 0xaccb, 0xefa7, 0xdfba, 0xcfcd, 0xbedf, 
-     0x7512, 0x6525, 0x5438, 0x444a, 0x8826, 0x7839, 0x674c, 0x575f, 
-     0x9b3b, 0x8a4d, 0x7a60, 0x6a73, 0xad4f, 0x9d62, 0x8d74, 0x7d87, 
-     0xc063, 0xb076, 0xa089, 0x8f9c, 0xd377, 0xc38a, 0xb39d, 0xa2b0, 
-     0xe68c, 0xd69f, 0xc5b1, 0xb5c4, 0xf9a0, 0xe9b3, 0xd8c6, 0xc8d8, 
-     0x7f0b, 0x6e1e, 0x5e31, 0x4e43, 0x911f, 0x8132, 0x7145, 0x6058, 
-     0xa434, 0x9446, 0x8459, 0x736c, 0xb748, 0xa75b, 0x966e, 0x8680, 
-     0xca5c, 0xba6f, 0xa982, 0x9995, 0xdd71, 0xcc83, 0xbc96, 0xaca9, 
-     0xf085, 0xdf98, 0xcfaa, 0xbfbd, 0xff99, 0xf2ac, 0xe2bf, 0xd2d1 
+     0x3c3c, 0x2b46, 0x1b50, 0x0a5b, 0x4953, 0x395e, 0x2968, 0x1872, 
+     0x576b, 0x4775, 0x3680, 0x268a, 0x6583, 0x548d, 0x4497, 0x34a2, 
+     0x739b, 0x62a5, 0x52af, 0x41ba, 0x80b2, 0x70bd, 0x60c7, 0x4fd1, 
+     0x8eca, 0x7ed4, 0x6ddf, 0x5de9, 0x9ce2, 0x8cec, 0x7bf7, 0x6bff, 
+     0x4a35, 0x3a3f, 0x2949, 0x1954, 0x584c, 0x4857, 0x3761, 0x276c, 
+     0x6664, 0x556f, 0x4579, 0x3583, 0x747c, 0x6386, 0x5391, 0x429b, 
+     0x8194, 0x719e, 0x61a8, 0x50b3, 0x8fac, 0x7fb6, 0x6ec0, 0x5ecb, 
+     0x9dc3, 0x8cce, 0x7cd8, 0x6ce2, 0xabdb, 0x9ae5, 0x8af0, 0x79fa, 
+     0x592e, 0x4838, 0x3843, 0x284d, 0x6746, 0x5650, 0x465a, 0x3565, 
+     0x745d, 0x6468, 0x5472, 0x437d, 0x8275, 0x7280, 0x618a, 0x5194, 
+     0x908d, 0x8097, 0x6fa2, 0x5fac, 0x9ea5, 0x8daf, 0x7db9, 0x6dc4, 
+     0xacbd, 0x9bc7, 0x8bd1, 0x7adc, 0xb9d4, 0xa9df, 0x99e9, 0x88f3, 
+     0x6827, 0x5732, 0x473c, 0x3646, 0x753f, 0x6549, 0x5554, 0x445e, 
+     0x8357, 0x7361, 0x626b, 0x5276, 0x916e, 0x8079, 0x7083, 0x608e, 
+     0x9f86, 0x8e91, 0x7e9b, 0x6da5, 0xac9e, 0x9ca8, 0x8cb3, 0x7bbd, 
+     0xbab6, 0xaac0, 0x99ca, 0x89d5, 0xc8ce, 0xb8d8, 0xa7e2, 0x97ed, 
+     0x7620, 0x662b, 0x5535, 0x453f, 0x8438, 0x7443, 0x634d, 0x5357, 
+     0x9250, 0x815a, 0x7165, 0x616f, 0xa068, 0x8f72, 0x7f7c, 0x6e87, 
+     0xad7f, 0x9d8a, 0x8d94, 0x7c9f, 0xbb97, 0xaba2, 0x9aac, 0x8ab6, 
+     0xc9af, 0xb8b9, 0xa8c4, 0x98ce, 0xd7c7, 0xc6d1, 0xb6db, 0xa5e6, 
+     0x851a, 0x7424, 0x642e, 0x5439, 0x9331, 0x823c, 0x7246, 0x6150, 
+     0xa049, 0x9054, 0x805e, 0x6f68, 0xae61, 0x9e6b, 0x8d76, 0x7d80, 
+     0xbc79, 0xac83, 0x9b8d, 0x8b98, 0xca90, 0xb99b, 0xa9a5, 0x99b0, 
+     0xd8a8, 0xc7b3, 0xb7bd, 0xa6c7, 0xe5c0, 0xd5ca, 0xc5d5, 0xb4df, 
+     0x9413, 0x831d, 0x7328, 0x6232, 0xa12b, 0x9135, 0x813f, 0x704a, 
+     0xaf42, 0x9f4d, 0x8e57, 0x7e61, 0xbd5a, 0xac65, 0x9c6f, 0x8c79, 
+     0xcb72, 0xba7c, 0xaa87, 0x9991, 0xd88a, 0xc894, 0xb89e, 0xa7a9, 
+     0xe6a1, 0xd6ac, 0xc5b6, 0xb5c1, 0xf4b9, 0xe4c4, 0xd3ce, 0xc3d8, 
+     0xa20c, 0x9216, 0x8121, 0x712b, 0xb024, 0xa02e, 0x8f39, 0x7f43, 
+     0xbe3c, 0xad46, 0x9d50, 0x8d5b, 0xcc53, 0xbb5e, 0xab68, 0x9a72, 
+     0xd96b, 0xc976, 0xb980, 0xa88a, 0xe783, 0xd78d, 0xc698, 0xb6a2, 
+     0xf59b, 0xe4a5, 0xd4af, 0xc4ba, 0xffb2, 0xf2bd, 0xe2c7, 0xd1d1 
   }, { 
-     0x3c3c, 0x5345, 0x6b4f, 0x8359, 0x4c3b, 0x6445, 0x7c4f, 0x9359, 
-     0x5d3b, 0x7545, 0x8c4f, 0xa459, 0x6e3b, 0x8545, 0x9d4f, 0xb559, 
-     0x7f3b, 0x9645, 0xae4f, 0xc659, 0x8f3b, 0xa745, 0xbf4f, 0xd659, 
-     0xa03b, 0xb845, 0xcf4f, 0xe759, 0xb13b, 0xc945, 0xe04f, 0xf859, 
-     0x364d, 0x4e57, 0x6561, 0x7d6b, 0x474d, 0x5e57, 0x7661, 0x8e6b, 
-     0x584d, 0x6f57, 0x8761, 0x9f6a, 0x684d, 0x8057, 0x9860, 0xaf6a, 
-     0x794d, 0x9156, 0xa860, 0xc06a, 0x8a4d, 0xa256, 0xb960, 0xd16a, 
-     0x9b4c, 0xb256, 0xca60, 0xe26a, 0xab4c, 0xc356, 0xdb60, 0xf26a, 
-     0x315e, 0x4868, 0x6072, 0x787c, 0x415e, 0x5968, 0x7172, 0x887c, 
-     0x525e, 0x6a68, 0x8172, 0x997c, 0x635e, 0x7b68, 0x9272, 0xaa7c, 
-     0x745e, 0x8b68, 0xa372, 0xbb7c, 0x845e, 0x9c68, 0xb472, 0xcb7c, 
-     0x955e, 0xad68, 0xc472, 0xdc7c, 0xa65e, 0xbe68, 0xd572, 0xed7b, 
-     0x2b6f, 0x4379, 0x5a83, 0x728d, 0x3c6f, 0x5379, 0x6b83, 0x838d, 
-     0x4d6f, 0x6479, 0x7c83, 0x948d, 0x5d6f, 0x7579, 0x8d83, 0xa48d, 
-     0x6e6f, 0x8679, 0x9d83, 0xb58d, 0x7f6f, 0x9779, 0xae83, 0xc68d, 
-     0x906f, 0xa779, 0xbf83, 0xd78d, 0xa06f, 0xb879, 0xd083, 0xe78d, 
-     0x2680, 0x3d8a, 0x5594, 0x6d9e, 0x3680, 0x4e8a, 0x6694, 0x7d9e, 
-     0x4780, 0x5f8a, 0x7694, 0x8e9e, 0x5880, 0x708a, 0x8794, 0x9f9e, 
-     0x6980, 0x808a, 0x9894, 0xb09e, 0x7980, 0x918a, 0xa994, 0xc09e, 
-     0x8a80, 0xa28a, 0xba94, 0xd19e, 0x9b80, 0xb38a, 0xca94, 0xe29e, 
-     0x2092, 0x389b, 0x4fa5, 0x67af, 0x3191, 0x499b, 0x60a5, 0x78af, 
-     0x4291, 0x599b, 0x71a5, 0x89af, 0x5291, 0x6a9b, 0x82a5, 0x99af, 
-     0x6391, 0x7b9b, 0x92a5, 0xaaaf, 0x7491, 0x8c9b, 0xa3a5, 0xbbaf, 
-     0x8591, 0x9c9b, 0xb4a5, 0xccaf, 0x9591, 0xad9b, 0xc5a5, 0xdcaf, 
-     0x1ba3, 0x32ad, 0x4ab7, 0x62c1, 0x2ba3, 0x43ad, 0x5bb7, 0x72c1, 
-     0x3ca3, 0x54ad, 0x6bb7, 0x83c0, 0x4da3, 0x65ad, 0x7cb7, 0x94c0, 
-     0x5ea3, 0x75ad, 0x8db6, 0xa5c0, 0x6ea3, 0x86ac, 0x9eb6, 0xb5c0, 
-     0x7fa2, 0x97ac, 0xafb6, 0xc6c0, 0x90a2, 0xa8ac, 0xbfb6, 0xd7c0, 
-     0x15b4, 0x2dbe, 0x44c8, 0x5cd2, 0x26b4, 0x3ebe, 0x55c8, 0x6dd2, 
-     0x37b4, 0x4ebe, 0x66c8, 0x7ed2, 0x47b4, 0x5fbe, 0x77c8, 0x8ed2, 
-     0x58b4, 0x70be, 0x88c8, 0x9fd2, 0x69b4, 0x81be, 0x98c8, 0xb0d2, 
-     0x7ab4, 0x91be, 0xa9c8, 0xc1d2, 0x8ab4, 0xa2be, 0xbac8, 0xd1d2 
+     0x3c3c, 0x4c4e, 0x5d60, 0x6e73, 0x513c, 0x624f, 0x7261, 0x8373, 
+     0x663d, 0x774f, 0x8862, 0x9974, 0x7b3d, 0x8c50, 0x9d62, 0xae75, 
+     0x913e, 0xa250, 0xb263, 0xc375, 0xa63e, 0xb751, 0xc863, 0xd976, 
+     0xbb3f, 0xcc52, 0xdd64, 0xee76, 0xd140, 0xe252, 0xf265, 0xff77, 
+     0x3448, 0x455b, 0x566d, 0x6780, 0x4a49, 0x5b5b, 0x6b6e, 0x7c80, 
+     0x5f4a, 0x705c, 0x816f, 0x9281, 0x744a, 0x855d, 0x966f, 0xa782, 
+     0x8a4b, 0x9a5d, 0xab70, 0xbc82, 0x9f4b, 0xb05e, 0xc170, 0xd183, 
+     0xb44c, 0xc55e, 0xd671, 0xe783, 0xca4d, 0xda5f, 0xeb72, 0xfc84, 
+     0x2d55, 0x3e68, 0x4f7a, 0x608d, 0x4356, 0x5368, 0x647b, 0x758d, 
+     0x5857, 0x6969, 0x7a7b, 0x8a8e, 0x6d57, 0x7e6a, 0x8f7c, 0xa08f, 
+     0x8358, 0x936a, 0xa47d, 0xb58f, 0x9858, 0xa96b, 0xba7d, 0xca90, 
+     0xad59, 0xbe6b, 0xcf7e, 0xe090, 0xc25a, 0xd36c, 0xe47e, 0xf591, 
+     0x2662, 0x3775, 0x4887, 0x599a, 0x3c63, 0x4c75, 0x5d88, 0x6e9a, 
+     0x5163, 0x6276, 0x7388, 0x839b, 0x6664, 0x7777, 0x8889, 0x999b, 
+     0x7b65, 0x8c77, 0x9d8a, 0xae9c, 0x9165, 0xa278, 0xb28a, 0xc39d, 
+     0xa666, 0xb778, 0xc88b, 0xd99d, 0xbb66, 0xcc79, 0xdd8b, 0xee9e, 
+     0x1f6f, 0x3082, 0x4194, 0x52a7, 0x3470, 0x4582, 0x5695, 0x67a7, 
+     0x4a70, 0x5b83, 0x6b95, 0x7ca8, 0x5f71, 0x7083, 0x8196, 0x92a8, 
+     0x7472, 0x8584, 0x9696, 0xa7a9, 0x8a72, 0x9a85, 0xab97, 0xbcaa, 
+     0x9f73, 0xb085, 0xc198, 0xd1aa, 0xb473, 0xc586, 0xd698, 0xe7ab, 
+     0x187c, 0x298f, 0x3aa1, 0x4bb3, 0x2d7d, 0x3e8f, 0x4fa2, 0x60b4, 
+     0x437d, 0x5390, 0x64a2, 0x75b5, 0x587e, 0x6990, 0x7aa3, 0x8ab5, 
+     0x6d7e, 0x7e91, 0x8fa3, 0xa0b6, 0x837f, 0x9392, 0xa4a4, 0xb5b6, 
+     0x9880, 0xa992, 0xbaa5, 0xcab7, 0xad80, 0xbe93, 0xcfa5, 0xe0b8, 
+     0x1189, 0x229b, 0x33ae, 0x43c0, 0x268a, 0x379c, 0x48af, 0x59c1, 
+     0x3c8a, 0x4c9d, 0x5daf, 0x6ec2, 0x518b, 0x629d, 0x73b0, 0x83c2, 
+     0x668b, 0x779e, 0x88b0, 0x99c3, 0x7b8c, 0x8c9e, 0x9db1, 0xaec3, 
+     0x918d, 0xa29f, 0xb2b2, 0xc3c4, 0xa68d, 0xb7a0, 0xc8b2, 0xd9c5, 
+     0x0a96, 0x1ba8, 0x2bbb, 0x3ccd, 0x1f97, 0x30a9, 0x41bb, 0x52ce, 
+     0x3497, 0x45aa, 0x56bc, 0x67cf, 0x4a98, 0x5baa, 0x6bbd, 0x7ccf, 
+     0x5f98, 0x70ab, 0x81bd, 0x92d0, 0x7499, 0x85ab, 0x96be, 0xa7d0, 
+     0x8a9a, 0x9bac, 0xabbe, 0xbcd1, 0x9f9a, 0xb0ad, 0xc1bf, 0xd1d2 
   }, { 
-     0x3c3c, 0x3e2e, 0x4120, 0x4412, 0x3c51, 0x3f44, 0x4236, 0x4528, 
-     0x3d67, 0x405a, 0x434c, 0x463e, 0x3e7d, 0x4170, 0x4462, 0x4754, 
-     0x3f93, 0x4286, 0x4578, 0x486a, 0x40a9, 0x439c, 0x468e, 0x4980, 
-     0x41bf, 0x44b2, 0x47a4, 0x4a96, 0x42d5, 0x45c8, 0x48ba, 0x4bac, 
-     0x4f41, 0x5233, 0x5525, 0x5818, 0x5057, 0x5349, 0x563b, 0x592e, 
-     0x516d, 0x545f, 0x5751, 0x5944, 0x5283, 0x5475, 0x5767, 0x5a5a, 
-     0x5299, 0x558b, 0x587d, 0x5b70, 0x53af, 0x56a1, 0x5993, 0x5c85, 
-     0x54c5, 0x57b7, 0x5aa9, 0x5d9b, 0x55db, 0x58cd, 0x5bbf, 0x5eb1, 
-     0x6246, 0x6538, 0x682b, 0x6b1d, 0x635c, 0x664e, 0x6941, 0x6c33, 
-     0x6472, 0x6764, 0x6a57, 0x6d49, 0x6588, 0x687a, 0x6b6d, 0x6e5f, 
-     0x669e, 0x6990, 0x6c83, 0x6f75, 0x67b4, 0x6aa6, 0x6d99, 0x708b, 
-     0x68ca, 0x6bbc, 0x6daf, 0x70a1, 0x68e0, 0x6bd2, 0x6ec5, 0x71b7, 
-     0x754c, 0x783e, 0x7b30, 0x7e22, 0x7662, 0x7954, 0x7c46, 0x7f38, 
-     0x7777, 0x7a6a, 0x7d5c, 0x804e, 0x788d, 0x7b80, 0x7e72, 0x8164, 
-     0x79a3, 0x7c96, 0x7f88, 0x827a, 0x7ab9, 0x7dac, 0x809e, 0x8390, 
-     0x7bcf, 0x7ec2, 0x81b4, 0x84a6, 0x7ce5, 0x7fd8, 0x82ca, 0x85bc, 
-     0x8851, 0x8b43, 0x8e35, 0x9128, 0x8967, 0x8c59, 0x8f4b, 0x923e, 
-     0x8a7d, 0x8d6f, 0x9061, 0x9354, 0x8b93, 0x8e85, 0x9177, 0x946a, 
-     0x8ca9, 0x8f9b, 0x928d, 0x9580, 0x8dbf, 0x90b1, 0x93a3, 0x9696, 
-     0x8ed5, 0x91c7, 0x94b9, 0x97ab, 0x8feb, 0x92dd, 0x95cf, 0x98c1, 
-     0x9c56, 0x9f48, 0xa23b, 0xa52d, 0x9d6c, 0xa05e, 0xa251, 0xa543, 
-     0x9d82, 0xa074, 0xa367, 0xa659, 0x9e98, 0xa18a, 0xa47d, 0xa76f, 
-     0x9fae, 0xa2a0, 0xa593, 0xa885, 0xa0c4, 0xa3b6, 0xa6a9, 0xa99b, 
-     0xa1da, 0xa4cc, 0xa7bf, 0xaab1, 0xa2f0, 0xa5e2, 0xa8d5, 0xabc7, 
-     0xaf5c, 0xb24e, 0xb540, 0xb832, 0xb072, 0xb364, 0xb656, 0xb948, 
-     0xb188, 0xb47a, 0xb76c, 0xba5e, 0xb29d, 0xb590, 0xb882, 0xbb74, 
-     0xb3b3, 0xb6a6, 0xb998, 0xbb8a, 0xb4c9, 0xb6bc, 0xb9ae, 0xbca0, 
-     0xb4df, 0xb7d2, 0xbac4, 0xbdb6, 0xb5f5, 0xb8e8, 0xbbda, 0xbecc, 
-     0xc261, 0xc553, 0xc845, 0xcb38, 0xc377, 0xc669, 0xc95b, 0xcc4e, 
-     0xc48d, 0xc77f, 0xca71, 0xcd64, 0xc5a3, 0xc895, 0xcb87, 0xce7a, 
-     0xc6b9, 0xc9ab, 0xcc9d, 0xcf90, 0xc7cf, 0xcac1, 0xcdb3, 0xd0a6, 
-     0xc8e5, 0xcbd7, 0xcec9, 0xd1bc, 0xc9fb, 0xcced, 0xcfdf, 0xd2d1 
+     0x3c3c, 0x482b, 0x541a, 0x6009, 0x3b4d, 0x483c, 0x542c, 0x601b, 
+     0x3b5f, 0x484e, 0x543d, 0x602d, 0x3b70, 0x4760, 0x544f, 0x603e, 
+     0x3b82, 0x4771, 0x5461, 0x6050, 0x3b94, 0x4783, 0x5372, 0x6062, 
+     0x3ba5, 0x4795, 0x5384, 0x6073, 0x3bb7, 0x47a6, 0x5396, 0x6085, 
+     0x4c46, 0x5836, 0x6425, 0x7014, 0x4c58, 0x5847, 0x6437, 0x7026, 
+     0x4c6a, 0x5859, 0x6448, 0x7038, 0x4c7b, 0x586b, 0x645a, 0x7049, 
+     0x4b8d, 0x587c, 0x646c, 0x705b, 0x4b9f, 0x588e, 0x647d, 0x706d, 
+     0x4bb0, 0x57a0, 0x648f, 0x707e, 0x4bc2, 0x57b1, 0x64a1, 0x7090, 
+     0x5c51, 0x6841, 0x7430, 0x811f, 0x5c63, 0x6852, 0x7442, 0x8131, 
+     0x5c75, 0x6864, 0x7453, 0x8143, 0x5c86, 0x6876, 0x7465, 0x8054, 
+     0x5c98, 0x6887, 0x7477, 0x8066, 0x5caa, 0x6899, 0x7488, 0x8078, 
+     0x5cbb, 0x68ab, 0x749a, 0x8089, 0x5bcd, 0x68bc, 0x74ab, 0x809b, 
+     0x6c5c, 0x794c, 0x853b, 0x912a, 0x6c6e, 0x785d, 0x854d, 0x913c, 
+     0x6c80, 0x786f, 0x855e, 0x914e, 0x6c91, 0x7881, 0x8570, 0x915f, 
+     0x6ca3, 0x7892, 0x8482, 0x9171, 0x6cb5, 0x78a4, 0x8493, 0x9182, 
+     0x6cc6, 0x78b5, 0x84a5, 0x9094, 0x6cd8, 0x78c7, 0x84b6, 0x90a6, 
+     0x7d67, 0x8957, 0x9546, 0xa135, 0x7d79, 0x8968, 0x9558, 0xa147, 
+     0x7c8b, 0x897a, 0x9569, 0xa158, 0x7c9c, 0x898b, 0x957b, 0xa16a, 
+     0x7cae, 0x889d, 0x958c, 0xa17c, 0x7cbf, 0x88af, 0x959e, 0xa18d, 
+     0x7cd1, 0x88c0, 0x95b0, 0xa19f, 0x7ce3, 0x88d2, 0x94c1, 0xa1b1, 
+     0x8d72, 0x9962, 0xa551, 0xb240, 0x8d84, 0x9973, 0xa562, 0xb152, 
+     0x8d95, 0x9985, 0xa574, 0xb163, 0x8da7, 0x9996, 0xa586, 0xb175, 
+     0x8db9, 0x99a8, 0xa597, 0xb187, 0x8cca, 0x99ba, 0xa5a9, 0xb198, 
+     0x8cdc, 0x99cb, 0xa5bb, 0xb1aa, 0x8cee, 0x99dd, 0xa5cc, 0xb1bc, 
+     0x9d7d, 0xa96c, 0xb65c, 0xc24b, 0x9d8f, 0xa97e, 0xb66d, 0xc25d, 
+     0x9da0, 0xa990, 0xb57f, 0xc26e, 0x9db2, 0xa9a1, 0xb591, 0xc280, 
+     0x9dc4, 0xa9b3, 0xb5a2, 0xc192, 0x9dd5, 0xa9c5, 0xb5b4, 0xc1a3, 
+     0x9de7, 0xa9d6, 0xb5c6, 0xc1b5, 0x9df9, 0xa9e8, 0xb5d7, 0xc1c7, 
+     0xad88, 0xba77, 0xc667, 0xd256, 0xad9a, 0xba89, 0xc678, 0xd268, 
+     0xadab, 0xba9b, 0xc68a, 0xd279, 0xadbd, 0xb9ac, 0xc69c, 0xd28b, 
+     0xadcf, 0xb9be, 0xc6ad, 0xd29d, 0xade0, 0xb9d0, 0xc5bf, 0xd2ae, 
+     0xadf2, 0xb9e1, 0xc5d1, 0xd2c0, 0xadff, 0xb9f3, 0xc5e2, 0xd2d1 
   }, { 
-     0x3c3c, 0x3256, 0x2971, 0x208c, 0x5448, 0x4a63, 0x417e, 0x3899, 
-     0x6c55, 0x6370, 0x598b, 0x50a6, 0x8462, 0x7b7d, 0x7198, 0x68b2, 
-     0x9c6f, 0x938a, 0x8aa4, 0x80bf, 0xb47c, 0xab97, 0xa2b1, 0x99cc, 
-     0xcd89, 0xc3a3, 0xbabe, 0xb1d9, 0xe595, 0xdcb0, 0xd2cb, 0xc9e6, 
-     0x3d39, 0x3353, 0x2a6e, 0x2189, 0x5545, 0x4c60, 0x427b, 0x3996, 
-     0x6d52, 0x646d, 0x5b88, 0x51a3, 0x855f, 0x7c7a, 0x7395, 0x69b0, 
-     0x9d6c, 0x9487, 0x8ba2, 0x82bc, 0xb679, 0xac94, 0xa3ae, 0x9ac9, 
-     0xce86, 0xc5a0, 0xbbbb, 0xb2d6, 0xe692, 0xddad, 0xd3c8, 0xcae3, 
-     0x3e36, 0x3551, 0x2b6b, 0x2286, 0x5643, 0x4d5d, 0x4478, 0x3a93, 
-     0x6e4f, 0x656a, 0x5c85, 0x52a0, 0x875c, 0x7d77, 0x7492, 0x6bad, 
-     0x9f69, 0x9584, 0x8c9f, 0x83b9, 0xb776, 0xae91, 0xa4ac, 0x9bc6, 
-     0xcf83, 0xc69e, 0xbdb8, 0xb3d3, 0xe790, 0xdeaa, 0xd5c5, 0xcbe0, 
-     0x3f33, 0x364e, 0x2d68, 0x2383, 0x5740, 0x4e5a, 0x4575, 0x3b90, 
-     0x704c, 0x6667, 0x5d82, 0x549d, 0x8859, 0x7e74, 0x758f, 0x6caa, 
-     0xa066, 0x9781, 0x8d9c, 0x84b7, 0xb873, 0xaf8e, 0xa6a9, 0x9cc3, 
-     0xd080, 0xc79b, 0xbeb5, 0xb4d0, 0xe98d, 0xdfa7, 0xd6c2, 0xcddd, 
-     0x4030, 0x374b, 0x2e66, 0x2480, 0x593d, 0x4f58, 0x4672, 0x3d8d, 
-     0x714a, 0x6764, 0x5e7f, 0x559a, 0x8956, 0x8071, 0x768c, 0x6da7, 
-     0xa163, 0x987e, 0x8f99, 0x85b4, 0xb970, 0xb08b, 0xa7a6, 0x9dc1, 
-     0xd27d, 0xc898, 0xbfb3, 0xb6cd, 0xea8a, 0xe0a5, 0xd7bf, 0xceda, 
-     0x422d, 0x3848, 0x2f63, 0x267d, 0x5a3a, 0x5055, 0x476f, 0x3e8a, 
-     0x7247, 0x6961, 0x5f7c, 0x5697, 0x8a54, 0x816e, 0x7889, 0x6ea4, 
-     0xa260, 0x997b, 0x9096, 0x86b1, 0xbb6d, 0xb188, 0xa8a3, 0x9fbe, 
-     0xd37a, 0xc995, 0xc0b0, 0xb7ca, 0xeb87, 0xe2a2, 0xd8bc, 0xcfd7, 
-     0x432a, 0x3a45, 0x3060, 0x277b, 0x5b37, 0x5252, 0x486d, 0x3f87, 
-     0x7344, 0x6a5f, 0x6179, 0x5794, 0x8b51, 0x826b, 0x7986, 0x70a1, 
-     0xa45d, 0x9a78, 0x9193, 0x88ae, 0xbc6a, 0xb285, 0xa9a0, 0xa0bb, 
-     0xd477, 0xcb92, 0xc1ad, 0xb8c8, 0xec84, 0xe39f, 0xdaba, 0xd0d4, 
-     0x4427, 0x3b42, 0x315d, 0x2878, 0x5c34, 0x534f, 0x4a6a, 0x4084, 
-     0x7441, 0x6b5c, 0x6276, 0x5991, 0x8d4e, 0x8369, 0x7a83, 0x719e, 
-     0xa55b, 0x9c75, 0x9290, 0x89ab, 0xbd67, 0xb482, 0xaa9d, 0xa1b8, 
-     0xd574, 0xcc8f, 0xc3aa, 0xb9c5, 0xed81, 0xe49c, 0xdbb7, 0xd1d2 
+     0x3c3c, 0x2d52, 0x1e68, 0x0f7e, 0x514e, 0x4264, 0x337a, 0x2490, 
+     0x6660, 0x5776, 0x488c, 0x39a2, 0x7b72, 0x6c88, 0x5d9e, 0x4eb4, 
+     0x9084, 0x819a, 0x72b0, 0x63c6, 0xa596, 0x96ac, 0x87c2, 0x78d8, 
+     0xbaa8, 0xabbe, 0x9cd4, 0x8dea, 0xcfba, 0xc0d0, 0xb1e6, 0xa2fc, 
+     0x4235, 0x334c, 0x2562, 0x1678, 0x5747, 0x485e, 0x3a74, 0x2b8a, 
+     0x6c59, 0x5d70, 0x4f86, 0x409c, 0x816b, 0x7282, 0x6498, 0x55ae, 
+     0x967d, 0x8894, 0x79aa, 0x6ac0, 0xab8f, 0x9da6, 0x8ebc, 0x7fd2, 
+     0xc0a1, 0xb2b8, 0xa3ce, 0x94e4, 0xd5b3, 0xc7ca, 0xb8e0, 0xa9f6, 
+     0x492f, 0x3a46, 0x2b5c, 0x1d72, 0x5e41, 0x4f58, 0x406e, 0x3284, 
+     0x7353, 0x646a, 0x5580, 0x4796, 0x8865, 0x797c, 0x6a92, 0x5ca8, 
+     0x9d77, 0x8e8e, 0x7fa4, 0x71ba, 0xb289, 0xa3a0, 0x94b6, 0x86cc, 
+     0xc79b, 0xb8b2, 0xa9c8, 0x9bde, 0xdcad, 0xcdc4, 0xbeda, 0xb0f0, 
+     0x5029, 0x413f, 0x3256, 0x236c, 0x653b, 0x5651, 0x4768, 0x387e, 
+     0x7a4d, 0x6b63, 0x5c7a, 0x4d90, 0x8f5f, 0x8075, 0x718c, 0x62a2, 
+     0xa471, 0x9587, 0x869e, 0x77b4, 0xb983, 0xaa99, 0x9bb0, 0x8cc6, 
+     0xce95, 0xbfab, 0xb0c2, 0xa1d8, 0xe3a7, 0xd4bd, 0xc5d4, 0xb6ea, 
+     0x5723, 0x4839, 0x3950, 0x2a66, 0x6c35, 0x5d4b, 0x4e62, 0x3f78, 
+     0x8147, 0x725d, 0x6374, 0x548a, 0x9659, 0x876f, 0x7886, 0x699c, 
+     0xab6b, 0x9c81, 0x8d98, 0x7eae, 0xc07d, 0xb193, 0xa2aa, 0x93c0, 
+     0xd58f, 0xc6a5, 0xb7bc, 0xa8d2, 0xeaa1, 0xdbb7, 0xccce, 0xbde4, 
+     0x5d1d, 0x4f33, 0x4049, 0x3160, 0x722f, 0x6445, 0x555b, 0x4672, 
+     0x8741, 0x7957, 0x6a6d, 0x5b84, 0x9c53, 0x8e69, 0x7f7f, 0x7096, 
+     0xb165, 0xa37b, 0x9491, 0x85a8, 0xc677, 0xb88d, 0xa9a3, 0x9aba, 
+     0xdb89, 0xcd9f, 0xbeb5, 0xafcc, 0xf09b, 0xe2b1, 0xd3c7, 0xc4de, 
+     0x6417, 0x552d, 0x4643, 0x385a, 0x7929, 0x6a3f, 0x5b55, 0x4d6c, 
+     0x8e3b, 0x7f51, 0x7067, 0x627e, 0xa34d, 0x9463, 0x8579, 0x7790, 
+     0xb85f, 0xa975, 0x9b8b, 0x8ca2, 0xcd71, 0xbe87, 0xb09d, 0xa1b4, 
+     0xe283, 0xd399, 0xc5af, 0xb6c6, 0xf795, 0xe8ab, 0xdac1, 0xcbd8, 
+     0x6b11, 0x5c27, 0x4d3d, 0x3e53, 0x8023, 0x7139, 0x624f, 0x5365, 
+     0x9535, 0x864b, 0x7761, 0x6877, 0xaa47, 0x9b5d, 0x8c73, 0x7d89, 
+     0xbf59, 0xb06f, 0xa185, 0x929b, 0xd46b, 0xc581, 0xb697, 0xa7ad, 
+     0xe97d, 0xda93, 0xcba9, 0xbcbf, 0xfe8f, 0xefa5, 0xe0bb, 0xd1d1 
   }, { 
-     0x3c3c, 0x5738, 0x7334, 0x8f30, 0x443f, 0x603b, 0x7c37, 0x9833, 
-     0x4d42, 0x693e, 0x853a, 0xa136, 0x5645, 0x7241, 0x8e3d, 0xaa39, 
-     0x5f48, 0x7b44, 0x9740, 0xb33c, 0x684b, 0x8447, 0xa043, 0xbb3f, 
-     0x714e, 0x8d4a, 0xa946, 0xc442, 0x7a51, 0x964d, 0xb149, 0xcd46, 
-     0x3c4f, 0x584c, 0x7448, 0x9044, 0x4553, 0x614f, 0x7d4b, 0x9947, 
-     0x4e56, 0x6a52, 0x864e, 0xa14a, 0x5759, 0x7355, 0x8e51, 0xaa4d, 
-     0x605c, 0x7c58, 0x9754, 0xb350, 0x695f, 0x845b, 0xa057, 0xbc53, 
-     0x7162, 0x8d5e, 0xa95a, 0xc556, 0x7a65, 0x9661, 0xb25d, 0xce5a, 
-     0x3d63, 0x5960, 0x745c, 0x9058, 0x4667, 0x6163, 0x7d5f, 0x995b, 
-     0x4e6a, 0x6a66, 0x8662, 0xa25e, 0x576d, 0x7369, 0x8f65, 0xab61, 
-     0x6070, 0x7c6c, 0x9868, 0xb464, 0x6973, 0x856f, 0xa16b, 0xbd67, 
-     0x7276, 0x8e72, 0xaa6e, 0xc66a, 0x7b79, 0x9775, 0xb371, 0xce6e, 
-     0x3d77, 0x5974, 0x7570, 0x916c, 0x467b, 0x6277, 0x7e73, 0x9a6f, 
-     0x4f7e, 0x6b7a, 0x8776, 0xa372, 0x5881, 0x747d, 0x9079, 0xac75, 
-     0x6184, 0x7d80, 0x997c, 0xb478, 0x6a87, 0x8683, 0xa17f, 0xbd7b, 
-     0x738a, 0x8f86, 0xaa82, 0xc67e, 0x7c8d, 0x9789, 0xb385, 0xcf82, 
-     0x3e8b, 0x5a88, 0x7684, 0x9180, 0x478f, 0x638b, 0x7e87, 0x9a83, 
-     0x5092, 0x6c8e, 0x878a, 0xa386, 0x5995, 0x7491, 0x908d, 0xac89, 
-     0x6198, 0x7d94, 0x9990, 0xb58c, 0x6a9b, 0x8697, 0xa293, 0xbe8f, 
-     0x739e, 0x8f9a, 0xab96, 0xc792, 0x7ca1, 0x989d, 0xb499, 0xd096, 
-     0x3f9f, 0x5a9c, 0x7698, 0x9294, 0x47a3, 0x639f, 0x7f9b, 0x9b97, 
-     0x50a6, 0x6ca2, 0x889e, 0xa49a, 0x59a9, 0x75a5, 0x91a1, 0xad9d, 
-     0x62ac, 0x7ea8, 0x9aa4, 0xb6a0, 0x6baf, 0x87ab, 0xa3a7, 0xbfa3, 
-     0x74b2, 0x90ae, 0xacaa, 0xc7a6, 0x7db5, 0x99b1, 0xb4ad, 0xd0aa, 
-     0x3fb3, 0x5bb0, 0x77ac, 0x93a8, 0x48b7, 0x64b3, 0x80af, 0x9cab, 
-     0x51ba, 0x6db6, 0x89b2, 0xa4ae, 0x5abd, 0x76b9, 0x91b5, 0xadb1, 
-     0x63c0, 0x7fbc, 0x9ab8, 0xb6b4, 0x6cc3, 0x87bf, 0xa3bb, 0xbfb7, 
-     0x74c6, 0x90c2, 0xacbe, 0xc8ba, 0x7dc9, 0x99c5, 0xb5c1, 0xd1be, 
-     0x40c7, 0x5cc4, 0x77c0, 0x93bc, 0x49cb, 0x64c7, 0x80c3, 0x9cbf, 
-     0x52ce, 0x6dca, 0x89c6, 0xa5c2, 0x5ad1, 0x76cd, 0x92c9, 0xaec5, 
-     0x63d4, 0x7fd0, 0x9bcc, 0xb7c8, 0x6cd7, 0x88d3, 0xa4cf, 0xc0cb, 
-     0x75da, 0x91d6, 0xadd2, 0xc9ce, 0x7edd, 0x9ad9, 0xb6d5, 0xd2d2 
+     0x3c3c, 0x5541, 0x6f46, 0x894b, 0x4a3c, 0x6441, 0x7e47, 0x984c, 
+     0x583c, 0x7242, 0x8c47, 0xa64c, 0x663d, 0x8042, 0x9a48, 0xb44d, 
+     0x743d, 0x8e43, 0xa848, 0xc24d, 0x823e, 0x9c43, 0xb648, 0xd04e, 
+     0x913e, 0xab44, 0xc449, 0xde4e, 0x9f3f, 0xb944, 0xd349, 0xed4f, 
+     0x384e, 0x5253, 0x6c59, 0x865e, 0x464f, 0x6054, 0x7a59, 0x945f, 
+     0x544f, 0x6e54, 0x885a, 0xa25f, 0x6250, 0x7c55, 0x965a, 0xb05f, 
+     0x7050, 0x8a55, 0xa45b, 0xbe60, 0x7e51, 0x9856, 0xb25b, 0xcc60, 
+     0x8d51, 0xa756, 0xc15c, 0xdb61, 0x9b51, 0xb557, 0xcf5c, 0xe961, 
+     0x3461, 0x4e66, 0x686b, 0x8271, 0x4261, 0x5c67, 0x766c, 0x9071, 
+     0x5062, 0x6a67, 0x846c, 0x9e72, 0x5e62, 0x7868, 0x926d, 0xac72, 
+     0x6c63, 0x8668, 0xa06d, 0xba73, 0x7b63, 0x9569, 0xaf6e, 0xc973, 
+     0x8964, 0xa369, 0xbd6e, 0xd774, 0x9764, 0xb169, 0xcb6f, 0xe574, 
+     0x3074, 0x4a79, 0x647e, 0x7e83, 0x3e74, 0x5879, 0x727f, 0x8c84, 
+     0x4c75, 0x667a, 0x807f, 0x9a84, 0x5a75, 0x747a, 0x8e80, 0xa885, 
+     0x6975, 0x837b, 0x9d80, 0xb785, 0x7776, 0x917b, 0xab81, 0xc586, 
+     0x8576, 0x9f7c, 0xb981, 0xd386, 0x9377, 0xad7c, 0xc781, 0xe187, 
+     0x2c86, 0x468c, 0x6091, 0x7a96, 0x3a87, 0x548c, 0x6e91, 0x8897, 
+     0x4887, 0x628c, 0x7c92, 0x9697, 0x5688, 0x708d, 0x8a92, 0xa498, 
+     0x6588, 0x7f8d, 0x9993, 0xb398, 0x7389, 0x8d8e, 0xa793, 0xc198, 
+     0x8189, 0x9b8e, 0xb594, 0xcf99, 0x8f8a, 0xa98f, 0xc394, 0xdd99, 
+     0x2899, 0x429e, 0x5ca4, 0x76a9, 0x3699, 0x509f, 0x6aa4, 0x84a9, 
+     0x449a, 0x5e9f, 0x78a4, 0x92aa, 0x539a, 0x6da0, 0x87a5, 0xa1aa, 
+     0x619b, 0x7ba0, 0x95a5, 0xafab, 0x6f9b, 0x89a1, 0xa3a6, 0xbdab, 
+     0x7d9c, 0x97a1, 0xb1a6, 0xcbac, 0x8b9c, 0xa5a2, 0xbfa7, 0xd9ac, 
+     0x24ac, 0x3eb1, 0x58b6, 0x72bc, 0x32ac, 0x4cb1, 0x66b7, 0x80bc, 
+     0x41ad, 0x5bb2, 0x75b7, 0x8fbc, 0x4fad, 0x69b2, 0x83b8, 0x9dbd, 
+     0x5dae, 0x77b3, 0x91b8, 0xabbd, 0x6bae, 0x85b3, 0x9fb9, 0xb9be, 
+     0x79ae, 0x93b4, 0xadb9, 0xc7be, 0x87af, 0xa1b4, 0xbbba, 0xd5bf, 
+     0x20be, 0x3ac4, 0x54c9, 0x6ece, 0x2fbf, 0x49c4, 0x62c9, 0x7ccf, 
+     0x3dbf, 0x57c5, 0x71ca, 0x8bcf, 0x4bc0, 0x65c5, 0x7fca, 0x99d0, 
+     0x59c0, 0x73c5, 0x8dcb, 0xa7d0, 0x67c1, 0x81c6, 0x9bcb, 0xb5d1, 
+     0x75c1, 0x8fc6, 0xa9cc, 0xc3d1, 0x84c2, 0x9ec7, 0xb8cc, 0xd1d2 
   }, { 
-     0x3c3c, 0x3238, 0x2835, 0x1f31, 0x4255, 0x3851, 0x2e4e, 0x254b, 
-     0x486e, 0x3e6b, 0x3567, 0x2b64, 0x4e87, 0x4484, 0x3b81, 0x317d, 
-     0x54a1, 0x4a9d, 0x419a, 0x3796, 0x5aba, 0x50b7, 0x47b3, 0x3db0, 
-     0x60d3, 0x57d0, 0x4dcc, 0x43c9, 0x66ec, 0x5de9, 0x53e6, 0x49e2, 
-     0x4f39, 0x4536, 0x3c32, 0x322f, 0x5552, 0x4b4f, 0x424c, 0x3848, 
-     0x5b6c, 0x5268, 0x4865, 0x3e61, 0x6185, 0x5882, 0x4e7e, 0x447b, 
-     0x679e, 0x5e9b, 0x5497, 0x4b94, 0x6db8, 0x64b4, 0x5ab1, 0x51ad, 
-     0x74d1, 0x6acd, 0x60ca, 0x57c7, 0x7aea, 0x70e7, 0x66e3, 0x5de0, 
-     0x6237, 0x5933, 0x4f30, 0x462c, 0x6850, 0x5f4d, 0x5549, 0x4c46, 
-     0x6f69, 0x6566, 0x5b62, 0x525f, 0x7583, 0x6b7f, 0x617c, 0x5878, 
-     0x7b9c, 0x7198, 0x6895, 0x5e92, 0x81b5, 0x77b2, 0x6eae, 0x64ab, 
-     0x87ce, 0x7dcb, 0x74c8, 0x6ac4, 0x8de8, 0x84e4, 0x7ae1, 0x70dd, 
-     0x7634, 0x6c31, 0x632e, 0x592a, 0x7c4e, 0x724a, 0x6947, 0x5f43, 
-     0x8267, 0x7863, 0x6f60, 0x655d, 0x8880, 0x7f7d, 0x7579, 0x6b76, 
-     0x8e99, 0x8596, 0x7b93, 0x718f, 0x94b3, 0x8baf, 0x81ac, 0x78a9, 
-     0x9acc, 0x91c9, 0x87c5, 0x7ec2, 0xa1e5, 0x97e2, 0x8dde, 0x84db, 
-     0x8932, 0x802f, 0x762b, 0x6c28, 0x8f4b, 0x8648, 0x7c44, 0x7341, 
-     0x9564, 0x8c61, 0x825e, 0x795a, 0x9c7e, 0x927a, 0x8877, 0x7f74, 
-     0xa297, 0x9894, 0x8e90, 0x858d, 0xa8b0, 0x9ead, 0x95aa, 0x8ba6, 
-     0xaeca, 0xa4c6, 0x9bc3, 0x91bf, 0xb4e3, 0xaadf, 0xa1dc, 0x97d9, 
-     0x9d30, 0x932c, 0x8929, 0x8025, 0xa349, 0x9945, 0x9042, 0x863f, 
-     0xa962, 0x9f5f, 0x965b, 0x8c58, 0xaf7b, 0xa578, 0x9c75, 0x9271, 
-     0xb595, 0xac91, 0xa28e, 0x988a, 0xbbae, 0xb2ab, 0xa8a7, 0x9ea4, 
-     0xc1c7, 0xb8c4, 0xaec0, 0xa5bd, 0xc7e1, 0xbedd, 0xb4da, 0xabd6, 
-     0xb02d, 0xa72a, 0x9d26, 0x9323, 0xb646, 0xad43, 0xa340, 0x993c, 
-     0xbc60, 0xb35c, 0xa959, 0xa055, 0xc279, 0xb976, 0xaf72, 0xa66f, 
-     0xc992, 0xbf8f, 0xb58b, 0xac88, 0xcfac, 0xc5a8, 0xbba5, 0xb2a1, 
-     0xd5c5, 0xcbc1, 0xc2be, 0xb8bb, 0xdbde, 0xd1db, 0xc8d7, 0xbed4, 
-     0xc42b, 0xba27, 0xb024, 0xa721, 0xca44, 0xc041, 0xb63d, 0xad3a, 
-     0xd05d, 0xc65a, 0xbd56, 0xb353, 0xd677, 0xcc73, 0xc370, 0xb96c, 
-     0xdc90, 0xd28c, 0xc989, 0xbf86, 0xe2a9, 0xd8a6, 0xcfa2, 0xc59f, 
-     0xe8c2, 0xdfbf, 0xd5bc, 0xcbb8, 0xeedc, 0xe5d8, 0xdbd5, 0xd2d1 
+     0x3c3c, 0x3a31, 0x3826, 0x371b, 0x3e53, 0x3c48, 0x3b3d, 0x3932, 
+     0x406b, 0x3e60, 0x3d55, 0x3b4a, 0x4282, 0x4177, 0x3f6c, 0x3d61, 
+     0x449a, 0x438f, 0x4184, 0x4079, 0x47b1, 0x45a6, 0x439b, 0x4290, 
+     0x49c9, 0x47be, 0x46b3, 0x44a8, 0x4be0, 0x49d6, 0x48cb, 0x46c0, 
+     0x4f3e, 0x4e33, 0x4c28, 0x4b1d, 0x5256, 0x504b, 0x4e40, 0x4d35, 
+     0x546d, 0x5262, 0x5157, 0x4f4c, 0x5685, 0x547a, 0x536f, 0x5164, 
+     0x589c, 0x5791, 0x5586, 0x547b, 0x5bb4, 0x59a9, 0x579e, 0x5693, 
+     0x5dcb, 0x5bc1, 0x5ab6, 0x58ab, 0x5fe3, 0x5dd8, 0x5ccd, 0x5ac2, 
+     0x6341, 0x6236, 0x602b, 0x5e20, 0x6558, 0x644d, 0x6242, 0x6137, 
+     0x6870, 0x6665, 0x655a, 0x634f, 0x6a87, 0x687c, 0x6771, 0x6566, 
+     0x6c9f, 0x6b94, 0x6989, 0x677e, 0x6eb6, 0x6dac, 0x6ba1, 0x6a96, 
+     0x71ce, 0x6fc3, 0x6db8, 0x6cad, 0x73e6, 0x71db, 0x70d0, 0x6ec5, 
+     0x7743, 0x7638, 0x742d, 0x7222, 0x795b, 0x7850, 0x7645, 0x753a, 
+     0x7c72, 0x7a67, 0x785c, 0x7751, 0x7e8a, 0x7c7f, 0x7b74, 0x7969, 
+     0x80a1, 0x7e96, 0x7d8c, 0x7b81, 0x82b9, 0x81ae, 0x7fa3, 0x7e98, 
+     0x85d1, 0x83c6, 0x81bb, 0x80b0, 0x87e8, 0x85dd, 0x84d2, 0x82c7, 
+     0x8b46, 0x893b, 0x8830, 0x8625, 0x8d5d, 0x8c52, 0x8a47, 0x883c, 
+     0x8f75, 0x8e6a, 0x8c5f, 0x8b54, 0x928c, 0x9081, 0x8f77, 0x8d6c, 
+     0x94a4, 0x9299, 0x918e, 0x8f83, 0x96bc, 0x95b1, 0x93a6, 0x919b, 
+     0x98d3, 0x97c8, 0x95bd, 0x94b2, 0x9beb, 0x99e0, 0x97d5, 0x96ca, 
+     0x9f48, 0x9d3d, 0x9c32, 0x9a27, 0xa160, 0xa055, 0x9e4a, 0x9c3f, 
+     0xa377, 0xa26c, 0xa061, 0x9f57, 0xa68f, 0xa484, 0xa279, 0xa16e, 
+     0xa8a7, 0xa69c, 0xa591, 0xa386, 0xaabe, 0xa8b3, 0xa7a8, 0xa59d, 
+     0xacd6, 0xabcb, 0xa9c0, 0xa8b5, 0xafed, 0xade2, 0xabd7, 0xaacc, 
+     0xb34b, 0xb140, 0xb035, 0xae2a, 0xb562, 0xb357, 0xb24c, 0xb042, 
+     0xb77a, 0xb66f, 0xb464, 0xb259, 0xb992, 0xb887, 0xb67c, 0xb571, 
+     0xbca9, 0xba9e, 0xb993, 0xb788, 0xbec1, 0xbcb6, 0xbbab, 0xb9a0, 
+     0xc0d8, 0xbfcd, 0xbdc2, 0xbbb7, 0xc2f0, 0xc1e5, 0xbfda, 0xbecf, 
+     0xc74d, 0xc542, 0xc437, 0xc22d, 0xc965, 0xc75a, 0xc64f, 0xc444, 
+     0xcb7d, 0xca72, 0xc867, 0xc65c, 0xcd94, 0xcc89, 0xca7e, 0xc973, 
+     0xd0ac, 0xcea1, 0xcc96, 0xcb8b, 0xd2c3, 0xd0b8, 0xcfad, 0xcda2, 
+     0xd4db, 0xd2d0, 0xd1c5, 0xcfba, 0xd6f2, 0xd5e7, 0xd3dc, 0xd2d1 
   }, { 
-     0x3c3c, 0x3f56, 0x4271, 0x468c, 0x5541, 0x585b, 0x5b76, 0x5f91, 
-     0x6e46, 0x7161, 0x757b, 0x7896, 0x874b, 0x8a66, 0x8e81, 0x919b, 
-     0xa051, 0xa36b, 0xa786, 0xaaa1, 0xb956, 0xbd71, 0xc08b, 0xc3a6, 
-     0xd25b, 0xd676, 0xd991, 0xdcab, 0xeb61, 0xef7b, 0xf296, 0xf6b1, 
-     0x3640, 0x3a5b, 0x3d76, 0x4090, 0x4f45, 0x5360, 0x567b, 0x5a96, 
-     0x694b, 0x6c65, 0x6f80, 0x739b, 0x8250, 0x856b, 0x8885, 0x8ca0, 
-     0x9b55, 0x9e70, 0xa28b, 0xa5a5, 0xb45b, 0xb775, 0xbb90, 0xbeab, 
-     0xcd60, 0xd17b, 0xd495, 0xd7b0, 0xe665, 0xea80, 0xed9b, 0xf0b5, 
-     0x3145, 0x3560, 0x387a, 0x3b95, 0x4a4a, 0x4e65, 0x5180, 0x549a, 
-     0x634f, 0x676a, 0x6a85, 0x6ea0, 0x7d55, 0x806f, 0x838a, 0x87a5, 
-     0x965a, 0x9975, 0x9c8f, 0xa0aa, 0xaf5f, 0xb27a, 0xb695, 0xb9af, 
-     0xc865, 0xcb7f, 0xcf9a, 0xd2b5, 0xe16a, 0xe585, 0xe89f, 0xebba, 
-     0x2c4a, 0x2f64, 0x337f, 0x369a, 0x454f, 0x496a, 0x4c84, 0x4f9f, 
-     0x5e54, 0x626f, 0x658a, 0x68a4, 0x7759, 0x7b74, 0x7e8f, 0x82aa, 
-     0x915f, 0x9479, 0x9794, 0x9baf, 0xaa64, 0xad7f, 0xb099, 0xb4b4, 
-     0xc369, 0xc684, 0xca9f, 0xcdb9, 0xdc6f, 0xdf89, 0xe3a4, 0xe6bf, 
-     0x274e, 0x2a69, 0x2e84, 0x319e, 0x4054, 0x436e, 0x4789, 0x4aa4, 
-     0x5959, 0x5d74, 0x608e, 0x63a9, 0x725e, 0x7679, 0x7994, 0x7cae, 
-     0x8b63, 0x8f7e, 0x9299, 0x96b4, 0xa569, 0xa883, 0xab9e, 0xafb9, 
-     0xbe6e, 0xc189, 0xc4a3, 0xc8be, 0xd773, 0xda8e, 0xdea9, 0xe1c3, 
-     0x2253, 0x256e, 0x2888, 0x2ca3, 0x3b58, 0x3e73, 0x428e, 0x45a8, 
-     0x545e, 0x5778, 0x5b93, 0x5eae, 0x6d63, 0x717e, 0x7498, 0x77b3, 
-     0x8668, 0x8a83, 0x8d9e, 0x90b8, 0x9f6d, 0xa388, 0xa6a3, 0xaabe, 
-     0xb973, 0xbc8d, 0xbfa8, 0xc3c3, 0xd278, 0xd593, 0xd8ad, 0xdcc8, 
-     0x1d58, 0x2072, 0x238d, 0x27a8, 0x365d, 0x3978, 0x3c92, 0x40ad, 
-     0x4f62, 0x527d, 0x5698, 0x59b2, 0x6868, 0x6b82, 0x6f9d, 0x72b8, 
-     0x816d, 0x8588, 0x88a2, 0x8bbd, 0x9a72, 0x9e8d, 0xa1a8, 0xa4c2, 
-     0xb377, 0xb792, 0xbaad, 0xbec8, 0xcd7d, 0xd097, 0xd3b2, 0xd7cd, 
-     0x175c, 0x1b77, 0x1e92, 0x22ac, 0x3162, 0x347c, 0x3797, 0x3bb2, 
-     0x4a67, 0x4d82, 0x509c, 0x54b7, 0x636c, 0x6687, 0x6aa2, 0x6dbc, 
-     0x7c72, 0x7f8c, 0x83a7, 0x86c2, 0x9577, 0x9892, 0x9cac, 0x9fc7, 
-     0xae7c, 0xb297, 0xb5b2, 0xb8cc, 0xc781, 0xcb9c, 0xceb7, 0xd1d2 
+     0x3c3c, 0x3657, 0x3173, 0x2b8f, 0x5546, 0x4f61, 0x4a7d, 0x4499, 
+     0x6e50, 0x686c, 0x6387, 0x5da3, 0x875a, 0x8176, 0x7c92, 0x76ad, 
+     0xa064, 0x9a80, 0x959c, 0x8fb7, 0xb96e, 0xb38a, 0xaea6, 0xa8c2, 
+     0xd279, 0xcc94, 0xc7b0, 0xc1cc, 0xeb83, 0xe59f, 0xe0ba, 0xdad6, 
+     0x3a3b, 0x3557, 0x2f72, 0x2a8e, 0x5345, 0x4e61, 0x487d, 0x4398, 
+     0x6c4f, 0x676b, 0x6187, 0x5ca2, 0x8559, 0x8075, 0x7a91, 0x75ad, 
+     0x9e64, 0x997f, 0x939b, 0x8eb7, 0xb86e, 0xb28a, 0xada5, 0xa7c1, 
+     0xd178, 0xcb94, 0xc6af, 0xc0cb, 0xea82, 0xe49e, 0xdfba, 0xd9d5, 
+     0x393a, 0x3356, 0x2e72, 0x288d, 0x5244, 0x4d60, 0x477c, 0x4298, 
+     0x6b4f, 0x666a, 0x6086, 0x5ba2, 0x8459, 0x7f75, 0x7990, 0x74ac, 
+     0x9d63, 0x987f, 0x929a, 0x8db6, 0xb66d, 0xb189, 0xaba5, 0xa6c0, 
+     0xcf77, 0xca93, 0xc4af, 0xbfcb, 0xe882, 0xe39d, 0xddb9, 0xd8d5, 
+     0x383a, 0x3255, 0x2d71, 0x278d, 0x5144, 0x4b5f, 0x467b, 0x4097, 
+     0x6a4e, 0x646a, 0x5f85, 0x59a1, 0x8358, 0x7d74, 0x7890, 0x72ab, 
+     0x9c62, 0x967e, 0x919a, 0x8bb6, 0xb56d, 0xaf88, 0xaaa4, 0xa4c0, 
+     0xce77, 0xc992, 0xc3ae, 0xbeca, 0xe781, 0xe29d, 0xdcb8, 0xd7d4, 
+     0x3639, 0x3155, 0x2b70, 0x268c, 0x4f43, 0x4a5f, 0x447b, 0x3f96, 
+     0x694d, 0x6369, 0x5e85, 0x58a0, 0x8257, 0x7c73, 0x778f, 0x71ab, 
+     0x9b62, 0x957d, 0x9099, 0x8ab5, 0xb46c, 0xae88, 0xa9a3, 0xa3bf, 
+     0xcd76, 0xc792, 0xc2ae, 0xbcc9, 0xe680, 0xe09c, 0xdbb8, 0xd5d3, 
+     0x3538, 0x3054, 0x2a70, 0x258b, 0x4e42, 0x495e, 0x437a, 0x3e96, 
+     0x674d, 0x6268, 0x5c84, 0x57a0, 0x8057, 0x7b73, 0x758e, 0x70aa, 
+     0x9961, 0x947d, 0x8e98, 0x89b4, 0xb26b, 0xad87, 0xa7a3, 0xa2be, 
+     0xcb75, 0xc691, 0xc0ad, 0xbbc9, 0xe580, 0xdf9b, 0xdab7, 0xd4d3, 
+     0x3438, 0x2e53, 0x296f, 0x238b, 0x4d42, 0x475e, 0x4279, 0x3c95, 
+     0x664c, 0x6068, 0x5b83, 0x559f, 0x7f56, 0x7a72, 0x748e, 0x6fa9, 
+     0x9860, 0x937c, 0x8d98, 0x88b4, 0xb16b, 0xac86, 0xa6a2, 0xa1be, 
+     0xca75, 0xc590, 0xbfac, 0xbac8, 0xe37f, 0xde9b, 0xd8b6, 0xd3d2, 
+     0x3337, 0x2d53, 0x286e, 0x228a, 0x4c41, 0x465d, 0x4179, 0x3b94, 
+     0x654b, 0x5f67, 0x5a83, 0x549f, 0x7e56, 0x7871, 0x738d, 0x6da9, 
+     0x9760, 0x917b, 0x8c97, 0x86b3, 0xb06a, 0xaa86, 0xa5a1, 0x9fbd, 
+     0xc974, 0xc390, 0xbeac, 0xb8c7, 0xe27e, 0xdc9a, 0xd7b6, 0xd1d1 
   }, { 
-     0x3c3c, 0x532e, 0x6a20, 0x8212, 0x3e45, 0x5537, 0x6d29, 0x841b, 
-     0x404f, 0x5841, 0x6f33, 0x8725, 0x4359, 0x5a4b, 0x723d, 0x892f, 
-     0x4563, 0x5d55, 0x7447, 0x8c39, 0x486d, 0x5f5f, 0x7751, 0x8e43, 
-     0x4a76, 0x6268, 0x795a, 0x914c, 0x4d80, 0x6472, 0x7c64, 0x9356, 
-     0x444d, 0x5c3f, 0x7331, 0x8b23, 0x4757, 0x5e49, 0x763b, 0x8d2d, 
-     0x4961, 0x6153, 0x7845, 0x9037, 0x4c6b, 0x635d, 0x7b4f, 0x9241, 
-     0x4e74, 0x6666, 0x7d58, 0x954a, 0x517e, 0x6870, 0x8062, 0x9754, 
-     0x5388, 0x6b7a, 0x826c, 0x9a5e, 0x5692, 0x6d84, 0x8576, 0x9c68, 
-     0x4d5f, 0x6551, 0x7c43, 0x9435, 0x5069, 0x675b, 0x7f4d, 0x963f, 
-     0x5272, 0x6a64, 0x8156, 0x9948, 0x557c, 0x6c6e, 0x8460, 0x9b52, 
-     0x5786, 0x6f78, 0x866a, 0x9e5c, 0x5a90, 0x7182, 0x8974, 0xa066, 
-     0x5c9a, 0x748c, 0x8b7e, 0xa270, 0x5fa3, 0x7695, 0x8d87, 0xa579, 
-     0x5670, 0x6e62, 0x8554, 0x9d46, 0x597a, 0x706c, 0x885e, 0x9f50, 
-     0x5b84, 0x7376, 0x8a68, 0xa25a, 0x5e8e, 0x7580, 0x8d72, 0xa464, 
-     0x6098, 0x788a, 0x8f7c, 0xa66e, 0x63a1, 0x7a93, 0x9185, 0xa977, 
-     0x65ab, 0x7c9d, 0x948f, 0xab81, 0x67b5, 0x7fa7, 0x9699, 0xae8b, 
-     0x5f82, 0x7774, 0x8e66, 0xa658, 0x628c, 0x797e, 0x9170, 0xa862, 
-     0x6496, 0x7c88, 0x937a, 0xaa6c, 0x679f, 0x7e91, 0x9583, 0xad75, 
-     0x69a9, 0x809b, 0x988d, 0xaf7f, 0x6bb3, 0x83a5, 0x9a97, 0xb289, 
-     0x6ebd, 0x85af, 0x9da1, 0xb493, 0x70c7, 0x88b9, 0x9fab, 0xb79d, 
-     0x6894, 0x8086, 0x9778, 0xae6a, 0x6b9d, 0x828f, 0x9981, 0xb173, 
-     0x6da7, 0x8499, 0x9c8b, 0xb37d, 0x6fb1, 0x87a3, 0x9e95, 0xb687, 
-     0x72bb, 0x89ad, 0xa19f, 0xb891, 0x74c5, 0x8cb7, 0xa3a9, 0xbb9b, 
-     0x77ce, 0x8ec0, 0xa6b2, 0xbda4, 0x79d8, 0x91ca, 0xa8bc, 0xc0ae, 
-     0x71a5, 0x8897, 0xa089, 0xb77b, 0x73af, 0x8ba1, 0xa293, 0xba85, 
-     0x76b9, 0x8dab, 0xa59d, 0xbc8f, 0x78c3, 0x90b5, 0xa7a7, 0xbf99, 
-     0x7bcc, 0x92be, 0xaab0, 0xc1a2, 0x7dd6, 0x95c8, 0xacba, 0xc4ac, 
-     0x80e0, 0x97d2, 0xafc4, 0xc6b6, 0x82ea, 0x9adc, 0xb1ce, 0xc9c0, 
-     0x7ab7, 0x91a9, 0xa99b, 0xc08d, 0x7cc1, 0x94b3, 0xaba5, 0xc397, 
-     0x7fca, 0x96bc, 0xaeae, 0xc5a0, 0x81d4, 0x99c6, 0xb0b8, 0xc8aa, 
-     0x84de, 0x9bd0, 0xb3c2, 0xcab4, 0x86e8, 0x9eda, 0xb5cc, 0xcdbe, 
-     0x89f2, 0xa0e4, 0xb8d6, 0xcfc8, 0x8bfb, 0xa3ed, 0xbadf, 0xd2d2 
+     0x3c3c, 0x5734, 0x722c, 0x8d24, 0x4240, 0x5d39, 0x7931, 0x9429, 
+     0x4845, 0x643e, 0x7f36, 0x9a2e, 0x4f4a, 0x6a43, 0x853b, 0xa133, 
+     0x554f, 0x7148, 0x8c40, 0xa738, 0x5c54, 0x774d, 0x9245, 0xae3d, 
+     0x6259, 0x7d52, 0x994a, 0xb442, 0x695e, 0x8457, 0x9f4f, 0xbb47, 
+     0x3f4f, 0x5a47, 0x7540, 0x9138, 0x4554, 0x614c, 0x7c45, 0x973d, 
+     0x4c59, 0x6751, 0x824a, 0x9e42, 0x525e, 0x6d56, 0x894f, 0xa447, 
+     0x5963, 0x745b, 0x8f54, 0xaa4c, 0x5f68, 0x7a60, 0x9659, 0xb151, 
+     0x656d, 0x8165, 0x9c5e, 0xb756, 0x6c72, 0x876a, 0xa363, 0xbe5b, 
+     0x4263, 0x5d5b, 0x7953, 0x944c, 0x4968, 0x6460, 0x7f58, 0x9a51, 
+     0x4f6d, 0x6a65, 0x865d, 0xa156, 0x5572, 0x716a, 0x8c62, 0xa75b, 
+     0x5c77, 0x776f, 0x9267, 0xae60, 0x627c, 0x7e74, 0x996c, 0xb465, 
+     0x6981, 0x8479, 0x9f71, 0xbb6a, 0x6f86, 0x8a7e, 0xa676, 0xc16f, 
+     0x4577, 0x616f, 0x7c67, 0x975f, 0x4c7c, 0x6774, 0x826c, 0x9e64, 
+     0x5281, 0x6e79, 0x8971, 0xa469, 0x5986, 0x747e, 0x8f76, 0xab6e, 
+     0x5f8b, 0x7a83, 0x967b, 0xb173, 0x6690, 0x8188, 0x9c80, 0xb778, 
+     0x6c95, 0x878d, 0xa385, 0xbe7d, 0x729a, 0x8e92, 0xa98a, 0xc482, 
+     0x498b, 0x6483, 0x7f7b, 0x9b73, 0x4f90, 0x6a88, 0x8680, 0xa178, 
+     0x5695, 0x718d, 0x8c85, 0xa77d, 0x5c9a, 0x7792, 0x938a, 0xae82, 
+     0x629f, 0x7e97, 0x998f, 0xb487, 0x69a4, 0x849c, 0x9f94, 0xbb8c, 
+     0x6fa9, 0x8ba1, 0xa699, 0xc191, 0x76ae, 0x91a6, 0xac9e, 0xc896, 
+     0x4c9e, 0x6797, 0x838f, 0x9e87, 0x52a3, 0x6e9c, 0x8994, 0xa48c, 
+     0x59a8, 0x74a1, 0x8f99, 0xab91, 0x5fad, 0x7ba6, 0x969e, 0xb196, 
+     0x66b2, 0x81ab, 0x9ca3, 0xb89b, 0x6cb7, 0x87b0, 0xa3a8, 0xbea0, 
+     0x73bc, 0x8eb5, 0xa9ad, 0xc4a5, 0x79c1, 0x94ba, 0xb0b2, 0xcbaa, 
+     0x4fb2, 0x6aaa, 0x86a3, 0xa19b, 0x56b7, 0x71af, 0x8ca8, 0xa8a0, 
+     0x5cbc, 0x77b4, 0x93ad, 0xaea5, 0x63c1, 0x7eb9, 0x99b2, 0xb4aa, 
+     0x69c6, 0x84be, 0xa0b7, 0xbbaf, 0x6fcb, 0x8bc3, 0xa6bc, 0xc1b4, 
+     0x76d0, 0x91c8, 0xacc1, 0xc8b9, 0x7cd5, 0x98cd, 0xb3c6, 0xcebe, 
+     0x52c6, 0x6ebe, 0x89b6, 0xa4af, 0x59cb, 0x74c3, 0x90bb, 0xabb4, 
+     0x5fd0, 0x7bc8, 0x96c0, 0xb1b9, 0x66d5, 0x81cd, 0x9cc5, 0xb8be, 
+     0x6cda, 0x88d2, 0xa3ca, 0xbec3, 0x73df, 0x8ed7, 0xa9cf, 0xc5c8, 
+     0x79e4, 0x94dc, 0xb0d4, 0xcbcd, 0x80e9, 0x9be1, 0xb6d9, 0xd2d2 
   }, { 
-     0x3c3c, 0x2b46, 0x1b50, 0x0a5b, 0x4953, 0x395e, 0x2968, 0x1872, 
-     0x576b, 0x4775, 0x3680, 0x268a, 0x6583, 0x548d, 0x4497, 0x34a2, 
-     0x739b, 0x62a5, 0x52af, 0x41ba, 0x80b2, 0x70bd, 0x60c7, 0x4fd1, 
-     0x8eca, 0x7ed4, 0x6ddf, 0x5de9, 0x9ce2, 0x8cec, 0x7bf7, 0x6bff, 
-     0x4a35, 0x3a3f, 0x2949, 0x1954, 0x584c, 0x4857, 0x3761, 0x276c, 
-     0x6664, 0x556f, 0x4579, 0x3583, 0x747c, 0x6386, 0x5391, 0x429b, 
-     0x8194, 0x719e, 0x61a8, 0x50b3, 0x8fac, 0x7fb6, 0x6ec0, 0x5ecb, 
-     0x9dc3, 0x8cce, 0x7cd8, 0x6ce2, 0xabdb, 0x9ae5, 0x8af0, 0x79fa, 
-     0x592e, 0x4838, 0x3843, 0x284d, 0x6746, 0x5650, 0x465a, 0x3565, 
-     0x745d, 0x6468, 0x5472, 0x437d, 0x8275, 0x7280, 0x618a, 0x5194, 
-     0x908d, 0x8097, 0x6fa2, 0x5fac, 0x9ea5, 0x8daf, 0x7db9, 0x6dc4, 
-     0xacbd, 0x9bc7, 0x8bd1, 0x7adc, 0xb9d4, 0xa9df, 0x99e9, 0x88f3, 
-     0x6827, 0x5732, 0x473c, 0x3646, 0x753f, 0x6549, 0x5554, 0x445e, 
-     0x8357, 0x7361, 0x626b, 0x5276, 0x916e, 0x8079, 0x7083, 0x608e, 
-     0x9f86, 0x8e91, 0x7e9b, 0x6da5, 0xac9e, 0x9ca8, 0x8cb3, 0x7bbd, 
-     0xbab6, 0xaac0, 0x99ca, 0x89d5, 0xc8ce, 0xb8d8, 0xa7e2, 0x97ed, 
-     0x7620, 0x662b, 0x5535, 0x453f, 0x8438, 0x7443, 0x634d, 0x5357, 
-     0x9250, 0x815a, 0x7165, 0x616f, 0xa068, 0x8f72, 0x7f7c, 0x6e87, 
-     0xad7f, 0x9d8a, 0x8d94, 0x7c9f, 0xbb97, 0xaba2, 0x9aac, 0x8ab6, 
-     0xc9af, 0xb8b9, 0xa8c4, 0x98ce, 0xd7c7, 0xc6d1, 0xb6db, 0xa5e6, 
-     0x851a, 0x7424, 0x642e, 0x5439, 0x9331, 0x823c, 0x7246, 0x6150, 
-     0xa049, 0x9054, 0x805e, 0x6f68, 0xae61, 0x9e6b, 0x8d76, 0x7d80, 
-     0xbc79, 0xac83, 0x9b8d, 0x8b98, 0xca90, 0xb99b, 0xa9a5, 0x99b0, 
-     0xd8a8, 0xc7b3, 0xb7bd, 0xa6c7, 0xe5c0, 0xd5ca, 0xc5d5, 0xb4df, 
-     0x9413, 0x831d, 0x7328, 0x6232, 0xa12b, 0x9135, 0x813f, 0x704a, 
-     0xaf42, 0x9f4d, 0x8e57, 0x7e61, 0xbd5a, 0xac65, 0x9c6f, 0x8c79, 
-     0xcb72, 0xba7c, 0xaa87, 0x9991, 0xd88a, 0xc894, 0xb89e, 0xa7a9, 
-     0xe6a1, 0xd6ac, 0xc5b6, 0xb5c1, 0xf4b9, 0xe4c4, 0xd3ce, 0xc3d8, 
-     0xa20c, 0x9216, 0x8121, 0x712b, 0xb024, 0xa02e, 0x8f39, 0x7f43, 
-     0xbe3c, 0xad46, 0x9d50, 0x8d5b, 0xcc53, 0xbb5e, 0xab68, 0x9a72, 
-     0xd96b, 0xc976, 0xb980, 0xa88a, 0xe783, 0xd78d, 0xc698, 0xb6a2, 
-     0xf59b, 0xe4a5, 0xd4af, 0xc4ba, 0xffb2, 0xf2bd, 0xe2c7, 0xd1d1 
+     0x3c3c, 0x2f3d, 0x223e, 0x153f, 0x4455, 0x3756, 0x2b57, 0x1e58, 
+     0x4d6e, 0x406f, 0x3370, 0x2671, 0x5587, 0x4889, 0x3c8a, 0x2f8b, 
+     0x5ea1, 0x51a2, 0x44a3, 0x38a4, 0x66ba, 0x59bb, 0x4dbc, 0x40bd, 
+     0x6fd3, 0x62d5, 0x55d6, 0x49d7, 0x77ed, 0x6aee, 0x5eef, 0x51f0, 
+     0x4e37, 0x4138, 0x3439, 0x283a, 0x5650, 0x4a52, 0x3d53, 0x3054, 
+     0x5f6a, 0x526b, 0x466c, 0x396d, 0x6783, 0x5b84, 0x4e85, 0x4186, 
+     0x709c, 0x639e, 0x579f, 0x4aa0, 0x78b6, 0x6cb7, 0x5fb8, 0x52b9, 
+     0x81cf, 0x74d0, 0x68d1, 0x5bd2, 0x89e8, 0x7de9, 0x70eb, 0x63ec, 
+     0x6033, 0x5434, 0x4735, 0x3a36, 0x694c, 0x5c4d, 0x4f4e, 0x434f, 
+     0x7165, 0x6567, 0x5868, 0x4b69, 0x7a7f, 0x6d80, 0x6081, 0x5482, 
+     0x8298, 0x7699, 0x699a, 0x5c9b, 0x8bb1, 0x7eb2, 0x71b4, 0x65b5, 
+     0x93cb, 0x87cc, 0x7acd, 0x6dce, 0x9ce4, 0x8fe5, 0x82e6, 0x76e7, 
+     0x732e, 0x6630, 0x5931, 0x4c32, 0x7b48, 0x6e49, 0x624a, 0x554b, 
+     0x8461, 0x7762, 0x6a63, 0x5e64, 0x8c7a, 0x7f7b, 0x737d, 0x667e, 
+     0x9594, 0x8895, 0x7b96, 0x6f97, 0x9dad, 0x90ae, 0x84af, 0x77b0, 
+     0xa6c6, 0x99c7, 0x8cc9, 0x80ca, 0xaee0, 0xa1e1, 0x95e2, 0x88e3, 
+     0x852a, 0x782b, 0x6c2c, 0x5f2d, 0x8d43, 0x8144, 0x7446, 0x6747, 
+     0x965d, 0x895e, 0x7d5f, 0x7060, 0x9e76, 0x9277, 0x8578, 0x7879, 
+     0xa78f, 0x9a90, 0x8e92, 0x8193, 0xafa9, 0xa3aa, 0x96ab, 0x89ac, 
+     0xb8c2, 0xabc3, 0x9fc4, 0x92c5, 0xc1db, 0xb4dc, 0xa7dd, 0x9adf, 
+     0x9726, 0x8b27, 0x7e28, 0x7129, 0xa03f, 0x9340, 0x8641, 0x7a42, 
+     0xa858, 0x9c59, 0x8f5b, 0x825c, 0xb172, 0xa473, 0x9774, 0x8b75, 
+     0xb98b, 0xad8c, 0xa08d, 0x938e, 0xc2a4, 0xb5a5, 0xa8a6, 0x9ca8, 
+     0xcabe, 0xbebf, 0xb1c0, 0xa4c1, 0xd3d7, 0xc6d8, 0xb9d9, 0xadda, 
+     0xaa21, 0x9d22, 0x9024, 0x8425, 0xb23b, 0xa53c, 0x993d, 0x8c3e, 
+     0xbb54, 0xae55, 0xa156, 0x9557, 0xc36d, 0xb66e, 0xaa6f, 0x9d71, 
+     0xcc87, 0xbf88, 0xb289, 0xa68a, 0xd4a0, 0xc7a1, 0xbba2, 0xaea3, 
+     0xddb9, 0xd0ba, 0xc3bb, 0xb7bd, 0xe5d3, 0xd9d4, 0xccd5, 0xbfd6, 
+     0xbc1d, 0xaf1e, 0xa31f, 0x9620, 0xc436, 0xb837, 0xab38, 0x9e3a, 
+     0xcd50, 0xc051, 0xb452, 0xa753, 0xd569, 0xc96a, 0xbc6b, 0xaf6c, 
+     0xde82, 0xd183, 0xc584, 0xb886, 0xe79c, 0xda9d, 0xcd9e, 0xc09f, 
+     0xefb5, 0xe2b6, 0xd6b7, 0xc9b8, 0xf8ce, 0xebcf, 0xded0, 0xd2d1 
   }, { 
-     0x3c3c, 0x4c4e, 0x5d60, 0x6e73, 0x513c, 0x624f, 0x7261, 0x8373, 
-     0x663d, 0x774f, 0x8862, 0x9974, 0x7b3d, 0x8c50, 0x9d62, 0xae75, 
-     0x913e, 0xa250, 0xb263, 0xc375, 0xa63e, 0xb751, 0xc863, 0xd976, 
-     0xbb3f, 0xcc52, 0xdd64, 0xee76, 0xd140, 0xe252, 0xf265, 0xff77, 
-     0x3448, 0x455b, 0x566d, 0x6780, 0x4a49, 0x5b5b, 0x6b6e, 0x7c80, 
-     0x5f4a, 0x705c, 0x816f, 0x9281, 0x744a, 0x855d, 0x966f, 0xa782, 
-     0x8a4b, 0x9a5d, 0xab70, 0xbc82, 0x9f4b, 0xb05e, 0xc170, 0xd183, 
-     0xb44c, 0xc55e, 0xd671, 0xe783, 0xca4d, 0xda5f, 0xeb72, 0xfc84, 
-     0x2d55, 0x3e68, 0x4f7a, 0x608d, 0x4356, 0x5368, 0x647b, 0x758d, 
-     0x5857, 0x6969, 0x7a7b, 0x8a8e, 0x6d57, 0x7e6a, 0x8f7c, 0xa08f, 
-     0x8358, 0x936a, 0xa47d, 0xb58f, 0x9858, 0xa96b, 0xba7d, 0xca90, 
-     0xad59, 0xbe6b, 0xcf7e, 0xe090, 0xc25a, 0xd36c, 0xe47e, 0xf591, 
-     0x2662, 0x3775, 0x4887, 0x599a, 0x3c63, 0x4c75, 0x5d88, 0x6e9a, 
-     0x5163, 0x6276, 0x7388, 0x839b, 0x6664, 0x7777, 0x8889, 0x999b, 
-     0x7b65, 0x8c77, 0x9d8a, 0xae9c, 0x9165, 0xa278, 0xb28a, 0xc39d, 
-     0xa666, 0xb778, 0xc88b, 0xd99d, 0xbb66, 0xcc79, 0xdd8b, 0xee9e, 
-     0x1f6f, 0x3082, 0x4194, 0x52a7, 0x3470, 0x4582, 0x5695, 0x67a7, 
-     0x4a70, 0x5b83, 0x6b95, 0x7ca8, 0x5f71, 0x7083, 0x8196, 0x92a8, 
-     0x7472, 0x8584, 0x9696, 0xa7a9, 0x8a72, 0x9a85, 0xab97, 0xbcaa, 
-     0x9f73, 0xb085, 0xc198, 0xd1aa, 0xb473, 0xc586, 0xd698, 0xe7ab, 
-     0x187c, 0x298f, 0x3aa1, 0x4bb3, 0x2d7d, 0x3e8f, 0x4fa2, 0x60b4, 
-     0x437d, 0x5390, 0x64a2, 0x75b5, 0x587e, 0x6990, 0x7aa3, 0x8ab5, 
-     0x6d7e, 0x7e91, 0x8fa3, 0xa0b6, 0x837f, 0x9392, 0xa4a4, 0xb5b6, 
-     0x9880, 0xa992, 0xbaa5, 0xcab7, 0xad80, 0xbe93, 0xcfa5, 0xe0b8, 
-     0x1189, 0x229b, 0x33ae, 0x43c0, 0x268a, 0x379c, 0x48af, 0x59c1, 
-     0x3c8a, 0x4c9d, 0x5daf, 0x6ec2, 0x518b, 0x629d, 0x73b0, 0x83c2, 
-     0x668b, 0x779e, 0x88b0, 0x99c3, 0x7b8c, 0x8c9e, 0x9db1, 0xaec3, 
-     0x918d, 0xa29f, 0xb2b2, 0xc3c4, 0xa68d, 0xb7a0, 0xc8b2, 0xd9c5, 
-     0x0a96, 0x1ba8, 0x2bbb, 0x3ccd, 0x1f97, 0x30a9, 0x41bb, 0x52ce, 
-     0x3497, 0x45aa, 0x56bc, 0x67cf, 0x4a98, 0x5baa, 0x6bbd, 0x7ccf, 
-     0x5f98, 0x70ab, 0x81bd, 0x92d0, 0x7499, 0x85ab, 0x96be, 0xa7d0, 
-     0x8a9a, 0x9bac, 0xabbe, 0xbcd1, 0x9f9a, 0xb0ad, 0xc1bf, 0xd1d2 
+     0x3c3c, 0x4454, 0x4c6d, 0x5486, 0x543f, 0x5c58, 0x6470, 0x6c89, 
+     0x6c42, 0x745b, 0x7c74, 0x848c, 0x8545, 0x8d5e, 0x9577, 0x9d90, 
+     0x9d49, 0xa561, 0xad7a, 0xb593, 0xb54c, 0xbd65, 0xc57e, 0xcd96, 
+     0xce4f, 0xd668, 0xde81, 0xe69a, 0xe653, 0xee6b, 0xf684, 0xfe9d, 
+     0x3543, 0x3d5c, 0x4574, 0x4d8d, 0x4d46, 0x565f, 0x5e78, 0x6691, 
+     0x664a, 0x6e62, 0x767b, 0x7e94, 0x7e4d, 0x8666, 0x8e7e, 0x9697, 
+     0x9750, 0x9f69, 0xa782, 0xaf9a, 0xaf54, 0xb76c, 0xbf85, 0xc79e, 
+     0xc757, 0xcf70, 0xd788, 0xdfa1, 0xe05a, 0xe873, 0xf08c, 0xf8a4, 
+     0x2f4b, 0x3763, 0x3f7c, 0x4795, 0x474e, 0x4f67, 0x577f, 0x5f98, 
+     0x5f51, 0x686a, 0x7083, 0x789b, 0x7854, 0x806d, 0x8886, 0x909f, 
+     0x9058, 0x9871, 0xa089, 0xa8a2, 0xa95b, 0xb174, 0xb98d, 0xc1a5, 
+     0xc15e, 0xc977, 0xd190, 0xd9a9, 0xd962, 0xe17a, 0xe993, 0xf1ac, 
+     0x2852, 0x306b, 0x3884, 0x409c, 0x4155, 0x496e, 0x5187, 0x59a0, 
+     0x5959, 0x6171, 0x698a, 0x71a3, 0x715c, 0x7975, 0x828d, 0x8aa6, 
+     0x8a5f, 0x9278, 0x9a91, 0xa2aa, 0xa263, 0xaa7b, 0xb294, 0xbaad, 
+     0xbb66, 0xc37f, 0xcb97, 0xd3b0, 0xd369, 0xdb82, 0xe39b, 0xebb3, 
+     0x225a, 0x2a72, 0x328b, 0x3aa4, 0x3a5d, 0x4276, 0x4a8e, 0x52a7, 
+     0x5360, 0x5b79, 0x6392, 0x6baa, 0x6b63, 0x737c, 0x7b95, 0x83ae, 
+     0x8367, 0x8b80, 0x9498, 0x9cb1, 0x9c6a, 0xa483, 0xac9c, 0xb4b4, 
+     0xb46d, 0xbc86, 0xc49f, 0xccb8, 0xcd71, 0xd589, 0xdda2, 0xe5bb, 
+     0x1c61, 0x247a, 0x2c93, 0x34ab, 0x3464, 0x3c7d, 0x4496, 0x4caf, 
+     0x4c68, 0x5480, 0x5c99, 0x64b2, 0x656b, 0x6d84, 0x759c, 0x7db5, 
+     0x7d6e, 0x8587, 0x8da0, 0x95b9, 0x9572, 0x9d8a, 0xa5a3, 0xaebc, 
+     0xae75, 0xb68e, 0xbea6, 0xc6bf, 0xc678, 0xce91, 0xd6aa, 0xdec2, 
+     0x1569, 0x1d81, 0x259a, 0x2db3, 0x2e6c, 0x3685, 0x3e9d, 0x46b6, 
+     0x466f, 0x4e88, 0x56a1, 0x5eb9, 0x5e73, 0x668b, 0x6ea4, 0x76bd, 
+     0x7776, 0x7f8f, 0x87a7, 0x8fc0, 0x8f79, 0x9792, 0x9fab, 0xa7c3, 
+     0xa77c, 0xaf95, 0xb7ae, 0xc0c7, 0xc080, 0xc899, 0xd0b1, 0xd8ca, 
+     0x0f70, 0x1789, 0x1fa2, 0x27ba, 0x2773, 0x2f8c, 0x37a5, 0x3fbe, 
+     0x4077, 0x488f, 0x50a8, 0x58c1, 0x587a, 0x6093, 0x68ac, 0x70c4, 
+     0x707d, 0x7896, 0x80af, 0x88c8, 0x8981, 0x9199, 0x99b2, 0xa1cb, 
+     0xa184, 0xa99d, 0xb1b5, 0xb9ce, 0xb987, 0xc1a0, 0xc9b9, 0xd1d2 
   }, { 
-     0x3c3c, 0x482b, 0x541a, 0x6009, 0x3b4d, 0x483c, 0x542c, 0x601b, 
-     0x3b5f, 0x484e, 0x543d, 0x602d, 0x3b70, 0x4760, 0x544f, 0x603e, 
-     0x3b82, 0x4771, 0x5461, 0x6050, 0x3b94, 0x4783, 0x5372, 0x6062, 
-     0x3ba5, 0x4795, 0x5384, 0x6073, 0x3bb7, 0x47a6, 0x5396, 0x6085, 
-     0x4c46, 0x5836, 0x6425, 0x7014, 0x4c58, 0x5847, 0x6437, 0x7026, 
-     0x4c6a, 0x5859, 0x6448, 0x7038, 0x4c7b, 0x586b, 0x645a, 0x7049, 
-     0x4b8d, 0x587c, 0x646c, 0x705b, 0x4b9f, 0x588e, 0x647d, 0x706d, 
-     0x4bb0, 0x57a0, 0x648f, 0x707e, 0x4bc2, 0x57b1, 0x64a1, 0x7090, 
-     0x5c51, 0x6841, 0x7430, 0x811f, 0x5c63, 0x6852, 0x7442, 0x8131, 
-     0x5c75, 0x6864, 0x7453, 0x8143, 0x5c86, 0x6876, 0x7465, 0x8054, 
-     0x5c98, 0x6887, 0x7477, 0x8066, 0x5caa, 0x6899, 0x7488, 0x8078, 
-     0x5cbb, 0x68ab, 0x749a, 0x8089, 0x5bcd, 0x68bc, 0x74ab, 0x809b, 
-     0x6c5c, 0x794c, 0x853b, 0x912a, 0x6c6e, 0x785d, 0x854d, 0x913c, 
-     0x6c80, 0x786f, 0x855e, 0x914e, 0x6c91, 0x7881, 0x8570, 0x915f, 
-     0x6ca3, 0x7892, 0x8482, 0x9171, 0x6cb5, 0x78a4, 0x8493, 0x9182, 
-     0x6cc6, 0x78b5, 0x84a5, 0x9094, 0x6cd8, 0x78c7, 0x84b6, 0x90a6, 
-     0x7d67, 0x8957, 0x9546, 0xa135, 0x7d79, 0x8968, 0x9558, 0xa147, 
-     0x7c8b, 0x897a, 0x9569, 0xa158, 0x7c9c, 0x898b, 0x957b, 0xa16a, 
-     0x7cae, 0x889d, 0x958c, 0xa17c, 0x7cbf, 0x88af, 0x959e, 0xa18d, 
-     0x7cd1, 0x88c0, 0x95b0, 0xa19f, 0x7ce3, 0x88d2, 0x94c1, 0xa1b1, 
-     0x8d72, 0x9962, 0xa551, 0xb240, 0x8d84, 0x9973, 0xa562, 0xb152, 
-     0x8d95, 0x9985, 0xa574, 0xb163, 0x8da7, 0x9996, 0xa586, 0xb175, 
-     0x8db9, 0x99a8, 0xa597, 0xb187, 0x8cca, 0x99ba, 0xa5a9, 0xb198, 
-     0x8cdc, 0x99cb, 0xa5bb, 0xb1aa, 0x8cee, 0x99dd, 0xa5cc, 0xb1bc, 
-     0x9d7d, 0xa96c, 0xb65c, 0xc24b, 0x9d8f, 0xa97e, 0xb66d, 0xc25d, 
-     0x9da0, 0xa990, 0xb57f, 0xc26e, 0x9db2, 0xa9a1, 0xb591, 0xc280, 
-     0x9dc4, 0xa9b3, 0xb5a2, 0xc192, 0x9dd5, 0xa9c5, 0xb5b4, 0xc1a3, 
-     0x9de7, 0xa9d6, 0xb5c6, 0xc1b5, 0x9df9, 0xa9e8, 0xb5d7, 0xc1c7, 
-     0xad88, 0xba77, 0xc667, 0xd256, 0xad9a, 0xba89, 0xc678, 0xd268, 
-     0xadab, 0xba9b, 0xc68a, 0xd279, 0xadbd, 0xb9ac, 0xc69c, 0xd28b, 
-     0xadcf, 0xb9be, 0xc6ad, 0xd29d, 0xade0, 0xb9d0, 0xc5bf, 0xd2ae, 
-     0xadf2, 0xb9e1, 0xc5d1, 0xd2c0, 0xadff, 0xb9f3, 0xc5e2, 0xd2d1 
+     0x3c3c, 0x502c, 0x641c, 0x780c, 0x3d48, 0x5138, 0x6528, 0x7919, 
+     0x3e54, 0x5245, 0x6635, 0x7b25, 0x3f61, 0x5351, 0x6741, 0x7c31, 
+     0x406d, 0x545d, 0x684e, 0x7d3e, 0x417a, 0x556a, 0x6a5a, 0x7e4a, 
+     0x4286, 0x5676, 0x6b67, 0x7f57, 0x4393, 0x5783, 0x6c73, 0x8063, 
+     0x474b, 0x5b3b, 0x702c, 0x841c, 0x4858, 0x5d48, 0x7138, 0x8528, 
+     0x4964, 0x5e54, 0x7245, 0x8635, 0x4a71, 0x5f61, 0x7351, 0x8741, 
+     0x4c7d, 0x606d, 0x745d, 0x884e, 0x4d89, 0x617a, 0x756a, 0x895a, 
+     0x4e96, 0x6286, 0x7676, 0x8b67, 0x4fa2, 0x6393, 0x7783, 0x8c73, 
+     0x535b, 0x674b, 0x7b3b, 0x902c, 0x5467, 0x6858, 0x7c48, 0x9138, 
+     0x5574, 0x6964, 0x7e54, 0x9244, 0x5680, 0x6a71, 0x7f61, 0x9351, 
+     0x578d, 0x6b7d, 0x806d, 0x945d, 0x5899, 0x6d89, 0x817a, 0x956a, 
+     0x59a6, 0x6e96, 0x8286, 0x9676, 0x5ab2, 0x6fa2, 0x8393, 0x9783, 
+     0x5e6b, 0x735b, 0x874b, 0x9b3b, 0x6077, 0x7467, 0x8858, 0x9c48, 
+     0x6184, 0x7574, 0x8964, 0x9d54, 0x6290, 0x7680, 0x8a70, 0x9f61, 
+     0x639d, 0x778d, 0x8b7d, 0xa06d, 0x64a9, 0x7899, 0x8c89, 0xa17a, 
+     0x65b5, 0x79a6, 0x8e96, 0xa286, 0x66c2, 0x7ab2, 0x8fa2, 0xa392, 
+     0x6a7b, 0x7e6b, 0x935b, 0xa74b, 0x6b87, 0x7f77, 0x9467, 0xa858, 
+     0x6c93, 0x8184, 0x9574, 0xa964, 0x6da0, 0x8290, 0x9680, 0xaa70, 
+     0x6eac, 0x839d, 0x978d, 0xab7d, 0x70b9, 0x84a9, 0x9899, 0xac89, 
+     0x71c5, 0x85b5, 0x99a6, 0xad96, 0x72d2, 0x86c2, 0x9ab2, 0xafa2, 
+     0x768a, 0x8a7a, 0x9e6b, 0xb35b, 0x7797, 0x8b87, 0x9f77, 0xb467, 
+     0x78a3, 0x8c93, 0xa084, 0xb574, 0x79b0, 0x8da0, 0xa290, 0xb680, 
+     0x7abc, 0x8eac, 0xa39c, 0xb78d, 0x7bc9, 0x8fb9, 0xa4a9, 0xb899, 
+     0x7cd5, 0x91c5, 0xa5b5, 0xb9a6, 0x7de1, 0x92d2, 0xa6c2, 0xbab2, 
+     0x819a, 0x968a, 0xaa7a, 0xbe6b, 0x82a6, 0x9797, 0xab87, 0xbf77, 
+     0x84b3, 0x98a3, 0xac93, 0xc084, 0x85bf, 0x99b0, 0xada0, 0xc190, 
+     0x86cc, 0x9abc, 0xaeac, 0xc39c, 0x87d8, 0x9bc8, 0xafb9, 0xc4a9, 
+     0x88e5, 0x9cd5, 0xb0c5, 0xc5b5, 0x89f1, 0x9de1, 0xb2d2, 0xc6c2, 
+     0x8daa, 0xa19a, 0xb68a, 0xca7a, 0x8eb6, 0xa2a6, 0xb797, 0xcb87, 
+     0x8fc3, 0xa3b3, 0xb8a3, 0xcc93, 0x90cf, 0xa5bf, 0xb9b0, 0xcda0, 
+     0x91dc, 0xa6cc, 0xbabc, 0xceac, 0x92e8, 0xa7d8, 0xbbc8, 0xcfb9, 
+     0x94f4, 0xa8e5, 0xbcd5, 0xd0c5, 0x95ff, 0xa9f1, 0xbde1, 0xd2d1 
   }, { 
-     0x3c3c, 0x2d52, 0x1e68, 0x0f7e, 0x514e, 0x4264, 0x337a, 0x2490, 
-     0x6660, 0x5776, 0x488c, 0x39a2, 0x7b72, 0x6c88, 0x5d9e, 0x4eb4, 
-     0x9084, 0x819a, 0x72b0, 0x63c6, 0xa596, 0x96ac, 0x87c2, 0x78d8, 
-     0xbaa8, 0xabbe, 0x9cd4, 0x8dea, 0xcfba, 0xc0d0, 0xb1e6, 0xa2fc, 
-     0x4235, 0x334c, 0x2562, 0x1678, 0x5747, 0x485e, 0x3a74, 0x2b8a, 
-     0x6c59, 0x5d70, 0x4f86, 0x409c, 0x816b, 0x7282, 0x6498, 0x55ae, 
-     0x967d, 0x8894, 0x79aa, 0x6ac0, 0xab8f, 0x9da6, 0x8ebc, 0x7fd2, 
-     0xc0a1, 0xb2b8, 0xa3ce, 0x94e4, 0xd5b3, 0xc7ca, 0xb8e0, 0xa9f6, 
-     0x492f, 0x3a46, 0x2b5c, 0x1d72, 0x5e41, 0x4f58, 0x406e, 0x3284, 
-     0x7353, 0x646a, 0x5580, 0x4796, 0x8865, 0x797c, 0x6a92, 0x5ca8, 
-     0x9d77, 0x8e8e, 0x7fa4, 0x71ba, 0xb289, 0xa3a0, 0x94b6, 0x86cc, 
-     0xc79b, 0xb8b2, 0xa9c8, 0x9bde, 0xdcad, 0xcdc4, 0xbeda, 0xb0f0, 
-     0x5029, 0x413f, 0x3256, 0x236c, 0x653b, 0x5651, 0x4768, 0x387e, 
-     0x7a4d, 0x6b63, 0x5c7a, 0x4d90, 0x8f5f, 0x8075, 0x718c, 0x62a2, 
-     0xa471, 0x9587, 0x869e, 0x77b4, 0xb983, 0xaa99, 0x9bb0, 0x8cc6, 
-     0xce95, 0xbfab, 0xb0c2, 0xa1d8, 0xe3a7, 0xd4bd, 0xc5d4, 0xb6ea, 
-     0x5723, 0x4839, 0x3950, 0x2a66, 0x6c35, 0x5d4b, 0x4e62, 0x3f78, 
-     0x8147, 0x725d, 0x6374, 0x548a, 0x9659, 0x876f, 0x7886, 0x699c, 
-     0xab6b, 0x9c81, 0x8d98, 0x7eae, 0xc07d, 0xb193, 0xa2aa, 0x93c0, 
-     0xd58f, 0xc6a5, 0xb7bc, 0xa8d2, 0xeaa1, 0xdbb7, 0xccce, 0xbde4, 
-     0x5d1d, 0x4f33, 0x4049, 0x3160, 0x722f, 0x6445, 0x555b, 0x4672, 
-     0x8741, 0x7957, 0x6a6d, 0x5b84, 0x9c53, 0x8e69, 0x7f7f, 0x7096, 
-     0xb165, 0xa37b, 0x9491, 0x85a8, 0xc677, 0xb88d, 0xa9a3, 0x9aba, 
-     0xdb89, 0xcd9f, 0xbeb5, 0xafcc, 0xf09b, 0xe2b1, 0xd3c7, 0xc4de, 
-     0x6417, 0x552d, 0x4643, 0x385a, 0x7929, 0x6a3f, 0x5b55, 0x4d6c, 
-     0x8e3b, 0x7f51, 0x7067, 0x627e, 0xa34d, 0x9463, 0x8579, 0x7790, 
-     0xb85f, 0xa975, 0x9b8b, 0x8ca2, 0xcd71, 0xbe87, 0xb09d, 0xa1b4, 
-     0xe283, 0xd399, 0xc5af, 0xb6c6, 0xf795, 0xe8ab, 0xdac1, 0xcbd8, 
-     0x6b11, 0x5c27, 0x4d3d, 0x3e53, 0x8023, 0x7139, 0x624f, 0x5365, 
-     0x9535, 0x864b, 0x7761, 0x6877, 0xaa47, 0x9b5d, 0x8c73, 0x7d89, 
-     0xbf59, 0xb06f, 0xa185, 0x929b, 0xd46b, 0xc581, 0xb697, 0xa7ad, 
-     0xe97d, 0xda93, 0xcba9, 0xbcbf, 0xfe8f, 0xefa5, 0xe0bb, 0xd1d1 
+     0x3c3c, 0x2b4a, 0x1a59, 0x0968, 0x4c52, 0x3b61, 0x2a6f, 0x197e, 
+     0x5c68, 0x4b77, 0x3b86, 0x2a94, 0x6d7e, 0x5c8d, 0x4b9c, 0x3aab, 
+     0x7d94, 0x6ca3, 0x5bb2, 0x4bc1, 0x8dab, 0x7db9, 0x6cc8, 0x5bd7, 
+     0x9ec1, 0x8dd0, 0x7cde, 0x6bed, 0xaed7, 0x9de6, 0x8df5, 0x7cff, 
+     0x4834, 0x3743, 0x2652, 0x1561, 0x584b, 0x4759, 0x3668, 0x2677, 
+     0x6961, 0x5870, 0x477e, 0x368d, 0x7977, 0x6886, 0x5795, 0x46a3, 
+     0x898d, 0x789c, 0x68ab, 0x57ba, 0x9aa4, 0x89b2, 0x78c1, 0x67d0, 
+     0xaaba, 0x99c9, 0x88d7, 0x78e6, 0xbad0, 0xaadf, 0x99ee, 0x88fc, 
+     0x542d, 0x433c, 0x324b, 0x225a, 0x6443, 0x5452, 0x4361, 0x3270, 
+     0x755a, 0x6468, 0x5377, 0x4286, 0x8570, 0x747f, 0x648d, 0x539c, 
+     0x9686, 0x8595, 0x74a4, 0x63b2, 0xa69c, 0x95ab, 0x84ba, 0x73c9, 
+     0xb6b3, 0xa6c1, 0x95d0, 0x84df, 0xc7c9, 0xb6d8, 0xa5e6, 0x94f5, 
+     0x6026, 0x4f35, 0x3f44, 0x2e52, 0x713c, 0x604b, 0x4f5a, 0x3e69, 
+     0x8153, 0x7061, 0x5f70, 0x4f7f, 0x9169, 0x8178, 0x7086, 0x5f95, 
+     0xa27f, 0x918e, 0x809d, 0x6fab, 0xb295, 0xa1a4, 0x91b3, 0x80c2, 
+     0xc3ac, 0xb2ba, 0xa1c9, 0x90d8, 0xd3c2, 0xc2d1, 0xb1df, 0xa0ee, 
+     0x6d1f, 0x5c2e, 0x4b3c, 0x3a4b, 0x7d35, 0x6c44, 0x5b53, 0x4a61, 
+     0x8d4b, 0x7c5a, 0x6c69, 0x5b78, 0x9e62, 0x8d70, 0x7c7f, 0x6b8e, 
+     0xae78, 0x9d87, 0x8c95, 0x7ca4, 0xbe8e, 0xae9d, 0x9dac, 0x8cba, 
+     0xcfa4, 0xbeb3, 0xadc2, 0x9cd1, 0xdfbb, 0xcec9, 0xbed8, 0xade7, 
+     0x7918, 0x6827, 0x5735, 0x4644, 0x892e, 0x783d, 0x674c, 0x575a, 
+     0x9a44, 0x8953, 0x7862, 0x6771, 0xaa5b, 0x9969, 0x8878, 0x7787, 
+     0xba71, 0xa980, 0x998e, 0x889d, 0xcb87, 0xba96, 0xa9a5, 0x98b3, 
+     0xdb9d, 0xcaac, 0xb9bb, 0xa9ca, 0xebb3, 0xdbc2, 0xcad1, 0xb9e0, 
+     0x8511, 0x741f, 0x632e, 0x533d, 0x9527, 0x8536, 0x7444, 0x6353, 
+     0xa63d, 0x954c, 0x845b, 0x7369, 0xb653, 0xa562, 0x9571, 0x8480, 
+     0xc76a, 0xb678, 0xa587, 0x9496, 0xd780, 0xc68f, 0xb59d, 0xa4ac, 
+     0xe796, 0xd7a5, 0xc6b4, 0xb5c2, 0xf8ac, 0xe7bb, 0xd6ca, 0xc5d9, 
+     0x910a, 0x8018, 0x7027, 0x5f36, 0xa220, 0x912f, 0x803d, 0x6f4c, 
+     0xb236, 0xa145, 0x9054, 0x8062, 0xc24c, 0xb25b, 0xa16a, 0x9079, 
+     0xd362, 0xc271, 0xb180, 0xa08f, 0xe379, 0xd287, 0xc296, 0xb1a5, 
+     0xf48f, 0xe39e, 0xd2ac, 0xc1bb, 0xffa5, 0xf3b4, 0xe2c3, 0xd1d1 
   }, { 
-     0x3c3c, 0x5541, 0x6f46, 0x894b, 0x4a3c, 0x6441, 0x7e47, 0x984c, 
-     0x583c, 0x7242, 0x8c47, 0xa64c, 0x663d, 0x8042, 0x9a48, 0xb44d, 
-     0x743d, 0x8e43, 0xa848, 0xc24d, 0x823e, 0x9c43, 0xb648, 0xd04e, 
-     0x913e, 0xab44, 0xc449, 0xde4e, 0x9f3f, 0xb944, 0xd349, 0xed4f, 
-     0x384e, 0x5253, 0x6c59, 0x865e, 0x464f, 0x6054, 0x7a59, 0x945f, 
-     0x544f, 0x6e54, 0x885a, 0xa25f, 0x6250, 0x7c55, 0x965a, 0xb05f, 
-     0x7050, 0x8a55, 0xa45b, 0xbe60, 0x7e51, 0x9856, 0xb25b, 0xcc60, 
-     0x8d51, 0xa756, 0xc15c, 0xdb61, 0x9b51, 0xb557, 0xcf5c, 0xe961, 
-     0x3461, 0x4e66, 0x686b, 0x8271, 0x4261, 0x5c67, 0x766c, 0x9071, 
-     0x5062, 0x6a67, 0x846c, 0x9e72, 0x5e62, 0x7868, 0x926d, 0xac72, 
-     0x6c63, 0x8668, 0xa06d, 0xba73, 0x7b63, 0x9569, 0xaf6e, 0xc973, 
-     0x8964, 0xa369, 0xbd6e, 0xd774, 0x9764, 0xb169, 0xcb6f, 0xe574, 
-     0x3074, 0x4a79, 0x647e, 0x7e83, 0x3e74, 0x5879, 0x727f, 0x8c84, 
-     0x4c75, 0x667a, 0x807f, 0x9a84, 0x5a75, 0x747a, 0x8e80, 0xa885, 
-     0x6975, 0x837b, 0x9d80, 0xb785, 0x7776, 0x917b, 0xab81, 0xc586, 
-     0x8576, 0x9f7c, 0xb981, 0xd386, 0x9377, 0xad7c, 0xc781, 0xe187, 
-     0x2c86, 0x468c, 0x6091, 0x7a96, 0x3a87, 0x548c, 0x6e91, 0x8897, 
-     0x4887, 0x628c, 0x7c92, 0x9697, 0x5688, 0x708d, 0x8a92, 0xa498, 
-     0x6588, 0x7f8d, 0x9993, 0xb398, 0x7389, 0x8d8e, 0xa793, 0xc198, 
-     0x8189, 0x9b8e, 0xb594, 0xcf99, 0x8f8a, 0xa98f, 0xc394, 0xdd99, 
-     0x2899, 0x429e, 0x5ca4, 0x76a9, 0x3699, 0x509f, 0x6aa4, 0x84a9, 
-     0x449a, 0x5e9f, 0x78a4, 0x92aa, 0x539a, 0x6da0, 0x87a5, 0xa1aa, 
-     0x619b, 0x7ba0, 0x95a5, 0xafab, 0x6f9b, 0x89a1, 0xa3a6, 0xbdab, 
-     0x7d9c, 0x97a1, 0xb1a6, 0xcbac, 0x8b9c, 0xa5a2, 0xbfa7, 0xd9ac, 
-     0x24ac, 0x3eb1, 0x58b6, 0x72bc, 0x32ac, 0x4cb1, 0x66b7, 0x80bc, 
-     0x41ad, 0x5bb2, 0x75b7, 0x8fbc, 0x4fad, 0x69b2, 0x83b8, 0x9dbd, 
-     0x5dae, 0x77b3, 0x91b8, 0xabbd, 0x6bae, 0x85b3, 0x9fb9, 0xb9be, 
-     0x79ae, 0x93b4, 0xadb9, 0xc7be, 0x87af, 0xa1b4, 0xbbba, 0xd5bf, 
-     0x20be, 0x3ac4, 0x54c9, 0x6ece, 0x2fbf, 0x49c4, 0x62c9, 0x7ccf, 
-     0x3dbf, 0x57c5, 0x71ca, 0x8bcf, 0x4bc0, 0x65c5, 0x7fca, 0x99d0, 
-     0x59c0, 0x73c5, 0x8dcb, 0xa7d0, 0x67c1, 0x81c6, 0x9bcb, 0xb5d1, 
-     0x75c1, 0x8fc6, 0xa9cc, 0xc3d1, 0x84c2, 0x9ec7, 0xb8cc, 0xd1d2 
+     0x3c3c, 0x504a, 0x6558, 0x7967, 0x4f3c, 0x634a, 0x7858, 0x8c67, 
+     0x623c, 0x764a, 0x8b58, 0xa067, 0x753c, 0x8a4a, 0x9e58, 0xb367, 
+     0x883c, 0x9d4a, 0xb158, 0xc667, 0x9b3c, 0xb04a, 0xc558, 0xd967, 
+     0xaf3c, 0xc34a, 0xd858, 0xec67, 0xc23c, 0xd64a, 0xeb58, 0xff67, 
+     0x354b, 0x4a59, 0x5e68, 0x7376, 0x484b, 0x5d59, 0x7168, 0x8676, 
+     0x5b4b, 0x7059, 0x8468, 0x9976, 0x6e4b, 0x8359, 0x9868, 0xac76, 
+     0x824b, 0x9659, 0xab68, 0xbf76, 0x954b, 0xa959, 0xbe68, 0xd376, 
+     0xa84b, 0xbd59, 0xd168, 0xe676, 0xbb4b, 0xd059, 0xe468, 0xf976, 
+     0x2e5a, 0x4368, 0x5877, 0x6c85, 0x425a, 0x5668, 0x6b77, 0x7f85, 
+     0x555a, 0x6968, 0x7e77, 0x9285, 0x685a, 0x7c68, 0x9177, 0xa685, 
+     0x7b5a, 0x9068, 0xa477, 0xb985, 0x8e5a, 0xa368, 0xb777, 0xcc85, 
+     0xa15a, 0xb668, 0xcb77, 0xdf85, 0xb55a, 0xc968, 0xde77, 0xf285, 
+     0x2869, 0x3c78, 0x5186, 0x6694, 0x3b69, 0x5078, 0x6486, 0x7994, 
+     0x4e69, 0x6378, 0x7786, 0x8c94, 0x6169, 0x7678, 0x8a86, 0x9f94, 
+     0x7469, 0x8978, 0x9e86, 0xb294, 0x8869, 0x9c78, 0xb186, 0xc594, 
+     0x9b69, 0xaf78, 0xc486, 0xd994, 0xae69, 0xc378, 0xd786, 0xec94, 
+     0x2179, 0x3687, 0x4a95, 0x5fa4, 0x3479, 0x4987, 0x5e95, 0x72a4, 
+     0x4879, 0x5c87, 0x7195, 0x85a4, 0x5b79, 0x6f87, 0x8495, 0x99a4, 
+     0x6e79, 0x8387, 0x9795, 0xaca4, 0x8179, 0x9687, 0xaa95, 0xbfa4, 
+     0x9479, 0xa987, 0xbd95, 0xd2a4, 0xa779, 0xbc87, 0xd195, 0xe5a4, 
+     0x1b88, 0x2f96, 0x44a5, 0x58b3, 0x2e88, 0x4296, 0x57a5, 0x6cb3, 
+     0x4188, 0x5696, 0x6aa5, 0x7fb3, 0x5488, 0x6996, 0x7da5, 0x92b3, 
+     0x6788, 0x7c96, 0x91a5, 0xa5b3, 0x7b88, 0x8f96, 0xa4a5, 0xb8b3, 
+     0x8e88, 0xa296, 0xb7a5, 0xcbb3, 0xa188, 0xb596, 0xcaa5, 0xdfb3, 
+     0x1497, 0x29a5, 0x3db4, 0x52c2, 0x2797, 0x3ca5, 0x50b4, 0x65c2, 
+     0x3a97, 0x4fa5, 0x64b4, 0x78c2, 0x4e97, 0x62a5, 0x77b4, 0x8bc2, 
+     0x6197, 0x75a5, 0x8ab4, 0x9fc2, 0x7497, 0x89a5, 0x9db4, 0xb2c2, 
+     0x8797, 0x9ca5, 0xb0b4, 0xc5c2, 0x9a97, 0xafa5, 0xc3b4, 0xd8c2, 
+     0x0da6, 0x22b5, 0x37c3, 0x4bd1, 0x21a6, 0x35b5, 0x4ac3, 0x5ed1, 
+     0x34a6, 0x48b5, 0x5dc3, 0x72d1, 0x47a6, 0x5cb5, 0x70c3, 0x85d1, 
+     0x5aa6, 0x6fb5, 0x83c3, 0x98d1, 0x6da6, 0x82b5, 0x97c3, 0xabd1, 
+     0x81a6, 0x95b5, 0xaac3, 0xbed1, 0x94a6, 0xa8b5, 0xbdc3, 0xd1d2 
   }, { 
-     0x3c3c, 0x3a31, 0x3826, 0x371b, 0x3e53, 0x3c48, 0x3b3d, 0x3932, 
-     0x406b, 0x3e60, 0x3d55, 0x3b4a, 0x4282, 0x4177, 0x3f6c, 0x3d61, 
-     0x449a, 0x438f, 0x4184, 0x4079, 0x47b1, 0x45a6, 0x439b, 0x4290, 
-     0x49c9, 0x47be, 0x46b3, 0x44a8, 0x4be0, 0x49d6, 0x48cb, 0x46c0, 
-     0x4f3e, 0x4e33, 0x4c28, 0x4b1d, 0x5256, 0x504b, 0x4e40, 0x4d35, 
-     0x546d, 0x5262, 0x5157, 0x4f4c, 0x5685, 0x547a, 0x536f, 0x5164, 
-     0x589c, 0x5791, 0x5586, 0x547b, 0x5bb4, 0x59a9, 0x579e, 0x5693, 
-     0x5dcb, 0x5bc1, 0x5ab6, 0x58ab, 0x5fe3, 0x5dd8, 0x5ccd, 0x5ac2, 
-     0x6341, 0x6236, 0x602b, 0x5e20, 0x6558, 0x644d, 0x6242, 0x6137, 
-     0x6870, 0x6665, 0x655a, 0x634f, 0x6a87, 0x687c, 0x6771, 0x6566, 
-     0x6c9f, 0x6b94, 0x6989, 0x677e, 0x6eb6, 0x6dac, 0x6ba1, 0x6a96, 
-     0x71ce, 0x6fc3, 0x6db8, 0x6cad, 0x73e6, 0x71db, 0x70d0, 0x6ec5, 
-     0x7743, 0x7638, 0x742d, 0x7222, 0x795b, 0x7850, 0x7645, 0x753a, 
-     0x7c72, 0x7a67, 0x785c, 0x7751, 0x7e8a, 0x7c7f, 0x7b74, 0x7969, 
-     0x80a1, 0x7e96, 0x7d8c, 0x7b81, 0x82b9, 0x81ae, 0x7fa3, 0x7e98, 
-     0x85d1, 0x83c6, 0x81bb, 0x80b0, 0x87e8, 0x85dd, 0x84d2, 0x82c7, 
-     0x8b46, 0x893b, 0x8830, 0x8625, 0x8d5d, 0x8c52, 0x8a47, 0x883c, 
-     0x8f75, 0x8e6a, 0x8c5f, 0x8b54, 0x928c, 0x9081, 0x8f77, 0x8d6c, 
-     0x94a4, 0x9299, 0x918e, 0x8f83, 0x96bc, 0x95b1, 0x93a6, 0x919b, 
-     0x98d3, 0x97c8, 0x95bd, 0x94b2, 0x9beb, 0x99e0, 0x97d5, 0x96ca, 
-     0x9f48, 0x9d3d, 0x9c32, 0x9a27, 0xa160, 0xa055, 0x9e4a, 0x9c3f, 
-     0xa377, 0xa26c, 0xa061, 0x9f57, 0xa68f, 0xa484, 0xa279, 0xa16e, 
-     0xa8a7, 0xa69c, 0xa591, 0xa386, 0xaabe, 0xa8b3, 0xa7a8, 0xa59d, 
-     0xacd6, 0xabcb, 0xa9c0, 0xa8b5, 0xafed, 0xade2, 0xabd7, 0xaacc, 
-     0xb34b, 0xb140, 0xb035, 0xae2a, 0xb562, 0xb357, 0xb24c, 0xb042, 
-     0xb77a, 0xb66f, 0xb464, 0xb259, 0xb992, 0xb887, 0xb67c, 0xb571, 
-     0xbca9, 0xba9e, 0xb993, 0xb788, 0xbec1, 0xbcb6, 0xbbab, 0xb9a0, 
-     0xc0d8, 0xbfcd, 0xbdc2, 0xbbb7, 0xc2f0, 0xc1e5, 0xbfda, 0xbecf, 
-     0xc74d, 0xc542, 0xc437, 0xc22d, 0xc965, 0xc75a, 0xc64f, 0xc444, 
-     0xcb7d, 0xca72, 0xc867, 0xc65c, 0xcd94, 0xcc89, 0xca7e, 0xc973, 
-     0xd0ac, 0xcea1, 0xcc96, 0xcb8b, 0xd2c3, 0xd0b8, 0xcfad, 0xcda2, 
-     0xd4db, 0xd2d0, 0xd1c5, 0xcfba, 0xd6f2, 0xd5e7, 0xd3dc, 0xd2d1 
+     0x3c3c, 0x432c, 0x4b1c, 0x520c, 0x3c4f, 0x4340, 0x4b30, 0x5320, 
+     0x3c63, 0x4354, 0x4b44, 0x5334, 0x3c77, 0x4468, 0x4b58, 0x5348, 
+     0x3c8b, 0x447c, 0x4b6c, 0x535c, 0x3c9f, 0x4490, 0x4c80, 0x5370, 
+     0x3cb3, 0x44a4, 0x4c94, 0x5384, 0x3dc7, 0x44b8, 0x4ca8, 0x5398, 
+     0x4e44, 0x5534, 0x5d24, 0x6415, 0x4e58, 0x5548, 0x5d38, 0x6529, 
+     0x4e6c, 0x555c, 0x5d4c, 0x653d, 0x4e80, 0x5670, 0x5d60, 0x6551, 
+     0x4e94, 0x5684, 0x5d74, 0x6565, 0x4ea8, 0x5698, 0x5e88, 0x6578, 
+     0x4ebb, 0x56ac, 0x5e9c, 0x658c, 0x4fcf, 0x56c0, 0x5eb0, 0x65a0, 
+     0x604c, 0x673c, 0x6f2d, 0x761d, 0x6060, 0x6750, 0x6f40, 0x7731, 
+     0x6074, 0x6764, 0x6f54, 0x7745, 0x6088, 0x6878, 0x6f68, 0x7759, 
+     0x609c, 0x688c, 0x6f7c, 0x776d, 0x60b0, 0x68a0, 0x7090, 0x7781, 
+     0x60c4, 0x68b4, 0x70a4, 0x7795, 0x61d8, 0x68c8, 0x70b8, 0x77a9, 
+     0x7254, 0x7944, 0x8135, 0x8825, 0x7268, 0x7958, 0x8149, 0x8939, 
+     0x727c, 0x796c, 0x815d, 0x894d, 0x7290, 0x7a80, 0x8171, 0x8961, 
+     0x72a4, 0x7a94, 0x8185, 0x8975, 0x72b8, 0x7aa8, 0x8299, 0x8989, 
+     0x72cc, 0x7abc, 0x82ac, 0x899d, 0x73e0, 0x7ad0, 0x82c0, 0x89b1, 
+     0x845c, 0x8b4d, 0x933d, 0x9a2d, 0x8470, 0x8b61, 0x9351, 0x9b41, 
+     0x8484, 0x8b74, 0x9365, 0x9b55, 0x8498, 0x8c88, 0x9379, 0x9b69, 
+     0x84ac, 0x8c9c, 0x938d, 0x9b7d, 0x84c0, 0x8cb0, 0x94a1, 0x9b91, 
+     0x84d4, 0x8cc4, 0x94b5, 0x9ba5, 0x85e8, 0x8cd8, 0x94c9, 0x9bb9, 
+     0x9664, 0x9d55, 0xa545, 0xac35, 0x9678, 0x9d69, 0xa559, 0xad49, 
+     0x968c, 0x9d7d, 0xa56d, 0xad5d, 0x96a0, 0x9e91, 0xa581, 0xad71, 
+     0x96b4, 0x9ea5, 0xa595, 0xad85, 0x96c8, 0x9eb9, 0xa6a9, 0xad99, 
+     0x96dc, 0x9ecd, 0xa6bd, 0xadad, 0x97f0, 0x9ee0, 0xa6d1, 0xadc1, 
+     0xa86d, 0xaf5d, 0xb74d, 0xbe3e, 0xa881, 0xaf71, 0xb761, 0xbf52, 
+     0xa895, 0xaf85, 0xb775, 0xbf65, 0xa8a8, 0xb099, 0xb789, 0xbf79, 
+     0xa8bc, 0xb0ad, 0xb79d, 0xbf8d, 0xa8d0, 0xb0c1, 0xb8b1, 0xbfa1, 
+     0xa8e4, 0xb0d5, 0xb8c5, 0xbfb5, 0xa9f8, 0xb0e9, 0xb8d9, 0xbfc9, 
+     0xba75, 0xc165, 0xc955, 0xd046, 0xba89, 0xc179, 0xc969, 0xd15a, 
+     0xba9d, 0xc18d, 0xc97d, 0xd16e, 0xbab1, 0xc2a1, 0xc991, 0xd182, 
+     0xbac5, 0xc2b5, 0xc9a5, 0xd196, 0xbad9, 0xc2c9, 0xcab9, 0xd1aa, 
+     0xbaed, 0xc2dd, 0xcacd, 0xd1be, 0xbbff, 0xc2f1, 0xcae1, 0xd2d1 
   }, { 
-     0x3c3c, 0x3657, 0x3173, 0x2b8f, 0x5546, 0x4f61, 0x4a7d, 0x4499, 
-     0x6e50, 0x686c, 0x6387, 0x5da3, 0x875a, 0x8176, 0x7c92, 0x76ad, 
-     0xa064, 0x9a80, 0x959c, 0x8fb7, 0xb96e, 0xb38a, 0xaea6, 0xa8c2, 
-     0xd279, 0xcc94, 0xc7b0, 0xc1cc, 0xeb83, 0xe59f, 0xe0ba, 0xdad6, 
-     0x3a3b, 0x3557, 0x2f72, 0x2a8e, 0x5345, 0x4e61, 0x487d, 0x4398, 
-     0x6c4f, 0x676b, 0x6187, 0x5ca2, 0x8559, 0x8075, 0x7a91, 0x75ad, 
-     0x9e64, 0x997f, 0x939b, 0x8eb7, 0xb86e, 0xb28a, 0xada5, 0xa7c1, 
-     0xd178, 0xcb94, 0xc6af, 0xc0cb, 0xea82, 0xe49e, 0xdfba, 0xd9d5, 
-     0x393a, 0x3356, 0x2e72, 0x288d, 0x5244, 0x4d60, 0x477c, 0x4298, 
-     0x6b4f, 0x666a, 0x6086, 0x5ba2, 0x8459, 0x7f75, 0x7990, 0x74ac, 
-     0x9d63, 0x987f, 0x929a, 0x8db6, 0xb66d, 0xb189, 0xaba5, 0xa6c0, 
-     0xcf77, 0xca93, 0xc4af, 0xbfcb, 0xe882, 0xe39d, 0xddb9, 0xd8d5, 
-     0x383a, 0x3255, 0x2d71, 0x278d, 0x5144, 0x4b5f, 0x467b, 0x4097, 
-     0x6a4e, 0x646a, 0x5f85, 0x59a1, 0x8358, 0x7d74, 0x7890, 0x72ab, 
-     0x9c62, 0x967e, 0x919a, 0x8bb6, 0xb56d, 0xaf88, 0xaaa4, 0xa4c0, 
-     0xce77, 0xc992, 0xc3ae, 0xbeca, 0xe781, 0xe29d, 0xdcb8, 0xd7d4, 
-     0x3639, 0x3155, 0x2b70, 0x268c, 0x4f43, 0x4a5f, 0x447b, 0x3f96, 
-     0x694d, 0x6369, 0x5e85, 0x58a0, 0x8257, 0x7c73, 0x778f, 0x71ab, 
-     0x9b62, 0x957d, 0x9099, 0x8ab5, 0xb46c, 0xae88, 0xa9a3, 0xa3bf, 
-     0xcd76, 0xc792, 0xc2ae, 0xbcc9, 0xe680, 0xe09c, 0xdbb8, 0xd5d3, 
-     0x3538, 0x3054, 0x2a70, 0x258b, 0x4e42, 0x495e, 0x437a, 0x3e96, 
-     0x674d, 0x6268, 0x5c84, 0x57a0, 0x8057, 0x7b73, 0x758e, 0x70aa, 
-     0x9961, 0x947d, 0x8e98, 0x89b4, 0xb26b, 0xad87, 0xa7a3, 0xa2be, 
-     0xcb75, 0xc691, 0xc0ad, 0xbbc9, 0xe580, 0xdf9b, 0xdab7, 0xd4d3, 
-     0x3438, 0x2e53, 0x296f, 0x238b, 0x4d42, 0x475e, 0x4279, 0x3c95, 
-     0x664c, 0x6068, 0x5b83, 0x559f, 0x7f56, 0x7a72, 0x748e, 0x6fa9, 
-     0x9860, 0x937c, 0x8d98, 0x88b4, 0xb16b, 0xac86, 0xa6a2, 0xa1be, 
-     0xca75, 0xc590, 0xbfac, 0xbac8, 0xe37f, 0xde9b, 0xd8b6, 0xd3d2, 
-     0x3337, 0x2d53, 0x286e, 0x228a, 0x4c41, 0x465d, 0x4179, 0x3b94, 
-     0x654b, 0x5f67, 0x5a83, 0x549f, 0x7e56, 0x7871, 0x738d, 0x6da9, 
-     0x9760, 0x917b, 0x8c97, 0x86b3, 0xb06a, 0xaa86, 0xa5a1, 0x9fbd, 
-     0xc974, 0xc390, 0xbeac, 0xb8c7, 0xe27e, 0xdc9a, 0xd7b6, 0xd1d1 
+     0x3c3c, 0x2f54, 0x236d, 0x1686, 0x524b, 0x4664, 0x397d, 0x2d96, 
+     0x695a, 0x5d73, 0x508c, 0x44a5, 0x806a, 0x7483, 0x679c, 0x5bb5, 
+     0x9779, 0x8a92, 0x7eab, 0x71c4, 0xae89, 0xa1a2, 0x95bb, 0x88d4, 
+     0xc498, 0xb8b1, 0xacca, 0x9fe3, 0xdba8, 0xcfc1, 0xc2da, 0xb6f3, 
+     0x3f37, 0x3350, 0x2769, 0x1a82, 0x5646, 0x4a5f, 0x3d78, 0x3191, 
+     0x6d56, 0x616f, 0x5488, 0x48a1, 0x8465, 0x777e, 0x6b97, 0x5fb0, 
+     0x9b75, 0x8e8e, 0x82a7, 0x75c0, 0xb284, 0xa59d, 0x99b6, 0x8ccf, 
+     0xc894, 0xbcad, 0xafc6, 0xa3de, 0xdfa3, 0xd3bc, 0xc6d5, 0xbaee, 
+     0x4332, 0x374b, 0x2a64, 0x1e7d, 0x5a41, 0x4e5a, 0x4173, 0x358c, 
+     0x7151, 0x656a, 0x5883, 0x4c9c, 0x8860, 0x7b79, 0x6f92, 0x63ab, 
+     0x9f70, 0x9289, 0x86a2, 0x79bb, 0xb67f, 0xa998, 0x9db1, 0x90ca, 
+     0xcc8f, 0xc0a8, 0xb3c1, 0xa7da, 0xe39e, 0xd7b7, 0xcad0, 0xbee9, 
+     0x472d, 0x3b46, 0x2e5f, 0x2278, 0x5e3d, 0x5256, 0x456f, 0x3988, 
+     0x754c, 0x6965, 0x5c7e, 0x5097, 0x8c5c, 0x7f75, 0x738e, 0x66a7, 
+     0xa36b, 0x9684, 0x8a9d, 0x7db6, 0xb97b, 0xad94, 0xa1ad, 0x94c6, 
+     0xd08a, 0xc4a3, 0xb7bc, 0xabd5, 0xe79a, 0xdbb3, 0xcecc, 0xc2e4, 
+     0x4b29, 0x3f41, 0x325a, 0x2673, 0x6238, 0x5651, 0x496a, 0x3d83, 
+     0x7947, 0x6c60, 0x6079, 0x5492, 0x9057, 0x8370, 0x7789, 0x6aa2, 
+     0xa766, 0x9a7f, 0x8e98, 0x81b1, 0xbd76, 0xb18f, 0xa4a8, 0x98c1, 
+     0xd485, 0xc89e, 0xbbb7, 0xafd0, 0xeb95, 0xdfae, 0xd2c7, 0xc6e0, 
+     0x4f24, 0x433d, 0x3656, 0x2a6f, 0x6633, 0x5a4c, 0x4d65, 0x417e, 
+     0x7d43, 0x705c, 0x6475, 0x578e, 0x9452, 0x876b, 0x7b84, 0x6e9d, 
+     0xaa62, 0x9e7b, 0x9294, 0x85ad, 0xc171, 0xb58a, 0xa8a3, 0x9cbc, 
+     0xd881, 0xcc9a, 0xbfb3, 0xb3cc, 0xef90, 0xe3a9, 0xd6c2, 0xcadb, 
+     0x531f, 0x4738, 0x3a51, 0x2e6a, 0x6a2f, 0x5e47, 0x5160, 0x4579, 
+     0x813e, 0x7457, 0x6870, 0x5b89, 0x984d, 0x8b66, 0x7f7f, 0x7298, 
+     0xae5d, 0xa276, 0x968f, 0x89a8, 0xc56c, 0xb985, 0xac9e, 0xa0b7, 
+     0xdc7c, 0xd095, 0xc3ae, 0xb7c7, 0xf38b, 0xe6a4, 0xdabd, 0xced6, 
+     0x571a, 0x4b33, 0x3e4c, 0x3265, 0x6e2a, 0x6143, 0x555c, 0x4975, 
+     0x8539, 0x7852, 0x6c6b, 0x5f84, 0x9c49, 0x8f62, 0x837b, 0x7694, 
+     0xb258, 0xa671, 0x998a, 0x8da3, 0xc968, 0xbd81, 0xb09a, 0xa4b3, 
+     0xe077, 0xd490, 0xc7a9, 0xbbc2, 0xf787, 0xeaa0, 0xdeb9, 0xd1d1 
   }, { 
-     0x3c3c, 0x5734, 0x722c, 0x8d24, 0x4240, 0x5d39, 0x7931, 0x9429, 
-     0x4845, 0x643e, 0x7f36, 0x9a2e, 0x4f4a, 0x6a43, 0x853b, 0xa133, 
-     0x554f, 0x7148, 0x8c40, 0xa738, 0x5c54, 0x774d, 0x9245, 0xae3d, 
-     0x6259, 0x7d52, 0x994a, 0xb442, 0x695e, 0x8457, 0x9f4f, 0xbb47, 
-     0x3f4f, 0x5a47, 0x7540, 0x9138, 0x4554, 0x614c, 0x7c45, 0x973d, 
-     0x4c59, 0x6751, 0x824a, 0x9e42, 0x525e, 0x6d56, 0x894f, 0xa447, 
-     0x5963, 0x745b, 0x8f54, 0xaa4c, 0x5f68, 0x7a60, 0x9659, 0xb151, 
-     0x656d, 0x8165, 0x9c5e, 0xb756, 0x6c72, 0x876a, 0xa363, 0xbe5b, 
-     0x4263, 0x5d5b, 0x7953, 0x944c, 0x4968, 0x6460, 0x7f58, 0x9a51, 
-     0x4f6d, 0x6a65, 0x865d, 0xa156, 0x5572, 0x716a, 0x8c62, 0xa75b, 
-     0x5c77, 0x776f, 0x9267, 0xae60, 0x627c, 0x7e74, 0x996c, 0xb465, 
-     0x6981, 0x8479, 0x9f71, 0xbb6a, 0x6f86, 0x8a7e, 0xa676, 0xc16f, 
-     0x4577, 0x616f, 0x7c67, 0x975f, 0x4c7c, 0x6774, 0x826c, 0x9e64, 
-     0x5281, 0x6e79, 0x8971, 0xa469, 0x5986, 0x747e, 0x8f76, 0xab6e, 
-     0x5f8b, 0x7a83, 0x967b, 0xb173, 0x6690, 0x8188, 0x9c80, 0xb778, 
-     0x6c95, 0x878d, 0xa385, 0xbe7d, 0x729a, 0x8e92, 0xa98a, 0xc482, 
-     0x498b, 0x6483, 0x7f7b, 0x9b73, 0x4f90, 0x6a88, 0x8680, 0xa178, 
-     0x5695, 0x718d, 0x8c85, 0xa77d, 0x5c9a, 0x7792, 0x938a, 0xae82, 
-     0x629f, 0x7e97, 0x998f, 0xb487, 0x69a4, 0x849c, 0x9f94, 0xbb8c, 
-     0x6fa9, 0x8ba1, 0xa699, 0xc191, 0x76ae, 0x91a6, 0xac9e, 0xc896, 
-     0x4c9e, 0x6797, 0x838f, 0x9e87, 0x52a3, 0x6e9c, 0x8994, 0xa48c, 
-     0x59a8, 0x74a1, 0x8f99, 0xab91, 0x5fad, 0x7ba6, 0x969e, 0xb196, 
-     0x66b2, 0x81ab, 0x9ca3, 0xb89b, 0x6cb7, 0x87b0, 0xa3a8, 0xbea0, 
-     0x73bc, 0x8eb5, 0xa9ad, 0xc4a5, 0x79c1, 0x94ba, 0xb0b2, 0xcbaa, 
-     0x4fb2, 0x6aaa, 0x86a3, 0xa19b, 0x56b7, 0x71af, 0x8ca8, 0xa8a0, 
-     0x5cbc, 0x77b4, 0x93ad, 0xaea5, 0x63c1, 0x7eb9, 0x99b2, 0xb4aa, 
-     0x69c6, 0x84be, 0xa0b7, 0xbbaf, 0x6fcb, 0x8bc3, 0xa6bc, 0xc1b4, 
-     0x76d0, 0x91c8, 0xacc1, 0xc8b9, 0x7cd5, 0x98cd, 0xb3c6, 0xcebe, 
-     0x52c6, 0x6ebe, 0x89b6, 0xa4af, 0x59cb, 0x74c3, 0x90bb, 0xabb4, 
-     0x5fd0, 0x7bc8, 0x96c0, 0xb1b9, 0x66d5, 0x81cd, 0x9cc5, 0xb8be, 
-     0x6cda, 0x88d2, 0xa3ca, 0xbec3, 0x73df, 0x8ed7, 0xa9cf, 0xc5c8, 
-     0x79e4, 0x94dc, 0xb0d4, 0xcbcd, 0x80e9, 0x9be1, 0xb6d9, 0xd2d2 
+     0x3c3c, 0x573c, 0x723d, 0x8e3d, 0x473d, 0x623e, 0x7e3e, 0x993f, 
+     0x533f, 0x6e3f, 0x8940, 0xa541, 0x5e40, 0x7941, 0x9541, 0xb042, 
+     0x6a42, 0x8542, 0xa043, 0xbc44, 0x7543, 0x9044, 0xac44, 0xc745, 
+     0x8145, 0x9c45, 0xb746, 0xd347, 0x8c46, 0xa747, 0xc347, 0xde48, 
+     0x3a4f, 0x5550, 0x7050, 0x8c51, 0x4551, 0x6151, 0x7c52, 0x9753, 
+     0x5152, 0x6c53, 0x8753, 0xa354, 0x5c54, 0x7854, 0x9355, 0xae56, 
+     0x6855, 0x8356, 0x9e57, 0xba57, 0x7357, 0x8f57, 0xaa58, 0xc559, 
+     0x7f58, 0x9a59, 0xb65a, 0xd15a, 0x8a5a, 0xa65a, 0xc15b, 0xdc5c, 
+     0x3863, 0x5363, 0x6f64, 0x8a65, 0x4364, 0x5f65, 0x7a66, 0x9666, 
+     0x4f66, 0x6a66, 0x8667, 0xa168, 0x5a67, 0x7668, 0x9169, 0xad69, 
+     0x6669, 0x8169, 0x9d6a, 0xb86b, 0x716a, 0x8d6b, 0xa86c, 0xc46c, 
+     0x7d6c, 0x986d, 0xb46d, 0xcf6e, 0x886d, 0xa46e, 0xbf6f, 0xdb6f, 
+     0x3676, 0x5177, 0x6d78, 0x8878, 0x4278, 0x5d79, 0x7879, 0x947a, 
+     0x4d79, 0x687a, 0x847b, 0x9f7b, 0x597b, 0x747c, 0x8f7c, 0xab7d, 
+     0x647c, 0x7f7d, 0x9b7e, 0xb67e, 0x707e, 0x8b7f, 0xa67f, 0xc280, 
+     0x7b7f, 0x9680, 0xb281, 0xcd81, 0x8781, 0xa282, 0xbd82, 0xd983, 
+     0x348a, 0x508b, 0x6b8b, 0x868c, 0x408c, 0x5b8c, 0x778d, 0x928e, 
+     0x4b8d, 0x678e, 0x828e, 0x9d8f, 0x578f, 0x728f, 0x8e90, 0xa991, 
+     0x6290, 0x7e91, 0x9991, 0xb492, 0x6e92, 0x8992, 0xa593, 0xc094, 
+     0x7993, 0x9594, 0xb094, 0xcb95, 0x8595, 0xa095, 0xbc96, 0xd797, 
+     0x329e, 0x4e9e, 0x699f, 0x85a0, 0x3e9f, 0x59a0, 0x75a0, 0x90a1, 
+     0x49a1, 0x65a1, 0x80a2, 0x9ca3, 0x55a2, 0x70a3, 0x8ca4, 0xa7a4, 
+     0x60a4, 0x7ca4, 0x97a5, 0xb3a6, 0x6ca5, 0x87a6, 0xa3a7, 0xbea7, 
+     0x77a7, 0x93a7, 0xaea8, 0xcaa9, 0x83a8, 0x9ea9, 0xbaaa, 0xd5aa, 
+     0x31b1, 0x4cb2, 0x67b3, 0x83b3, 0x3cb3, 0x57b3, 0x73b4, 0x8eb5, 
+     0x48b4, 0x63b5, 0x7eb6, 0x9ab6, 0x53b6, 0x6fb6, 0x8ab7, 0xa5b8, 
+     0x5fb7, 0x7ab8, 0x95b9, 0xb1b9, 0x6ab9, 0x86ba, 0xa1ba, 0xbcbb, 
+     0x76ba, 0x91bb, 0xacbc, 0xc8bc, 0x81bc, 0x9dbd, 0xb8bd, 0xd3be, 
+     0x2fc5, 0x4ac6, 0x66c6, 0x81c7, 0x3ac6, 0x56c7, 0x71c8, 0x8cc8, 
+     0x46c8, 0x61c9, 0x7dc9, 0x98ca, 0x51c9, 0x6dca, 0x88cb, 0xa3cb, 
+     0x5dcb, 0x78cc, 0x94cc, 0xafcd, 0x68cc, 0x84cd, 0x9fce, 0xbace, 
+     0x74ce, 0x8fcf, 0xabcf, 0xc6d0, 0x7fd0, 0x9bd0, 0xb6d1, 0xd2d2 
   }, { 
-     0x3c3c, 0x2f3d, 0x223e, 0x153f, 0x4455, 0x3756, 0x2b57, 0x1e58, 
-     0x4d6e, 0x406f, 0x3370, 0x2671, 0x5587, 0x4889, 0x3c8a, 0x2f8b, 
-     0x5ea1, 0x51a2, 0x44a3, 0x38a4, 0x66ba, 0x59bb, 0x4dbc, 0x40bd, 
-     0x6fd3, 0x62d5, 0x55d6, 0x49d7, 0x77ed, 0x6aee, 0x5eef, 0x51f0, 
-     0x4e37, 0x4138, 0x3439, 0x283a, 0x5650, 0x4a52, 0x3d53, 0x3054, 
-     0x5f6a, 0x526b, 0x466c, 0x396d, 0x6783, 0x5b84, 0x4e85, 0x4186, 
-     0x709c, 0x639e, 0x579f, 0x4aa0, 0x78b6, 0x6cb7, 0x5fb8, 0x52b9, 
-     0x81cf, 0x74d0, 0x68d1, 0x5bd2, 0x89e8, 0x7de9, 0x70eb, 0x63ec, 
-     0x6033, 0x5434, 0x4735, 0x3a36, 0x694c, 0x5c4d, 0x4f4e, 0x434f, 
-     0x7165, 0x6567, 0x5868, 0x4b69, 0x7a7f, 0x6d80, 0x6081, 0x5482, 
-     0x8298, 0x7699, 0x699a, 0x5c9b, 0x8bb1, 0x7eb2, 0x71b4, 0x65b5, 
-     0x93cb, 0x87cc, 0x7acd, 0x6dce, 0x9ce4, 0x8fe5, 0x82e6, 0x76e7, 
-     0x732e, 0x6630, 0x5931, 0x4c32, 0x7b48, 0x6e49, 0x624a, 0x554b, 
-     0x8461, 0x7762, 0x6a63, 0x5e64, 0x8c7a, 0x7f7b, 0x737d, 0x667e, 
-     0x9594, 0x8895, 0x7b96, 0x6f97, 0x9dad, 0x90ae, 0x84af, 0x77b0, 
-     0xa6c6, 0x99c7, 0x8cc9, 0x80ca, 0xaee0, 0xa1e1, 0x95e2, 0x88e3, 
-     0x852a, 0x782b, 0x6c2c, 0x5f2d, 0x8d43, 0x8144, 0x7446, 0x6747, 
-     0x965d, 0x895e, 0x7d5f, 0x7060, 0x9e76, 0x9277, 0x8578, 0x7879, 
-     0xa78f, 0x9a90, 0x8e92, 0x8193, 0xafa9, 0xa3aa, 0x96ab, 0x89ac, 
-     0xb8c2, 0xabc3, 0x9fc4, 0x92c5, 0xc1db, 0xb4dc, 0xa7dd, 0x9adf, 
-     0x9726, 0x8b27, 0x7e28, 0x7129, 0xa03f, 0x9340, 0x8641, 0x7a42, 
-     0xa858, 0x9c59, 0x8f5b, 0x825c, 0xb172, 0xa473, 0x9774, 0x8b75, 
-     0xb98b, 0xad8c, 0xa08d, 0x938e, 0xc2a4, 0xb5a5, 0xa8a6, 0x9ca8, 
-     0xcabe, 0xbebf, 0xb1c0, 0xa4c1, 0xd3d7, 0xc6d8, 0xb9d9, 0xadda, 
-     0xaa21, 0x9d22, 0x9024, 0x8425, 0xb23b, 0xa53c, 0x993d, 0x8c3e, 
-     0xbb54, 0xae55, 0xa156, 0x9557, 0xc36d, 0xb66e, 0xaa6f, 0x9d71, 
-     0xcc87, 0xbf88, 0xb289, 0xa68a, 0xd4a0, 0xc7a1, 0xbba2, 0xaea3, 
-     0xddb9, 0xd0ba, 0xc3bb, 0xb7bd, 0xe5d3, 0xd9d4, 0xccd5, 0xbfd6, 
-     0xbc1d, 0xaf1e, 0xa31f, 0x9620, 0xc436, 0xb837, 0xab38, 0x9e3a, 
-     0xcd50, 0xc051, 0xb452, 0xa753, 0xd569, 0xc96a, 0xbc6b, 0xaf6c, 
-     0xde82, 0xd183, 0xc584, 0xb886, 0xe79c, 0xda9d, 0xcd9e, 0xc09f, 
-     0xefb5, 0xe2b6, 0xd6b7, 0xc9b8, 0xf8ce, 0xebcf, 0xded0, 0xd2d1 
+     0x3c3c, 0x3634, 0x302d, 0x2a25, 0x3f54, 0x3a4d, 0x3445, 0x2e3e, 
+     0x436d, 0x3e65, 0x385e, 0x3256, 0x4786, 0x427e, 0x3c77, 0x366f, 
+     0x4b9e, 0x4697, 0x408f, 0x3a88, 0x4fb7, 0x4aaf, 0x44a8, 0x3ea1, 
+     0x53d0, 0x4ec8, 0x48c1, 0x42b9, 0x57e8, 0x51e1, 0x4cd9, 0x46d2, 
+     0x4f3b, 0x4a34, 0x442d, 0x3e25, 0x5354, 0x4e4d, 0x4845, 0x423e, 
+     0x576d, 0x5265, 0x4c5e, 0x4656, 0x5b86, 0x567e, 0x5077, 0x4a6f, 
+     0x5f9e, 0x5a97, 0x548f, 0x4e88, 0x63b7, 0x5daf, 0x58a8, 0x52a0, 
+     0x67d0, 0x61c8, 0x5cc1, 0x56b9, 0x6be8, 0x65e1, 0x60d9, 0x5ad2, 
+     0x633b, 0x5e34, 0x582c, 0x5225, 0x6754, 0x624d, 0x5c45, 0x563e, 
+     0x6b6d, 0x6665, 0x605e, 0x5a56, 0x6f85, 0x697e, 0x6477, 0x5e6f, 
+     0x739e, 0x6d97, 0x688f, 0x6288, 0x77b7, 0x71af, 0x6ca8, 0x66a0, 
+     0x7bd0, 0x75c8, 0x70c1, 0x6ab9, 0x7fe8, 0x79e1, 0x74d9, 0x6ed2, 
+     0x773b, 0x7234, 0x6c2c, 0x6625, 0x7b54, 0x764d, 0x7045, 0x6a3e, 
+     0x7f6d, 0x7965, 0x745e, 0x6e56, 0x8385, 0x7d7e, 0x7876, 0x726f, 
+     0x879e, 0x8197, 0x7c8f, 0x7688, 0x8bb7, 0x85af, 0x80a8, 0x7aa0, 
+     0x8fcf, 0x89c8, 0x84c1, 0x7eb9, 0x93e8, 0x8de1, 0x88d9, 0x82d2, 
+     0x8b3b, 0x8534, 0x802c, 0x7a25, 0x8f54, 0x894c, 0x8445, 0x7e3e, 
+     0x936d, 0x8d65, 0x885e, 0x8256, 0x9785, 0x917e, 0x8c76, 0x866f, 
+     0x9b9e, 0x9597, 0x908f, 0x8a88, 0x9fb7, 0x99af, 0x94a8, 0x8ea0, 
+     0xa3cf, 0x9dc8, 0x97c0, 0x92b9, 0xa7e8, 0xa1e1, 0x9bd9, 0x96d2, 
+     0x9f3b, 0x9934, 0x942c, 0x8e25, 0xa354, 0x9d4c, 0x9845, 0x923d, 
+     0xa76d, 0xa165, 0x9c5e, 0x9656, 0xab85, 0xa57e, 0xa076, 0x9a6f, 
+     0xaf9e, 0xa996, 0xa48f, 0x9e88, 0xb3b7, 0xadaf, 0xa7a8, 0xa2a0, 
+     0xb7cf, 0xb1c8, 0xabc0, 0xa6b9, 0xbbe8, 0xb5e1, 0xafd9, 0xaad2, 
+     0xb33b, 0xad34, 0xa82c, 0xa225, 0xb754, 0xb14c, 0xac45, 0xa63d, 
+     0xbb6d, 0xb565, 0xb05e, 0xaa56, 0xbf85, 0xb97e, 0xb376, 0xae6f, 
+     0xc39e, 0xbd96, 0xb78f, 0xb287, 0xc7b7, 0xc1af, 0xbba8, 0xb6a0, 
+     0xcbcf, 0xc5c8, 0xbfc0, 0xbab9, 0xcfe8, 0xc9e0, 0xc3d9, 0xbed2, 
+     0xc73b, 0xc134, 0xbc2c, 0xb625, 0xcb54, 0xc54c, 0xbf45, 0xba3d, 
+     0xcf6c, 0xc965, 0xc35e, 0xbe56, 0xd385, 0xcd7e, 0xc776, 0xc26f, 
+     0xd79e, 0xd196, 0xcb8f, 0xc687, 0xdbb7, 0xd5af, 0xcfa8, 0xcaa0, 
+     0xdfcf, 0xd9c8, 0xd3c0, 0xceb9, 0xe3e8, 0xdde0, 0xd7d9, 0xd2d1 
   }, { 
-     0x3c3c, 0x4454, 0x4c6d, 0x5486, 0x543f, 0x5c58, 0x6470, 0x6c89, 
-     0x6c42, 0x745b, 0x7c74, 0x848c, 0x8545, 0x8d5e, 0x9577, 0x9d90, 
-     0x9d49, 0xa561, 0xad7a, 0xb593, 0xb54c, 0xbd65, 0xc57e, 0xcd96, 
-     0xce4f, 0xd668, 0xde81, 0xe69a, 0xe653, 0xee6b, 0xf684, 0xfe9d, 
-     0x3543, 0x3d5c, 0x4574, 0x4d8d, 0x4d46, 0x565f, 0x5e78, 0x6691, 
-     0x664a, 0x6e62, 0x767b, 0x7e94, 0x7e4d, 0x8666, 0x8e7e, 0x9697, 
-     0x9750, 0x9f69, 0xa782, 0xaf9a, 0xaf54, 0xb76c, 0xbf85, 0xc79e, 
-     0xc757, 0xcf70, 0xd788, 0xdfa1, 0xe05a, 0xe873, 0xf08c, 0xf8a4, 
-     0x2f4b, 0x3763, 0x3f7c, 0x4795, 0x474e, 0x4f67, 0x577f, 0x5f98, 
-     0x5f51, 0x686a, 0x7083, 0x789b, 0x7854, 0x806d, 0x8886, 0x909f, 
-     0x9058, 0x9871, 0xa089, 0xa8a2, 0xa95b, 0xb174, 0xb98d, 0xc1a5, 
-     0xc15e, 0xc977, 0xd190, 0xd9a9, 0xd962, 0xe17a, 0xe993, 0xf1ac, 
-     0x2852, 0x306b, 0x3884, 0x409c, 0x4155, 0x496e, 0x5187, 0x59a0, 
-     0x5959, 0x6171, 0x698a, 0x71a3, 0x715c, 0x7975, 0x828d, 0x8aa6, 
-     0x8a5f, 0x9278, 0x9a91, 0xa2aa, 0xa263, 0xaa7b, 0xb294, 0xbaad, 
-     0xbb66, 0xc37f, 0xcb97, 0xd3b0, 0xd369, 0xdb82, 0xe39b, 0xebb3, 
-     0x225a, 0x2a72, 0x328b, 0x3aa4, 0x3a5d, 0x4276, 0x4a8e, 0x52a7, 
-     0x5360, 0x5b79, 0x6392, 0x6baa, 0x6b63, 0x737c, 0x7b95, 0x83ae, 
-     0x8367, 0x8b80, 0x9498, 0x9cb1, 0x9c6a, 0xa483, 0xac9c, 0xb4b4, 
-     0xb46d, 0xbc86, 0xc49f, 0xccb8, 0xcd71, 0xd589, 0xdda2, 0xe5bb, 
-     0x1c61, 0x247a, 0x2c93, 0x34ab, 0x3464, 0x3c7d, 0x4496, 0x4caf, 
-     0x4c68, 0x5480, 0x5c99, 0x64b2, 0x656b, 0x6d84, 0x759c, 0x7db5, 
-     0x7d6e, 0x8587, 0x8da0, 0x95b9, 0x9572, 0x9d8a, 0xa5a3, 0xaebc, 
-     0xae75, 0xb68e, 0xbea6, 0xc6bf, 0xc678, 0xce91, 0xd6aa, 0xdec2, 
-     0x1569, 0x1d81, 0x259a, 0x2db3, 0x2e6c, 0x3685, 0x3e9d, 0x46b6, 
-     0x466f, 0x4e88, 0x56a1, 0x5eb9, 0x5e73, 0x668b, 0x6ea4, 0x76bd, 
-     0x7776, 0x7f8f, 0x87a7, 0x8fc0, 0x8f79, 0x9792, 0x9fab, 0xa7c3, 
-     0xa77c, 0xaf95, 0xb7ae, 0xc0c7, 0xc080, 0xc899, 0xd0b1, 0xd8ca, 
-     0x0f70, 0x1789, 0x1fa2, 0x27ba, 0x2773, 0x2f8c, 0x37a5, 0x3fbe, 
-     0x4077, 0x488f, 0x50a8, 0x58c1, 0x587a, 0x6093, 0x68ac, 0x70c4, 
-     0x707d, 0x7896, 0x80af, 0x88c8, 0x8981, 0x9199, 0x99b2, 0xa1cb, 
-     0xa184, 0xa99d, 0xb1b5, 0xb9ce, 0xb987, 0xc1a0, 0xc9b9, 0xd1d2 
+     0x3c3c, 0x3a57, 0x3973, 0x388f, 0x5543, 0x545f, 0x527b, 0x5196, 
+     0x6e4b, 0x6d66, 0x6c82, 0x6b9e, 0x8852, 0x866e, 0x858a, 0x84a6, 
+     0xa15a, 0xa076, 0x9f91, 0x9dad, 0xba62, 0xb97d, 0xb899, 0xb7b5, 
+     0xd469, 0xd385, 0xd1a1, 0xd0bc, 0xed71, 0xec8d, 0xeba8, 0xe9c4, 
+     0x383d, 0x3759, 0x3675, 0x3490, 0x5145, 0x5061, 0x4f7c, 0x4e98, 
+     0x6b4d, 0x6a68, 0x6884, 0x67a0, 0x8454, 0x8370, 0x828c, 0x81a7, 
+     0x9e5c, 0x9c78, 0x9b93, 0x9aaf, 0xb764, 0xb67f, 0xb59b, 0xb3b7, 
+     0xd06b, 0xcf87, 0xcea3, 0xcdbe, 0xea73, 0xe88f, 0xe7aa, 0xe6c6, 
+     0x353f, 0x335b, 0x3277, 0x3192, 0x4e47, 0x4d63, 0x4c7e, 0x4a9a, 
+     0x674f, 0x666a, 0x6586, 0x64a2, 0x8156, 0x8072, 0x7e8e, 0x7da9, 
+     0x9a5e, 0x997a, 0x9895, 0x97b1, 0xb466, 0xb281, 0xb19d, 0xb0b9, 
+     0xcd6d, 0xcc89, 0xcaa5, 0xc9c0, 0xe675, 0xe591, 0xe4ac, 0xe3c8, 
+     0x3141, 0x305d, 0x2f79, 0x2e94, 0x4b49, 0x4965, 0x4880, 0x479c, 
+     0x6451, 0x636c, 0x6288, 0x60a4, 0x7d58, 0x7c74, 0x7b90, 0x7aab, 
+     0x9760, 0x967c, 0x9497, 0x93b3, 0xb067, 0xaf83, 0xae9f, 0xacbb, 
+     0xc96f, 0xc88b, 0xc7a6, 0xc6c2, 0xe377, 0xe292, 0xe0ae, 0xdfca, 
+     0x2e43, 0x2d5f, 0x2b7b, 0x2a96, 0x474b, 0x4667, 0x4582, 0x449e, 
+     0x6152, 0x5f6e, 0x5e8a, 0x5da6, 0x7a5a, 0x7976, 0x7791, 0x76ad, 
+     0x9362, 0x927d, 0x9199, 0x90b5, 0xad69, 0xab85, 0xaaa1, 0xa9bc, 
+     0xc671, 0xc58d, 0xc4a8, 0xc2c4, 0xdf79, 0xde94, 0xddb0, 0xdccc, 
+     0x2a45, 0x2961, 0x287c, 0x2798, 0x444d, 0x4368, 0x4184, 0x40a0, 
+     0x5d54, 0x5c70, 0x5b8c, 0x59a7, 0x765c, 0x7578, 0x7493, 0x73af, 
+     0x9064, 0x8f7f, 0x8d9b, 0x8cb7, 0xa96b, 0xa887, 0xa7a3, 0xa6be, 
+     0xc373, 0xc18f, 0xc0aa, 0xbfc6, 0xdc7b, 0xdb96, 0xdab2, 0xd8ce, 
+     0x2747, 0x2663, 0x257e, 0x239a, 0x404f, 0x3f6a, 0x3e86, 0x3da2, 
+     0x5a56, 0x5872, 0x578e, 0x56a9, 0x735e, 0x727a, 0x7195, 0x6fb1, 
+     0x8c66, 0x8b81, 0x8a9d, 0x89b9, 0xa66d, 0xa589, 0xa3a5, 0xa2c0, 
+     0xbf75, 0xbe91, 0xbdac, 0xbcc8, 0xd97d, 0xd798, 0xd6b4, 0xd5d0, 
+     0x2449, 0x2265, 0x2180, 0x209c, 0x3d51, 0x3c6c, 0x3a88, 0x39a4, 
+     0x5658, 0x5574, 0x5490, 0x53ab, 0x7060, 0x6e7c, 0x6d97, 0x6cb3, 
+     0x8967, 0x8883, 0x879f, 0x85bb, 0xa26f, 0xa18b, 0xa0a7, 0x9fc2, 
+     0xbc77, 0xbb92, 0xb9ae, 0xb8ca, 0xd57e, 0xd49a, 0xd3b6, 0xd1d2 
   }, { 
-     0x3c3c, 0x502c, 0x641c, 0x780c, 0x3d48, 0x5138, 0x6528, 0x7919, 
-     0x3e54, 0x5245, 0x6635, 0x7b25, 0x3f61, 0x5351, 0x6741, 0x7c31, 
-     0x406d, 0x545d, 0x684e, 0x7d3e, 0x417a, 0x556a, 0x6a5a, 0x7e4a, 
-     0x4286, 0x5676, 0x6b67, 0x7f57, 0x4393, 0x5783, 0x6c73, 0x8063, 
-     0x474b, 0x5b3b, 0x702c, 0x841c, 0x4858, 0x5d48, 0x7138, 0x8528, 
-     0x4964, 0x5e54, 0x7245, 0x8635, 0x4a71, 0x5f61, 0x7351, 0x8741, 
-     0x4c7d, 0x606d, 0x745d, 0x884e, 0x4d89, 0x617a, 0x756a, 0x895a, 
-     0x4e96, 0x6286, 0x7676, 0x8b67, 0x4fa2, 0x6393, 0x7783, 0x8c73, 
-     0x535b, 0x674b, 0x7b3b, 0x902c, 0x5467, 0x6858, 0x7c48, 0x9138, 
-     0x5574, 0x6964, 0x7e54, 0x9244, 0x5680, 0x6a71, 0x7f61, 0x9351, 
-     0x578d, 0x6b7d, 0x806d, 0x945d, 0x5899, 0x6d89, 0x817a, 0x956a, 
-     0x59a6, 0x6e96, 0x8286, 0x9676, 0x5ab2, 0x6fa2, 0x8393, 0x9783, 
-     0x5e6b, 0x735b, 0x874b, 0x9b3b, 0x6077, 0x7467, 0x8858, 0x9c48, 
-     0x6184, 0x7574, 0x8964, 0x9d54, 0x6290, 0x7680, 0x8a70, 0x9f61, 
-     0x639d, 0x778d, 0x8b7d, 0xa06d, 0x64a9, 0x7899, 0x8c89, 0xa17a, 
-     0x65b5, 0x79a6, 0x8e96, 0xa286, 0x66c2, 0x7ab2, 0x8fa2, 0xa392, 
-     0x6a7b, 0x7e6b, 0x935b, 0xa74b, 0x6b87, 0x7f77, 0x9467, 0xa858, 
-     0x6c93, 0x8184, 0x9574, 0xa964, 0x6da0, 0x8290, 0x9680, 0xaa70, 
-     0x6eac, 0x839d, 0x978d, 0xab7d, 0x70b9, 0x84a9, 0x9899, 0xac89, 
-     0x71c5, 0x85b5, 0x99a6, 0xad96, 0x72d2, 0x86c2, 0x9ab2, 0xafa2, 
-     0x768a, 0x8a7a, 0x9e6b, 0xb35b, 0x7797, 0x8b87, 0x9f77, 0xb467, 
-     0x78a3, 0x8c93, 0xa084, 0xb574, 0x79b0, 0x8da0, 0xa290, 0xb680, 
-     0x7abc, 0x8eac, 0xa39c, 0xb78d, 0x7bc9, 0x8fb9, 0xa4a9, 0xb899, 
-     0x7cd5, 0x91c5, 0xa5b5, 0xb9a6, 0x7de1, 0x92d2, 0xa6c2, 0xbab2, 
-     0x819a, 0x968a, 0xaa7a, 0xbe6b, 0x82a6, 0x9797, 0xab87, 0xbf77, 
-     0x84b3, 0x98a3, 0xac93, 0xc084, 0x85bf, 0x99b0, 0xada0, 0xc190, 
-     0x86cc, 0x9abc, 0xaeac, 0xc39c, 0x87d8, 0x9bc8, 0xafb9, 0xc4a9, 
-     0x88e5, 0x9cd5, 0xb0c5, 0xc5b5, 0x89f1, 0x9de1, 0xb2d2, 0xc6c2, 
-     0x8daa, 0xa19a, 0xb68a, 0xca7a, 0x8eb6, 0xa2a6, 0xb797, 0xcb87, 
-     0x8fc3, 0xa3b3, 0xb8a3, 0xcc93, 0x90cf, 0xa5bf, 0xb9b0, 0xcda0, 
-     0x91dc, 0xa6cc, 0xbabc, 0xceac, 0x92e8, 0xa7d8, 0xbbc8, 0xcfb9, 
-     0x94f4, 0xa8e5, 0xbcd5, 0xd0c5, 0x95ff, 0xa9f1, 0xbde1, 0xd2d1 
+     0x3c3c, 0x5530, 0x6f25, 0x891a, 0x4043, 0x5a38, 0x732c, 0x8d21, 
+     0x444a, 0x5e3f, 0x7834, 0x9228, 0x4851, 0x6246, 0x7c3b, 0x9630, 
+     0x4d59, 0x664d, 0x8042, 0x9a37, 0x5160, 0x6b55, 0x8449, 0x9e3e, 
+     0x5567, 0x6f5c, 0x8951, 0xa346, 0x596e, 0x7363, 0x8d58, 0xa74d, 
+     0x424e, 0x5b43, 0x7538, 0x8f2d, 0x4656, 0x604b, 0x7a3f, 0x9334, 
+     0x4a5d, 0x6452, 0x7e47, 0x983b, 0x4e64, 0x6859, 0x824e, 0x9c43, 
+     0x536c, 0x6c60, 0x8655, 0xa04a, 0x5773, 0x7168, 0x8b5c, 0xa451, 
+     0x5b7a, 0x756f, 0x8f64, 0xa958, 0x5f81, 0x7976, 0x936b, 0xad60, 
+     0x4861, 0x6256, 0x7b4b, 0x9540, 0x4c69, 0x665d, 0x8052, 0x9947, 
+     0x5070, 0x6a65, 0x845a, 0x9e4e, 0x5477, 0x6e6c, 0x8861, 0xa256, 
+     0x597f, 0x7373, 0x8c68, 0xa65d, 0x5d86, 0x777b, 0x916f, 0xab64, 
+     0x618d, 0x7b82, 0x9577, 0xaf6b, 0x6694, 0x7f89, 0x997e, 0xb373, 
+     0x4e74, 0x6869, 0x815e, 0x9b53, 0x527c, 0x6c70, 0x8665, 0xa05a, 
+     0x5683, 0x7078, 0x8a6c, 0xa461, 0x5b8a, 0x747f, 0x8e74, 0xa869, 
+     0x5f92, 0x7986, 0x937b, 0xac70, 0x6399, 0x7d8e, 0x9782, 0xb177, 
+     0x67a0, 0x8195, 0x9b8a, 0xb57e, 0x6ca7, 0x859c, 0x9f91, 0xb986, 
+     0x5487, 0x6e7c, 0x8871, 0xa166, 0x588f, 0x7283, 0x8c78, 0xa66d, 
+     0x5c96, 0x768b, 0x907f, 0xaa74, 0x619d, 0x7a92, 0x9487, 0xae7b, 
+     0x65a4, 0x7f99, 0x998e, 0xb283, 0x69ac, 0x83a1, 0x9d95, 0xb78a, 
+     0x6db3, 0x87a8, 0xa19d, 0xbb91, 0x72ba, 0x8caf, 0xa5a4, 0xbf99, 
+     0x5a9a, 0x748f, 0x8e84, 0xa779, 0x5ea2, 0x7896, 0x928b, 0xac80, 
+     0x62a9, 0x7c9e, 0x9692, 0xb087, 0x67b0, 0x81a5, 0x9a9a, 0xb48e, 
+     0x6bb7, 0x85ac, 0x9fa1, 0xb996, 0x6fbf, 0x89b3, 0xa3a8, 0xbd9d, 
+     0x74c6, 0x8dbb, 0xa7b0, 0xc1a4, 0x78cd, 0x92c2, 0xabb7, 0xc5ac, 
+     0x60ad, 0x7aa2, 0x9497, 0xae8c, 0x64b5, 0x7ea9, 0x989e, 0xb293, 
+     0x69bc, 0x82b1, 0x9ca5, 0xb69a, 0x6dc3, 0x87b8, 0xa1ad, 0xbaa1, 
+     0x71ca, 0x8bbf, 0xa5b4, 0xbfa9, 0x75d2, 0x8fc6, 0xa9bb, 0xc3b0, 
+     0x7ad9, 0x93ce, 0xadc2, 0xc7b7, 0x7ee0, 0x98d5, 0xb2ca, 0xcbbf, 
+     0x66c0, 0x80b5, 0x9aaa, 0xb49f, 0x6ac7, 0x84bc, 0x9eb1, 0xb8a6, 
+     0x6fcf, 0x89c4, 0xa2b8, 0xbcad, 0x73d6, 0x8dcb, 0xa7c0, 0xc0b4, 
+     0x77dd, 0x91d2, 0xabc7, 0xc5bc, 0x7be5, 0x95d9, 0xafce, 0xc9c3, 
+     0x80ec, 0x9ae1, 0xb3d5, 0xcdca, 0x84f3, 0x9ee8, 0xb8dd, 0xd2d2 
   }, { 
-     0x3c3c, 0x2b4a, 0x1a59, 0x0968, 0x4c52, 0x3b61, 0x2a6f, 0x197e, 
-     0x5c68, 0x4b77, 0x3b86, 0x2a94, 0x6d7e, 0x5c8d, 0x4b9c, 0x3aab, 
-     0x7d94, 0x6ca3, 0x5bb2, 0x4bc1, 0x8dab, 0x7db9, 0x6cc8, 0x5bd7, 
-     0x9ec1, 0x8dd0, 0x7cde, 0x6bed, 0xaed7, 0x9de6, 0x8df5, 0x7cff, 
-     0x4834, 0x3743, 0x2652, 0x1561, 0x584b, 0x4759, 0x3668, 0x2677, 
-     0x6961, 0x5870, 0x477e, 0x368d, 0x7977, 0x6886, 0x5795, 0x46a3, 
-     0x898d, 0x789c, 0x68ab, 0x57ba, 0x9aa4, 0x89b2, 0x78c1, 0x67d0, 
-     0xaaba, 0x99c9, 0x88d7, 0x78e6, 0xbad0, 0xaadf, 0x99ee, 0x88fc, 
-     0x542d, 0x433c, 0x324b, 0x225a, 0x6443, 0x5452, 0x4361, 0x3270, 
-     0x755a, 0x6468, 0x5377, 0x4286, 0x8570, 0x747f, 0x648d, 0x539c, 
-     0x9686, 0x8595, 0x74a4, 0x63b2, 0xa69c, 0x95ab, 0x84ba, 0x73c9, 
-     0xb6b3, 0xa6c1, 0x95d0, 0x84df, 0xc7c9, 0xb6d8, 0xa5e6, 0x94f5, 
-     0x6026, 0x4f35, 0x3f44, 0x2e52, 0x713c, 0x604b, 0x4f5a, 0x3e69, 
-     0x8153, 0x7061, 0x5f70, 0x4f7f, 0x9169, 0x8178, 0x7086, 0x5f95, 
-     0xa27f, 0x918e, 0x809d, 0x6fab, 0xb295, 0xa1a4, 0x91b3, 0x80c2, 
-     0xc3ac, 0xb2ba, 0xa1c9, 0x90d8, 0xd3c2, 0xc2d1, 0xb1df, 0xa0ee, 
-     0x6d1f, 0x5c2e, 0x4b3c, 0x3a4b, 0x7d35, 0x6c44, 0x5b53, 0x4a61, 
-     0x8d4b, 0x7c5a, 0x6c69, 0x5b78, 0x9e62, 0x8d70, 0x7c7f, 0x6b8e, 
-     0xae78, 0x9d87, 0x8c95, 0x7ca4, 0xbe8e, 0xae9d, 0x9dac, 0x8cba, 
-     0xcfa4, 0xbeb3, 0xadc2, 0x9cd1, 0xdfbb, 0xcec9, 0xbed8, 0xade7, 
-     0x7918, 0x6827, 0x5735, 0x4644, 0x892e, 0x783d, 0x674c, 0x575a, 
-     0x9a44, 0x8953, 0x7862, 0x6771, 0xaa5b, 0x9969, 0x8878, 0x7787, 
-     0xba71, 0xa980, 0x998e, 0x889d, 0xcb87, 0xba96, 0xa9a5, 0x98b3, 
-     0xdb9d, 0xcaac, 0xb9bb, 0xa9ca, 0xebb3, 0xdbc2, 0xcad1, 0xb9e0, 
-     0x8511, 0x741f, 0x632e, 0x533d, 0x9527, 0x8536, 0x7444, 0x6353, 
-     0xa63d, 0x954c, 0x845b, 0x7369, 0xb653, 0xa562, 0x9571, 0x8480, 
-     0xc76a, 0xb678, 0xa587, 0x9496, 0xd780, 0xc68f, 0xb59d, 0xa4ac, 
-     0xe796, 0xd7a5, 0xc6b4, 0xb5c2, 0xf8ac, 0xe7bb, 0xd6ca, 0xc5d9, 
-     0x910a, 0x8018, 0x7027, 0x5f36, 0xa220, 0x912f, 0x803d, 0x6f4c, 
-     0xb236, 0xa145, 0x9054, 0x8062, 0xc24c, 0xb25b, 0xa16a, 0x9079, 
-     0xd362, 0xc271, 0xb180, 0xa08f, 0xe379, 0xd287, 0xc296, 0xb1a5, 
-     0xf48f, 0xe39e, 0xd2ac, 0xc1bb, 0xffa5, 0xf3b4, 0xe2c3, 0xd1d1 
+     0x3c3c, 0x2d41, 0x1e47, 0x0f4d, 0x4754, 0x385a, 0x2960, 0x1a65, 
+     0x526d, 0x4373, 0x3479, 0x257e, 0x5d86, 0x4e8c, 0x3f91, 0x3097, 
+     0x689f, 0x59a4, 0x4aaa, 0x3bb0, 0x73b8, 0x64bd, 0x55c3, 0x46c9, 
+     0x7ed0, 0x6fd6, 0x60dc, 0x51e1, 0x89e9, 0x7aef, 0x6bf5, 0x5cfa, 
+     0x4c36, 0x3d3b, 0x2e41, 0x1f47, 0x574e, 0x4854, 0x395a, 0x2a60, 
+     0x6267, 0x536d, 0x4473, 0x3678, 0x6e80, 0x5f86, 0x508c, 0x4191, 
+     0x7999, 0x6a9f, 0x5ba4, 0x4caa, 0x84b2, 0x75b7, 0x66bd, 0x57c3, 
+     0x8fcb, 0x80d0, 0x71d6, 0x62dc, 0x9ae3, 0x8be9, 0x7cef, 0x6df4, 
+     0x5d30, 0x4e36, 0x3f3b, 0x3041, 0x6849, 0x594e, 0x4a54, 0x3b5a, 
+     0x7361, 0x6467, 0x556d, 0x4673, 0x7e7a, 0x6f80, 0x6086, 0x518b, 
+     0x8993, 0x7a99, 0x6b9e, 0x5ca4, 0x95ac, 0x86b2, 0x77b7, 0x68bd, 
+     0xa0c5, 0x91ca, 0x82d0, 0x73d6, 0xabde, 0x9ce3, 0x8de9, 0x7eef, 
+     0x6e2a, 0x5f30, 0x5035, 0x413b, 0x7943, 0x6a49, 0x5b4e, 0x4c54, 
+     0x845c, 0x7561, 0x6667, 0x576d, 0x8f74, 0x807a, 0x7180, 0x6286, 
+     0x9a8d, 0x8b93, 0x7c99, 0x6d9e, 0xa5a6, 0x96ac, 0x87b1, 0x78b7, 
+     0xb0bf, 0xa1c5, 0x92ca, 0x83d0, 0xbcd8, 0xaddd, 0x9ee3, 0x8fe9, 
+     0x7e24, 0x6f2a, 0x6030, 0x5135, 0x8a3d, 0x7b43, 0x6c48, 0x5d4e, 
+     0x9556, 0x865c, 0x7761, 0x6867, 0xa06f, 0x9174, 0x827a, 0x7380, 
+     0xab87, 0x9c8d, 0x8d93, 0x7e99, 0xb6a0, 0xa7a6, 0x98ac, 0x89b1, 
+     0xc1b9, 0xb2bf, 0xa3c4, 0x94ca, 0xccd2, 0xbdd8, 0xaedd, 0x9fe3, 
+     0x8f1e, 0x8024, 0x712a, 0x622f, 0x9a37, 0x8b3d, 0x7c43, 0x6d48, 
+     0xa550, 0x9656, 0x875b, 0x7861, 0xb169, 0xa26f, 0x9374, 0x847a, 
+     0xbc82, 0xad87, 0x9e8d, 0x8f93, 0xc79a, 0xb8a0, 0xa9a6, 0x9aac, 
+     0xd2b3, 0xc3b9, 0xb4bf, 0xa5c4, 0xddcc, 0xced2, 0xbfd7, 0xb0dd, 
+     0xa019, 0x911e, 0x8224, 0x732a, 0xab31, 0x9c37, 0x8d3d, 0x7e42, 
+     0xb64a, 0xa750, 0x9856, 0x895b, 0xc163, 0xb269, 0xa36e, 0x9474, 
+     0xcc7c, 0xbd81, 0xae87, 0x9f8d, 0xd795, 0xc99a, 0xbaa0, 0xaba6, 
+     0xe3ad, 0xd4b3, 0xc5b9, 0xb6bf, 0xeec6, 0xdfcc, 0xd0d2, 0xc1d7, 
+     0xb113, 0xa218, 0x931e, 0x8424, 0xbc2c, 0xad31, 0x9e37, 0x8f3d, 
+     0xc744, 0xb84a, 0xa950, 0x9a55, 0xd25d, 0xc363, 0xb469, 0xa56e, 
+     0xdd76, 0xce7c, 0xbf81, 0xb087, 0xe88f, 0xd994, 0xca9a, 0xbba0, 
+     0xf3a8, 0xe4ad, 0xd5b3, 0xc6b9, 0xfec0, 0xefc6, 0xe0cc, 0xd2d1 
   }, { 
-     0x3c3c, 0x504a, 0x6558, 0x7967, 0x4f3c, 0x634a, 0x7858, 0x8c67, 
-     0x623c, 0x764a, 0x8b58, 0xa067, 0x753c, 0x8a4a, 0x9e58, 0xb367, 
-     0x883c, 0x9d4a, 0xb158, 0xc667, 0x9b3c, 0xb04a, 0xc558, 0xd967, 
-     0xaf3c, 0xc34a, 0xd858, 0xec67, 0xc23c, 0xd64a, 0xeb58, 0xff67, 
-     0x354b, 0x4a59, 0x5e68, 0x7376, 0x484b, 0x5d59, 0x7168, 0x8676, 
-     0x5b4b, 0x7059, 0x8468, 0x9976, 0x6e4b, 0x8359, 0x9868, 0xac76, 
-     0x824b, 0x9659, 0xab68, 0xbf76, 0x954b, 0xa959, 0xbe68, 0xd376, 
-     0xa84b, 0xbd59, 0xd168, 0xe676, 0xbb4b, 0xd059, 0xe468, 0xf976, 
-     0x2e5a, 0x4368, 0x5877, 0x6c85, 0x425a, 0x5668, 0x6b77, 0x7f85, 
-     0x555a, 0x6968, 0x7e77, 0x9285, 0x685a, 0x7c68, 0x9177, 0xa685, 
-     0x7b5a, 0x9068, 0xa477, 0xb985, 0x8e5a, 0xa368, 0xb777, 0xcc85, 
-     0xa15a, 0xb668, 0xcb77, 0xdf85, 0xb55a, 0xc968, 0xde77, 0xf285, 
-     0x2869, 0x3c78, 0x5186, 0x6694, 0x3b69, 0x5078, 0x6486, 0x7994, 
-     0x4e69, 0x6378, 0x7786, 0x8c94, 0x6169, 0x7678, 0x8a86, 0x9f94, 
-     0x7469, 0x8978, 0x9e86, 0xb294, 0x8869, 0x9c78, 0xb186, 0xc594, 
-     0x9b69, 0xaf78, 0xc486, 0xd994, 0xae69, 0xc378, 0xd786, 0xec94, 
-     0x2179, 0x3687, 0x4a95, 0x5fa4, 0x3479, 0x4987, 0x5e95, 0x72a4, 
-     0x4879, 0x5c87, 0x7195, 0x85a4, 0x5b79, 0x6f87, 0x8495, 0x99a4, 
-     0x6e79, 0x8387, 0x9795, 0xaca4, 0x8179, 0x9687, 0xaa95, 0xbfa4, 
-     0x9479, 0xa987, 0xbd95, 0xd2a4, 0xa779, 0xbc87, 0xd195, 0xe5a4, 
-     0x1b88, 0x2f96, 0x44a5, 0x58b3, 0x2e88, 0x4296, 0x57a5, 0x6cb3, 
-     0x4188, 0x5696, 0x6aa5, 0x7fb3, 0x5488, 0x6996, 0x7da5, 0x92b3, 
-     0x6788, 0x7c96, 0x91a5, 0xa5b3, 0x7b88, 0x8f96, 0xa4a5, 0xb8b3, 
-     0x8e88, 0xa296, 0xb7a5, 0xcbb3, 0xa188, 0xb596, 0xcaa5, 0xdfb3, 
-     0x1497, 0x29a5, 0x3db4, 0x52c2, 0x2797, 0x3ca5, 0x50b4, 0x65c2, 
-     0x3a97, 0x4fa5, 0x64b4, 0x78c2, 0x4e97, 0x62a5, 0x77b4, 0x8bc2, 
-     0x6197, 0x75a5, 0x8ab4, 0x9fc2, 0x7497, 0x89a5, 0x9db4, 0xb2c2, 
-     0x8797, 0x9ca5, 0xb0b4, 0xc5c2, 0x9a97, 0xafa5, 0xc3b4, 0xd8c2, 
-     0x0da6, 0x22b5, 0x37c3, 0x4bd1, 0x21a6, 0x35b5, 0x4ac3, 0x5ed1, 
-     0x34a6, 0x48b5, 0x5dc3, 0x72d1, 0x47a6, 0x5cb5, 0x70c3, 0x85d1, 
-     0x5aa6, 0x6fb5, 0x83c3, 0x98d1, 0x6da6, 0x82b5, 0x97c3, 0xabd1, 
-     0x81a6, 0x95b5, 0xaac3, 0xbed1, 0x94a6, 0xa8b5, 0xbdc3, 0xd1d2 
+     0x3c3c, 0x4851, 0x5567, 0x617d, 0x533d, 0x5f53, 0x6c69, 0x787f, 
+     0x6a3f, 0x7655, 0x836b, 0x8f81, 0x8141, 0x8d57, 0x9a6d, 0xa683, 
+     0x9842, 0xa458, 0xb16e, 0xbe84, 0xaf44, 0xbb5a, 0xc870, 0xd586, 
+     0xc646, 0xd25c, 0xdf72, 0xec88, 0xdd48, 0xea5d, 0xf673, 0xff89, 
+     0x3446, 0x415c, 0x4e72, 0x5a88, 0x4c48, 0x585d, 0x6573, 0x7189, 
+     0x6349, 0x6f5f, 0x7c75, 0x888b, 0x7a4b, 0x8661, 0x9377, 0x9f8d, 
+     0x914d, 0x9d63, 0xaa79, 0xb68f, 0xa84e, 0xb464, 0xc17a, 0xce90, 
+     0xbf50, 0xcb66, 0xd87c, 0xe592, 0xd652, 0xe268, 0xef7e, 0xfc94, 
+     0x2d50, 0x3a66, 0x477c, 0x5392, 0x4552, 0x5168, 0x5e7e, 0x6a94, 
+     0x5c54, 0x6869, 0x757f, 0x8195, 0x7355, 0x7f6b, 0x8c81, 0x9897, 
+     0x8a57, 0x966d, 0xa383, 0xaf99, 0xa159, 0xad6f, 0xba85, 0xc79b, 
+     0xb85a, 0xc470, 0xd186, 0xde9c, 0xcf5c, 0xdb72, 0xe888, 0xf59e, 
+     0x265a, 0x3370, 0x4086, 0x4c9c, 0x3d5c, 0x4a72, 0x5788, 0x639e, 
+     0x555e, 0x6174, 0x6e8a, 0x7aa0, 0x6c60, 0x7876, 0x858b, 0x91a1, 
+     0x8361, 0x8f77, 0x9c8d, 0xa8a3, 0x9a63, 0xa679, 0xb38f, 0xbfa5, 
+     0xb165, 0xbd7b, 0xca91, 0xd7a7, 0xc866, 0xd47c, 0xe192, 0xeea8, 
+     0x1f65, 0x2c7b, 0x3991, 0x45a7, 0x3666, 0x437c, 0x5092, 0x5ca8, 
+     0x4e68, 0x5a7e, 0x6794, 0x73aa, 0x656a, 0x7180, 0x7e96, 0x8aac, 
+     0x7c6c, 0x8882, 0x9597, 0xa1ad, 0x936d, 0x9f83, 0xac99, 0xb8af, 
+     0xaa6f, 0xb685, 0xc39b, 0xd0b1, 0xc171, 0xcd87, 0xda9d, 0xe7b3, 
+     0x186f, 0x2585, 0x329b, 0x3eb1, 0x2f71, 0x3c87, 0x499d, 0x55b3, 
+     0x4672, 0x5388, 0x609e, 0x6cb4, 0x5e74, 0x6a8a, 0x77a0, 0x83b6, 
+     0x7576, 0x818c, 0x8ea2, 0x9ab8, 0x8c78, 0x988e, 0xa5a4, 0xb1b9, 
+     0xa379, 0xaf8f, 0xbca5, 0xc8bb, 0xba7b, 0xc691, 0xd3a7, 0xe0bd, 
+     0x1179, 0x1e8f, 0x2ba5, 0x37bb, 0x287b, 0x3591, 0x42a7, 0x4ebd, 
+     0x3f7d, 0x4c93, 0x59a9, 0x65bf, 0x577e, 0x6394, 0x70aa, 0x7cc0, 
+     0x6e80, 0x7a96, 0x87ac, 0x93c2, 0x8582, 0x9198, 0x9eae, 0xaac4, 
+     0x9c84, 0xa89a, 0xb5b0, 0xc1c5, 0xb385, 0xbf9b, 0xccb1, 0xd9c7, 
+     0x0a84, 0x179a, 0x23b0, 0x30c5, 0x2185, 0x2e9b, 0x3bb1, 0x47c7, 
+     0x3887, 0x459d, 0x52b3, 0x5ec9, 0x4f89, 0x5c9f, 0x69b5, 0x75cb, 
+     0x678a, 0x73a0, 0x80b6, 0x8ccc, 0x7e8c, 0x8aa2, 0x97b8, 0xa3ce, 
+     0x958e, 0xa1a4, 0xaeba, 0xbad0, 0xac90, 0xb8a6, 0xc5bc, 0xd1d2 
   }, { 
-     0x3c3c, 0x432c, 0x4b1c, 0x520c, 0x3c4f, 0x4340, 0x4b30, 0x5320, 
-     0x3c63, 0x4354, 0x4b44, 0x5334, 0x3c77, 0x4468, 0x4b58, 0x5348, 
-     0x3c8b, 0x447c, 0x4b6c, 0x535c, 0x3c9f, 0x4490, 0x4c80, 0x5370, 
-     0x3cb3, 0x44a4, 0x4c94, 0x5384, 0x3dc7, 0x44b8, 0x4ca8, 0x5398, 
-     0x4e44, 0x5534, 0x5d24, 0x6415, 0x4e58, 0x5548, 0x5d38, 0x6529, 
-     0x4e6c, 0x555c, 0x5d4c, 0x653d, 0x4e80, 0x5670, 0x5d60, 0x6551, 
-     0x4e94, 0x5684, 0x5d74, 0x6565, 0x4ea8, 0x5698, 0x5e88, 0x6578, 
-     0x4ebb, 0x56ac, 0x5e9c, 0x658c, 0x4fcf, 0x56c0, 0x5eb0, 0x65a0, 
-     0x604c, 0x673c, 0x6f2d, 0x761d, 0x6060, 0x6750, 0x6f40, 0x7731, 
-     0x6074, 0x6764, 0x6f54, 0x7745, 0x6088, 0x6878, 0x6f68, 0x7759, 
-     0x609c, 0x688c, 0x6f7c, 0x776d, 0x60b0, 0x68a0, 0x7090, 0x7781, 
-     0x60c4, 0x68b4, 0x70a4, 0x7795, 0x61d8, 0x68c8, 0x70b8, 0x77a9, 
-     0x7254, 0x7944, 0x8135, 0x8825, 0x7268, 0x7958, 0x8149, 0x8939, 
-     0x727c, 0x796c, 0x815d, 0x894d, 0x7290, 0x7a80, 0x8171, 0x8961, 
-     0x72a4, 0x7a94, 0x8185, 0x8975, 0x72b8, 0x7aa8, 0x8299, 0x8989, 
-     0x72cc, 0x7abc, 0x82ac, 0x899d, 0x73e0, 0x7ad0, 0x82c0, 0x89b1, 
-     0x845c, 0x8b4d, 0x933d, 0x9a2d, 0x8470, 0x8b61, 0x9351, 0x9b41, 
-     0x8484, 0x8b74, 0x9365, 0x9b55, 0x8498, 0x8c88, 0x9379, 0x9b69, 
-     0x84ac, 0x8c9c, 0x938d, 0x9b7d, 0x84c0, 0x8cb0, 0x94a1, 0x9b91, 
-     0x84d4, 0x8cc4, 0x94b5, 0x9ba5, 0x85e8, 0x8cd8, 0x94c9, 0x9bb9, 
-     0x9664, 0x9d55, 0xa545, 0xac35, 0x9678, 0x9d69, 0xa559, 0xad49, 
-     0x968c, 0x9d7d, 0xa56d, 0xad5d, 0x96a0, 0x9e91, 0xa581, 0xad71, 
-     0x96b4, 0x9ea5, 0xa595, 0xad85, 0x96c8, 0x9eb9, 0xa6a9, 0xad99, 
-     0x96dc, 0x9ecd, 0xa6bd, 0xadad, 0x97f0, 0x9ee0, 0xa6d1, 0xadc1, 
-     0xa86d, 0xaf5d, 0xb74d, 0xbe3e, 0xa881, 0xaf71, 0xb761, 0xbf52, 
-     0xa895, 0xaf85, 0xb775, 0xbf65, 0xa8a8, 0xb099, 0xb789, 0xbf79, 
-     0xa8bc, 0xb0ad, 0xb79d, 0xbf8d, 0xa8d0, 0xb0c1, 0xb8b1, 0xbfa1, 
-     0xa8e4, 0xb0d5, 0xb8c5, 0xbfb5, 0xa9f8, 0xb0e9, 0xb8d9, 0xbfc9, 
-     0xba75, 0xc165, 0xc955, 0xd046, 0xba89, 0xc179, 0xc969, 0xd15a, 
-     0xba9d, 0xc18d, 0xc97d, 0xd16e, 0xbab1, 0xc2a1, 0xc991, 0xd182, 
-     0xbac5, 0xc2b5, 0xc9a5, 0xd196, 0xbad9, 0xc2c9, 0xcab9, 0xd1aa, 
-     0xbaed, 0xc2dd, 0xcacd, 0xd1be, 0xbbff, 0xc2f1, 0xcae1, 0xd2d1 
+     0x3c3c, 0x4c2b, 0x5c1a, 0x6d09, 0x3c4b, 0x4c3a, 0x5d29, 0x6d18, 
+     0x3c5a, 0x4c49, 0x5d38, 0x6d27, 0x3c69, 0x4d58, 0x5d47, 0x6e37, 
+     0x3c78, 0x4d67, 0x5d56, 0x6e46, 0x3d87, 0x4d76, 0x5e66, 0x6e55, 
+     0x3d96, 0x4d85, 0x5e75, 0x6e64, 0x3da5, 0x4e94, 0x5e84, 0x6f73, 
+     0x4a49, 0x5a38, 0x6b28, 0x7b17, 0x4a58, 0x5a47, 0x6b37, 0x7b26, 
+     0x4a67, 0x5b56, 0x6b46, 0x7c35, 0x4a76, 0x5b66, 0x6b55, 0x7c44, 
+     0x4b85, 0x5b75, 0x6c64, 0x7c53, 0x4b94, 0x5b84, 0x6c73, 0x7c62, 
+     0x4ba4, 0x5c93, 0x6c82, 0x7c71, 0x4bb3, 0x5ca2, 0x6c91, 0x7d80, 
+     0x5857, 0x6846, 0x7935, 0x8924, 0x5866, 0x6855, 0x7944, 0x8933, 
+     0x5875, 0x6964, 0x7953, 0x8a42, 0x5884, 0x6973, 0x7962, 0x8a52, 
+     0x5993, 0x6982, 0x7a71, 0x8a61, 0x59a2, 0x6991, 0x7a81, 0x8a70, 
+     0x59b1, 0x6aa0, 0x7a90, 0x8b7f, 0x59c0, 0x6aaf, 0x7a9f, 0x8b8e, 
+     0x6664, 0x7653, 0x8743, 0x9732, 0x6673, 0x7762, 0x8752, 0x9841, 
+     0x6682, 0x7771, 0x8761, 0x9850, 0x6791, 0x7781, 0x8870, 0x985f, 
+     0x67a0, 0x7790, 0x887f, 0x986e, 0x67af, 0x789f, 0x888e, 0x997d, 
+     0x67bf, 0x78ae, 0x889d, 0x998c, 0x67ce, 0x78bd, 0x88ac, 0x999b, 
+     0x7472, 0x8561, 0x9550, 0xa63f, 0x7481, 0x8570, 0x955f, 0xa64e, 
+     0x7490, 0x857f, 0x956e, 0xa65e, 0x759f, 0x858e, 0x967d, 0xa66d, 
+     0x75ae, 0x859d, 0x968c, 0xa67c, 0x75bd, 0x86ac, 0x969c, 0xa78b, 
+     0x75cc, 0x86bb, 0x96ab, 0xa79a, 0x76db, 0x86ca, 0x97ba, 0xa7a9, 
+     0x827f, 0x936e, 0xa35e, 0xb44d, 0x828e, 0x937d, 0xa36d, 0xb45c, 
+     0x839d, 0x938c, 0xa47c, 0xb46b, 0x83ac, 0x939c, 0xa48b, 0xb47a, 
+     0x83bb, 0x94ab, 0xa49a, 0xb589, 0x83cb, 0x94ba, 0xa4a9, 0xb598, 
+     0x84da, 0x94c9, 0xa5b8, 0xb5a7, 0x84e9, 0x94d8, 0xa5c7, 0xb5b6, 
+     0x908d, 0xa17c, 0xb16b, 0xc25a, 0x919c, 0xa18b, 0xb17a, 0xc269, 
+     0x91ab, 0xa19a, 0xb289, 0xc279, 0x91ba, 0xa1a9, 0xb298, 0xc288, 
+     0x91c9, 0xa2b8, 0xb2a7, 0xc397, 0x91d8, 0xa2c7, 0xb2b7, 0xc3a6, 
+     0x92e7, 0xa2d6, 0xb3c6, 0xc3b5, 0x92f6, 0xa2e5, 0xb3d5, 0xc3c4, 
+     0x9e9a, 0xaf89, 0xbf79, 0xd068, 0x9fa9, 0xaf98, 0xc088, 0xd077, 
+     0x9fb8, 0xafa7, 0xc097, 0xd086, 0x9fc7, 0xb0b7, 0xc0a6, 0xd195, 
+     0x9fd6, 0xb0c6, 0xc0b5, 0xd1a4, 0xa0e6, 0xb0d5, 0xc1c4, 0xd1b3, 
+     0xa0f5, 0xb0e4, 0xc1d3, 0xd1c2, 0xa0ff, 0xb1f3, 0xc1e2, 0xd2d2 
   }, { 
-     0x3c3c, 0x2f54, 0x236d, 0x1686, 0x524b, 0x4664, 0x397d, 0x2d96, 
-     0x695a, 0x5d73, 0x508c, 0x44a5, 0x806a, 0x7483, 0x679c, 0x5bb5, 
-     0x9779, 0x8a92, 0x7eab, 0x71c4, 0xae89, 0xa1a2, 0x95bb, 0x88d4, 
-     0xc498, 0xb8b1, 0xacca, 0x9fe3, 0xdba8, 0xcfc1, 0xc2da, 0xb6f3, 
-     0x3f37, 0x3350, 0x2769, 0x1a82, 0x5646, 0x4a5f, 0x3d78, 0x3191, 
-     0x6d56, 0x616f, 0x5488, 0x48a1, 0x8465, 0x777e, 0x6b97, 0x5fb0, 
-     0x9b75, 0x8e8e, 0x82a7, 0x75c0, 0xb284, 0xa59d, 0x99b6, 0x8ccf, 
-     0xc894, 0xbcad, 0xafc6, 0xa3de, 0xdfa3, 0xd3bc, 0xc6d5, 0xbaee, 
-     0x4332, 0x374b, 0x2a64, 0x1e7d, 0x5a41, 0x4e5a, 0x4173, 0x358c, 
-     0x7151, 0x656a, 0x5883, 0x4c9c, 0x8860, 0x7b79, 0x6f92, 0x63ab, 
-     0x9f70, 0x9289, 0x86a2, 0x79bb, 0xb67f, 0xa998, 0x9db1, 0x90ca, 
-     0xcc8f, 0xc0a8, 0xb3c1, 0xa7da, 0xe39e, 0xd7b7, 0xcad0, 0xbee9, 
-     0x472d, 0x3b46, 0x2e5f, 0x2278, 0x5e3d, 0x5256, 0x456f, 0x3988, 
-     0x754c, 0x6965, 0x5c7e, 0x5097, 0x8c5c, 0x7f75, 0x738e, 0x66a7, 
-     0xa36b, 0x9684, 0x8a9d, 0x7db6, 0xb97b, 0xad94, 0xa1ad, 0x94c6, 
-     0xd08a, 0xc4a3, 0xb7bc, 0xabd5, 0xe79a, 0xdbb3, 0xcecc, 0xc2e4, 
-     0x4b29, 0x3f41, 0x325a, 0x2673, 0x6238, 0x5651, 0x496a, 0x3d83, 
-     0x7947, 0x6c60, 0x6079, 0x5492, 0x9057, 0x8370, 0x7789, 0x6aa2, 
-     0xa766, 0x9a7f, 0x8e98, 0x81b1, 0xbd76, 0xb18f, 0xa4a8, 0x98c1, 
-     0xd485, 0xc89e, 0xbbb7, 0xafd0, 0xeb95, 0xdfae, 0xd2c7, 0xc6e0, 
-     0x4f24, 0x433d, 0x3656, 0x2a6f, 0x6633, 0x5a4c, 0x4d65, 0x417e, 
-     0x7d43, 0x705c, 0x6475, 0x578e, 0x9452, 0x876b, 0x7b84, 0x6e9d, 
-     0xaa62, 0x9e7b, 0x9294, 0x85ad, 0xc171, 0xb58a, 0xa8a3, 0x9cbc, 
-     0xd881, 0xcc9a, 0xbfb3, 0xb3cc, 0xef90, 0xe3a9, 0xd6c2, 0xcadb, 
-     0x531f, 0x4738, 0x3a51, 0x2e6a, 0x6a2f, 0x5e47, 0x5160, 0x4579, 
-     0x813e, 0x7457, 0x6870, 0x5b89, 0x984d, 0x8b66, 0x7f7f, 0x7298, 
-     0xae5d, 0xa276, 0x968f, 0x89a8, 0xc56c, 0xb985, 0xac9e, 0xa0b7, 
-     0xdc7c, 0xd095, 0xc3ae, 0xb7c7, 0xf38b, 0xe6a4, 0xdabd, 0xced6, 
-     0x571a, 0x4b33, 0x3e4c, 0x3265, 0x6e2a, 0x6143, 0x555c, 0x4975, 
-     0x8539, 0x7852, 0x6c6b, 0x5f84, 0x9c49, 0x8f62, 0x837b, 0x7694, 
-     0xb258, 0xa671, 0x998a, 0x8da3, 0xc968, 0xbd81, 0xb09a, 0xa4b3, 
-     0xe077, 0xd490, 0xc7a9, 0xbbc2, 0xf787, 0xeaa0, 0xdeb9, 0xd1d1 
+     0x3c3c, 0x2b4e, 0x1b61, 0x0b74, 0x4e50, 0x3e63, 0x2e75, 0x1d88, 
+     0x6164, 0x5177, 0x418a, 0x309c, 0x7478, 0x648b, 0x539e, 0x43b1, 
+     0x878d, 0x779f, 0x66b2, 0x56c5, 0x9aa1, 0x89b4, 0x79c7, 0x69d9, 
+     0xadb5, 0x9cc8, 0x8cdb, 0x7cee, 0xbfca, 0xafdc, 0x9fef, 0x8eff, 
+     0x4535, 0x3547, 0x245a, 0x146d, 0x5849, 0x485c, 0x376e, 0x2781, 
+     0x6b5d, 0x5a70, 0x4a83, 0x3a96, 0x7e71, 0x6d84, 0x5d97, 0x4daa, 
+     0x9086, 0x8099, 0x70ab, 0x60be, 0xa39a, 0x93ad, 0x83c0, 0x72d2, 
+     0xb6ae, 0xa6c1, 0x95d4, 0x85e7, 0xc9c3, 0xb9d5, 0xa8e8, 0x98fb, 
+     0x4f2e, 0x3e40, 0x2e53, 0x1e66, 0x6142, 0x5155, 0x4168, 0x317a, 
+     0x7456, 0x6469, 0x547c, 0x438f, 0x876b, 0x777d, 0x6790, 0x56a3, 
+     0x9a7f, 0x8a92, 0x79a4, 0x69b7, 0xad93, 0x9da6, 0x8cb9, 0x7ccb, 
+     0xc0a7, 0xafba, 0x9fcd, 0x8fe0, 0xd3bc, 0xc2ce, 0xb2e1, 0xa2f4, 
+     0x5827, 0x483a, 0x384c, 0x275f, 0x6b3b, 0x5b4e, 0x4a61, 0x3a73, 
+     0x7e4f, 0x6e62, 0x5d75, 0x4d88, 0x9164, 0x8076, 0x7089, 0x609c, 
+     0xa478, 0x938b, 0x839d, 0x73b0, 0xb68c, 0xa69f, 0x96b2, 0x86c5, 
+     0xc9a0, 0xb9b3, 0xa9c6, 0x98d9, 0xdcb5, 0xccc8, 0xbbda, 0xabed, 
+     0x6220, 0x5233, 0x4145, 0x3158, 0x7534, 0x6447, 0x545a, 0x446d, 
+     0x8748, 0x775b, 0x676e, 0x5781, 0x9a5d, 0x8a70, 0x7a82, 0x6995, 
+     0xad71, 0x9d84, 0x8d97, 0x7ca9, 0xc085, 0xb098, 0x9fab, 0x8fbe, 
+     0xd39a, 0xc3ac, 0xb2bf, 0xa2d2, 0xe6ae, 0xd5c1, 0xc5d3, 0xb5e6, 
+     0x6b19, 0x5b2c, 0x4b3f, 0x3a51, 0x7e2d, 0x6e40, 0x5e53, 0x4d66, 
+     0x9142, 0x8154, 0x7067, 0x607a, 0xa456, 0x9469, 0x837b, 0x738e, 
+     0xb76a, 0xa67d, 0x9690, 0x86a2, 0xca7e, 0xb991, 0xa9a4, 0x99b7, 
+     0xdc93, 0xcca5, 0xbcb8, 0xaccb, 0xefa7, 0xdfba, 0xcfcd, 0xbedf, 
+     0x7512, 0x6525, 0x5438, 0x444a, 0x8826, 0x7839, 0x674c, 0x575f, 
+     0x9b3b, 0x8a4d, 0x7a60, 0x6a73, 0xad4f, 0x9d62, 0x8d74, 0x7d87, 
+     0xc063, 0xb076, 0xa089, 0x8f9c, 0xd377, 0xc38a, 0xb39d, 0xa2b0, 
+     0xe68c, 0xd69f, 0xc5b1, 0xb5c4, 0xf9a0, 0xe9b3, 0xd8c6, 0xc8d8, 
+     0x7f0b, 0x6e1e, 0x5e31, 0x4e43, 0x911f, 0x8132, 0x7145, 0x6058, 
+     0xa434, 0x9446, 0x8459, 0x736c, 0xb748, 0xa75b, 0x966e, 0x8680, 
+     0xca5c, 0xba6f, 0xa982, 0x9995, 0xdd71, 0xcc83, 0xbc96, 0xaca9, 
+     0xf085, 0xdf98, 0xcfaa, 0xbfbd, 0xff99, 0xf2ac, 0xe2bf, 0xd2d1 
   }, { 
-     0x3c3c, 0x573c, 0x723d, 0x8e3d, 0x473d, 0x623e, 0x7e3e, 0x993f, 
-     0x533f, 0x6e3f, 0x8940, 0xa541, 0x5e40, 0x7941, 0x9541, 0xb042, 
-     0x6a42, 0x8542, 0xa043, 0xbc44, 0x7543, 0x9044, 0xac44, 0xc745, 
-     0x8145, 0x9c45, 0xb746, 0xd347, 0x8c46, 0xa747, 0xc347, 0xde48, 
-     0x3a4f, 0x5550, 0x7050, 0x8c51, 0x4551, 0x6151, 0x7c52, 0x9753, 
-     0x5152, 0x6c53, 0x8753, 0xa354, 0x5c54, 0x7854, 0x9355, 0xae56, 
-     0x6855, 0x8356, 0x9e57, 0xba57, 0x7357, 0x8f57, 0xaa58, 0xc559, 
-     0x7f58, 0x9a59, 0xb65a, 0xd15a, 0x8a5a, 0xa65a, 0xc15b, 0xdc5c, 
-     0x3863, 0x5363, 0x6f64, 0x8a65, 0x4364, 0x5f65, 0x7a66, 0x9666, 
-     0x4f66, 0x6a66, 0x8667, 0xa168, 0x5a67, 0x7668, 0x9169, 0xad69, 
-     0x6669, 0x8169, 0x9d6a, 0xb86b, 0x716a, 0x8d6b, 0xa86c, 0xc46c, 
-     0x7d6c, 0x986d, 0xb46d, 0xcf6e, 0x886d, 0xa46e, 0xbf6f, 0xdb6f, 
-     0x3676, 0x5177, 0x6d78, 0x8878, 0x4278, 0x5d79, 0x7879, 0x947a, 
-     0x4d79, 0x687a, 0x847b, 0x9f7b, 0x597b, 0x747c, 0x8f7c, 0xab7d, 
-     0x647c, 0x7f7d, 0x9b7e, 0xb67e, 0x707e, 0x8b7f, 0xa67f, 0xc280, 
-     0x7b7f, 0x9680, 0xb281, 0xcd81, 0x8781, 0xa282, 0xbd82, 0xd983, 
-     0x348a, 0x508b, 0x6b8b, 0x868c, 0x408c, 0x5b8c, 0x778d, 0x928e, 
-     0x4b8d, 0x678e, 0x828e, 0x9d8f, 0x578f, 0x728f, 0x8e90, 0xa991, 
-     0x6290, 0x7e91, 0x9991, 0xb492, 0x6e92, 0x8992, 0xa593, 0xc094, 
-     0x7993, 0x9594, 0xb094, 0xcb95, 0x8595, 0xa095, 0xbc96, 0xd797, 
-     0x329e, 0x4e9e, 0x699f, 0x85a0, 0x3e9f, 0x59a0, 0x75a0, 0x90a1, 
-     0x49a1, 0x65a1, 0x80a2, 0x9ca3, 0x55a2, 0x70a3, 0x8ca4, 0xa7a4, 
-     0x60a4, 0x7ca4, 0x97a5, 0xb3a6, 0x6ca5, 0x87a6, 0xa3a7, 0xbea7, 
-     0x77a7, 0x93a7, 0xaea8, 0xcaa9, 0x83a8, 0x9ea9, 0xbaaa, 0xd5aa, 
-     0x31b1, 0x4cb2, 0x67b3, 0x83b3, 0x3cb3, 0x57b3, 0x73b4, 0x8eb5, 
-     0x48b4, 0x63b5, 0x7eb6, 0x9ab6, 0x53b6, 0x6fb6, 0x8ab7, 0xa5b8, 
-     0x5fb7, 0x7ab8, 0x95b9, 0xb1b9, 0x6ab9, 0x86ba, 0xa1ba, 0xbcbb, 
-     0x76ba, 0x91bb, 0xacbc, 0xc8bc, 0x81bc, 0x9dbd, 0xb8bd, 0xd3be, 
-     0x2fc5, 0x4ac6, 0x66c6, 0x81c7, 0x3ac6, 0x56c7, 0x71c8, 0x8cc8, 
-     0x46c8, 0x61c9, 0x7dc9, 0x98ca, 0x51c9, 0x6dca, 0x88cb, 0xa3cb, 
-     0x5dcb, 0x78cc, 0x94cc, 0xafcd, 0x68cc, 0x84cd, 0x9fce, 0xbace, 
-     0x74ce, 0x8fcf, 0xabcf, 0xc6d0, 0x7fd0, 0x9bd0, 0xb6d1, 0xd2d2 
+     0x3c3c, 0x5345, 0x6b4f, 0x8359, 0x4c3b, 0x6445, 0x7c4f, 0x9359, 
+     0x5d3b, 0x7545, 0x8c4f, 0xa459, 0x6e3b, 0x8545, 0x9d4f, 0xb559, 
+     0x7f3b, 0x9645, 0xae4f, 0xc659, 0x8f3b, 0xa745, 0xbf4f, 0xd659, 
+     0xa03b, 0xb845, 0xcf4f, 0xe759, 0xb13b, 0xc945, 0xe04f, 0xf859, 
+     0x364d, 0x4e57, 0x6561, 0x7d6b, 0x474d, 0x5e57, 0x7661, 0x8e6b, 
+     0x584d, 0x6f57, 0x8761, 0x9f6a, 0x684d, 0x8057, 0x9860, 0xaf6a, 
+     0x794d, 0x9156, 0xa860, 0xc06a, 0x8a4d, 0xa256, 0xb960, 0xd16a, 
+     0x9b4c, 0xb256, 0xca60, 0xe26a, 0xab4c, 0xc356, 0xdb60, 0xf26a, 
+     0x315e, 0x4868, 0x6072, 0x787c, 0x415e, 0x5968, 0x7172, 0x887c, 
+     0x525e, 0x6a68, 0x8172, 0x997c, 0x635e, 0x7b68, 0x9272, 0xaa7c, 
+     0x745e, 0x8b68, 0xa372, 0xbb7c, 0x845e, 0x9c68, 0xb472, 0xcb7c, 
+     0x955e, 0xad68, 0xc472, 0xdc7c, 0xa65e, 0xbe68, 0xd572, 0xed7b, 
+     0x2b6f, 0x4379, 0x5a83, 0x728d, 0x3c6f, 0x5379, 0x6b83, 0x838d, 
+     0x4d6f, 0x6479, 0x7c83, 0x948d, 0x5d6f, 0x7579, 0x8d83, 0xa48d, 
+     0x6e6f, 0x8679, 0x9d83, 0xb58d, 0x7f6f, 0x9779, 0xae83, 0xc68d, 
+     0x906f, 0xa779, 0xbf83, 0xd78d, 0xa06f, 0xb879, 0xd083, 0xe78d, 
+     0x2680, 0x3d8a, 0x5594, 0x6d9e, 0x3680, 0x4e8a, 0x6694, 0x7d9e, 
+     0x4780, 0x5f8a, 0x7694, 0x8e9e, 0x5880, 0x708a, 0x8794, 0x9f9e, 
+     0x6980, 0x808a, 0x9894, 0xb09e, 0x7980, 0x918a, 0xa994, 0xc09e, 
+     0x8a80, 0xa28a, 0xba94, 0xd19e, 0x9b80, 0xb38a, 0xca94, 0xe29e, 
+     0x2092, 0x389b, 0x4fa5, 0x67af, 0x3191, 0x499b, 0x60a5, 0x78af, 
+     0x4291, 0x599b, 0x71a5, 0x89af, 0x5291, 0x6a9b, 0x82a5, 0x99af, 
+     0x6391, 0x7b9b, 0x92a5, 0xaaaf, 0x7491, 0x8c9b, 0xa3a5, 0xbbaf, 
+     0x8591, 0x9c9b, 0xb4a5, 0xccaf, 0x9591, 0xad9b, 0xc5a5, 0xdcaf, 
+     0x1ba3, 0x32ad, 0x4ab7, 0x62c1, 0x2ba3, 0x43ad, 0x5bb7, 0x72c1, 
+     0x3ca3, 0x54ad, 0x6bb7, 0x83c0, 0x4da3, 0x65ad, 0x7cb7, 0x94c0, 
+     0x5ea3, 0x75ad, 0x8db6, 0xa5c0, 0x6ea3, 0x86ac, 0x9eb6, 0xb5c0, 
+     0x7fa2, 0x97ac, 0xafb6, 0xc6c0, 0x90a2, 0xa8ac, 0xbfb6, 0xd7c0, 
+     0x15b4, 0x2dbe, 0x44c8, 0x5cd2, 0x26b4, 0x3ebe, 0x55c8, 0x6dd2, 
+     0x37b4, 0x4ebe, 0x66c8, 0x7ed2, 0x47b4, 0x5fbe, 0x77c8, 0x8ed2, 
+     0x58b4, 0x70be, 0x88c8, 0x9fd2, 0x69b4, 0x81be, 0x98c8, 0xb0d2, 
+     0x7ab4, 0x91be, 0xa9c8, 0xc1d2, 0x8ab4, 0xa2be, 0xbac8, 0xd1d2 
   }, { 
-     0x3c3c, 0x3634, 0x302d, 0x2a25, 0x3f54, 0x3a4d, 0x3445, 0x2e3e, 
-     0x436d, 0x3e65, 0x385e, 0x3256, 0x4786, 0x427e, 0x3c77, 0x366f, 
-     0x4b9e, 0x4697, 0x408f, 0x3a88, 0x4fb7, 0x4aaf, 0x44a8, 0x3ea1, 
-     0x53d0, 0x4ec8, 0x48c1, 0x42b9, 0x57e8, 0x51e1, 0x4cd9, 0x46d2, 
-     0x4f3b, 0x4a34, 0x442d, 0x3e25, 0x5354, 0x4e4d, 0x4845, 0x423e, 
-     0x576d, 0x5265, 0x4c5e, 0x4656, 0x5b86, 0x567e, 0x5077, 0x4a6f, 
-     0x5f9e, 0x5a97, 0x548f, 0x4e88, 0x63b7, 0x5daf, 0x58a8, 0x52a0, 
-     0x67d0, 0x61c8, 0x5cc1, 0x56b9, 0x6be8, 0x65e1, 0x60d9, 0x5ad2, 
-     0x633b, 0x5e34, 0x582c, 0x5225, 0x6754, 0x624d, 0x5c45, 0x563e, 
-     0x6b6d, 0x6665, 0x605e, 0x5a56, 0x6f85, 0x697e, 0x6477, 0x5e6f, 
-     0x739e, 0x6d97, 0x688f, 0x6288, 0x77b7, 0x71af, 0x6ca8, 0x66a0, 
-     0x7bd0, 0x75c8, 0x70c1, 0x6ab9, 0x7fe8, 0x79e1, 0x74d9, 0x6ed2, 
-     0x773b, 0x7234, 0x6c2c, 0x6625, 0x7b54, 0x764d, 0x7045, 0x6a3e, 
-     0x7f6d, 0x7965, 0x745e, 0x6e56, 0x8385, 0x7d7e, 0x7876, 0x726f, 
-     0x879e, 0x8197, 0x7c8f, 0x7688, 0x8bb7, 0x85af, 0x80a8, 0x7aa0, 
-     0x8fcf, 0x89c8, 0x84c1, 0x7eb9, 0x93e8, 0x8de1, 0x88d9, 0x82d2, 
-     0x8b3b, 0x8534, 0x802c, 0x7a25, 0x8f54, 0x894c, 0x8445, 0x7e3e, 
-     0x936d, 0x8d65, 0x885e, 0x8256, 0x9785, 0x917e, 0x8c76, 0x866f, 
-     0x9b9e, 0x9597, 0x908f, 0x8a88, 0x9fb7, 0x99af, 0x94a8, 0x8ea0, 
-     0xa3cf, 0x9dc8, 0x97c0, 0x92b9, 0xa7e8, 0xa1e1, 0x9bd9, 0x96d2, 
-     0x9f3b, 0x9934, 0x942c, 0x8e25, 0xa354, 0x9d4c, 0x9845, 0x923d, 
-     0xa76d, 0xa165, 0x9c5e, 0x9656, 0xab85, 0xa57e, 0xa076, 0x9a6f, 
-     0xaf9e, 0xa996, 0xa48f, 0x9e88, 0xb3b7, 0xadaf, 0xa7a8, 0xa2a0, 
-     0xb7cf, 0xb1c8, 0xabc0, 0xa6b9, 0xbbe8, 0xb5e1, 0xafd9, 0xaad2, 
-     0xb33b, 0xad34, 0xa82c, 0xa225, 0xb754, 0xb14c, 0xac45, 0xa63d, 
-     0xbb6d, 0xb565, 0xb05e, 0xaa56, 0xbf85, 0xb97e, 0xb376, 0xae6f, 
-     0xc39e, 0xbd96, 0xb78f, 0xb287, 0xc7b7, 0xc1af, 0xbba8, 0xb6a0, 
-     0xcbcf, 0xc5c8, 0xbfc0, 0xbab9, 0xcfe8, 0xc9e0, 0xc3d9, 0xbed2, 
-     0xc73b, 0xc134, 0xbc2c, 0xb625, 0xcb54, 0xc54c, 0xbf45, 0xba3d, 
-     0xcf6c, 0xc965, 0xc35e, 0xbe56, 0xd385, 0xcd7e, 0xc776, 0xc26f, 
-     0xd79e, 0xd196, 0xcb8f, 0xc687, 0xdbb7, 0xd5af, 0xcfa8, 0xcaa0, 
-     0xdfcf, 0xd9c8, 0xd3c0, 0xceb9, 0xe3e8, 0xdde0, 0xd7d9, 0xd2d1 
+     0x3c3c, 0x3e2e, 0x4120, 0x4412, 0x3c51, 0x3f44, 0x4236, 0x4528, 
+     0x3d67, 0x405a, 0x434c, 0x463e, 0x3e7d, 0x4170, 0x4462, 0x4754, 
+     0x3f93, 0x4286, 0x4578, 0x486a, 0x40a9, 0x439c, 0x468e, 0x4980, 
+     0x41bf, 0x44b2, 0x47a4, 0x4a96, 0x42d5, 0x45c8, 0x48ba, 0x4bac, 
+     0x4f41, 0x5233, 0x5525, 0x5818, 0x5057, 0x5349, 0x563b, 0x592e, 
+     0x516d, 0x545f, 0x5751, 0x5944, 0x5283, 0x5475, 0x5767, 0x5a5a, 
+     0x5299, 0x558b, 0x587d, 0x5b70, 0x53af, 0x56a1, 0x5993, 0x5c85, 
+     0x54c5, 0x57b7, 0x5aa9, 0x5d9b, 0x55db, 0x58cd, 0x5bbf, 0x5eb1, 
+     0x6246, 0x6538, 0x682b, 0x6b1d, 0x635c, 0x664e, 0x6941, 0x6c33, 
+     0x6472, 0x6764, 0x6a57, 0x6d49, 0x6588, 0x687a, 0x6b6d, 0x6e5f, 
+     0x669e, 0x6990, 0x6c83, 0x6f75, 0x67b4, 0x6aa6, 0x6d99, 0x708b, 
+     0x68ca, 0x6bbc, 0x6daf, 0x70a1, 0x68e0, 0x6bd2, 0x6ec5, 0x71b7, 
+     0x754c, 0x783e, 0x7b30, 0x7e22, 0x7662, 0x7954, 0x7c46, 0x7f38, 
+     0x7777, 0x7a6a, 0x7d5c, 0x804e, 0x788d, 0x7b80, 0x7e72, 0x8164, 
+     0x79a3, 0x7c96, 0x7f88, 0x827a, 0x7ab9, 0x7dac, 0x809e, 0x8390, 
+     0x7bcf, 0x7ec2, 0x81b4, 0x84a6, 0x7ce5, 0x7fd8, 0x82ca, 0x85bc, 
+     0x8851, 0x8b43, 0x8e35, 0x9128, 0x8967, 0x8c59, 0x8f4b, 0x923e, 
+     0x8a7d, 0x8d6f, 0x9061, 0x9354, 0x8b93, 0x8e85, 0x9177, 0x946a, 
+     0x8ca9, 0x8f9b, 0x928d, 0x9580, 0x8dbf, 0x90b1, 0x93a3, 0x9696, 
+     0x8ed5, 0x91c7, 0x94b9, 0x97ab, 0x8feb, 0x92dd, 0x95cf, 0x98c1, 
+     0x9c56, 0x9f48, 0xa23b, 0xa52d, 0x9d6c, 0xa05e, 0xa251, 0xa543, 
+     0x9d82, 0xa074, 0xa367, 0xa659, 0x9e98, 0xa18a, 0xa47d, 0xa76f, 
+     0x9fae, 0xa2a0, 0xa593, 0xa885, 0xa0c4, 0xa3b6, 0xa6a9, 0xa99b, 
+     0xa1da, 0xa4cc, 0xa7bf, 0xaab1, 0xa2f0, 0xa5e2, 0xa8d5, 0xabc7, 
+     0xaf5c, 0xb24e, 0xb540, 0xb832, 0xb072, 0xb364, 0xb656, 0xb948, 
+     0xb188, 0xb47a, 0xb76c, 0xba5e, 0xb29d, 0xb590, 0xb882, 0xbb74, 
+     0xb3b3, 0xb6a6, 0xb998, 0xbb8a, 0xb4c9, 0xb6bc, 0xb9ae, 0xbca0, 
+     0xb4df, 0xb7d2, 0xbac4, 0xbdb6, 0xb5f5, 0xb8e8, 0xbbda, 0xbecc, 
+     0xc261, 0xc553, 0xc845, 0xcb38, 0xc377, 0xc669, 0xc95b, 0xcc4e, 
+     0xc48d, 0xc77f, 0xca71, 0xcd64, 0xc5a3, 0xc895, 0xcb87, 0xce7a, 
+     0xc6b9, 0xc9ab, 0xcc9d, 0xcf90, 0xc7cf, 0xcac1, 0xcdb3, 0xd0a6, 
+     0xc8e5, 0xcbd7, 0xcec9, 0xd1bc, 0xc9fb, 0xcced, 0xcfdf, 0xd2d1 
   }, { 
-     0x3c3c, 0x3a57, 0x3973, 0x388f, 0x5543, 0x545f, 0x527b, 0x5196, 
-     0x6e4b, 0x6d66, 0x6c82, 0x6b9e, 0x8852, 0x866e, 0x858a, 0x84a6, 
-     0xa15a, 0xa076, 0x9f91, 0x9dad, 0xba62, 0xb97d, 0xb899, 0xb7b5, 
-     0xd469, 0xd385, 0xd1a1, 0xd0bc, 0xed71, 0xec8d, 0xeba8, 0xe9c4, 
-     0x383d, 0x3759, 0x3675, 0x3490, 0x5145, 0x5061, 0x4f7c, 0x4e98, 
-     0x6b4d, 0x6a68, 0x6884, 0x67a0, 0x8454, 0x8370, 0x828c, 0x81a7, 
-     0x9e5c, 0x9c78, 0x9b93, 0x9aaf, 0xb764, 0xb67f, 0xb59b, 0xb3b7, 
-     0xd06b, 0xcf87, 0xcea3, 0xcdbe, 0xea73, 0xe88f, 0xe7aa, 0xe6c6, 
-     0x353f, 0x335b, 0x3277, 0x3192, 0x4e47, 0x4d63, 0x4c7e, 0x4a9a, 
-     0x674f, 0x666a, 0x6586, 0x64a2, 0x8156, 0x8072, 0x7e8e, 0x7da9, 
-     0x9a5e, 0x997a, 0x9895, 0x97b1, 0xb466, 0xb281, 0xb19d, 0xb0b9, 
-     0xcd6d, 0xcc89, 0xcaa5, 0xc9c0, 0xe675, 0xe591, 0xe4ac, 0xe3c8, 
-     0x3141, 0x305d, 0x2f79, 0x2e94, 0x4b49, 0x4965, 0x4880, 0x479c, 
-     0x6451, 0x636c, 0x6288, 0x60a4, 0x7d58, 0x7c74, 0x7b90, 0x7aab, 
-     0x9760, 0x967c, 0x9497, 0x93b3, 0xb067, 0xaf83, 0xae9f, 0xacbb, 
-     0xc96f, 0xc88b, 0xc7a6, 0xc6c2, 0xe377, 0xe292, 0xe0ae, 0xdfca, 
-     0x2e43, 0x2d5f, 0x2b7b, 0x2a96, 0x474b, 0x4667, 0x4582, 0x449e, 
-     0x6152, 0x5f6e, 0x5e8a, 0x5da6, 0x7a5a, 0x7976, 0x7791, 0x76ad, 
-     0x9362, 0x927d, 0x9199, 0x90b5, 0xad69, 0xab85, 0xaaa1, 0xa9bc, 
-     0xc671, 0xc58d, 0xc4a8, 0xc2c4, 0xdf79, 0xde94, 0xddb0, 0xdccc, 
-     0x2a45, 0x2961, 0x287c, 0x2798, 0x444d, 0x4368, 0x4184, 0x40a0, 
-     0x5d54, 0x5c70, 0x5b8c, 0x59a7, 0x765c, 0x7578, 0x7493, 0x73af, 
-     0x9064, 0x8f7f, 0x8d9b, 0x8cb7, 0xa96b, 0xa887, 0xa7a3, 0xa6be, 
-     0xc373, 0xc18f, 0xc0aa, 0xbfc6, 0xdc7b, 0xdb96, 0xdab2, 0xd8ce, 
-     0x2747, 0x2663, 0x257e, 0x239a, 0x404f, 0x3f6a, 0x3e86, 0x3da2, 
-     0x5a56, 0x5872, 0x578e, 0x56a9, 0x735e, 0x727a, 0x7195, 0x6fb1, 
-     0x8c66, 0x8b81, 0x8a9d, 0x89b9, 0xa66d, 0xa589, 0xa3a5, 0xa2c0, 
-     0xbf75, 0xbe91, 0xbdac, 0xbcc8, 0xd97d, 0xd798, 0xd6b4, 0xd5d0, 
-     0x2449, 0x2265, 0x2180, 0x209c, 0x3d51, 0x3c6c, 0x3a88, 0x39a4, 
-     0x5658, 0x5574, 0x5490, 0x53ab, 0x7060, 0x6e7c, 0x6d97, 0x6cb3, 
-     0x8967, 0x8883, 0x879f, 0x85bb, 0xa26f, 0xa18b, 0xa0a7, 0x9fc2, 
-     0xbc77, 0xbb92, 0xb9ae, 0xb8ca, 0xd57e, 0xd49a, 0xd3b6, 0xd1d2 
+     0x3c3c, 0x3256, 0x2971, 0x208c, 0x5448, 0x4a63, 0x417e, 0x3899, 
+     0x6c55, 0x6370, 0x598b, 0x50a6, 0x8462, 0x7b7d, 0x7198, 0x68b2, 
+     0x9c6f, 0x938a, 0x8aa4, 0x80bf, 0xb47c, 0xab97, 0xa2b1, 0x99cc, 
+     0xcd89, 0xc3a3, 0xbabe, 0xb1d9, 0xe595, 0xdcb0, 0xd2cb, 0xc9e6, 
+     0x3d39, 0x3353, 0x2a6e, 0x2189, 0x5545, 0x4c60, 0x427b, 0x3996, 
+     0x6d52, 0x646d, 0x5b88, 0x51a3, 0x855f, 0x7c7a, 0x7395, 0x69b0, 
+     0x9d6c, 0x9487, 0x8ba2, 0x82bc, 0xb679, 0xac94, 0xa3ae, 0x9ac9, 
+     0xce86, 0xc5a0, 0xbbbb, 0xb2d6, 0xe692, 0xddad, 0xd3c8, 0xcae3, 
+     0x3e36, 0x3551, 0x2b6b, 0x2286, 0x5643, 0x4d5d, 0x4478, 0x3a93, 
+     0x6e4f, 0x656a, 0x5c85, 0x52a0, 0x875c, 0x7d77, 0x7492, 0x6bad, 
+     0x9f69, 0x9584, 0x8c9f, 0x83b9, 0xb776, 0xae91, 0xa4ac, 0x9bc6, 
+     0xcf83, 0xc69e, 0xbdb8, 0xb3d3, 0xe790, 0xdeaa, 0xd5c5, 0xcbe0, 
+     0x3f33, 0x364e, 0x2d68, 0x2383, 0x5740, 0x4e5a, 0x4575, 0x3b90, 
+     0x704c, 0x6667, 0x5d82, 0x549d, 0x8859, 0x7e74, 0x758f, 0x6caa, 
+     0xa066, 0x9781, 0x8d9c, 0x84b7, 0xb873, 0xaf8e, 0xa6a9, 0x9cc3, 
+     0xd080, 0xc79b, 0xbeb5, 0xb4d0, 0xe98d, 0xdfa7, 0xd6c2, 0xcddd, 
+     0x4030, 0x374b, 0x2e66, 0x2480, 0x593d, 0x4f58, 0x4672, 0x3d8d, 
+     0x714a, 0x6764, 0x5e7f, 0x559a, 0x8956, 0x8071, 0x768c, 0x6da7, 
+     0xa163, 0x987e, 0x8f99, 0x85b4, 0xb970, 0xb08b, 0xa7a6, 0x9dc1, 
+     0xd27d, 0xc898, 0xbfb3, 0xb6cd, 0xea8a, 0xe0a5, 0xd7bf, 0xceda, 
+     0x422d, 0x3848, 0x2f63, 0x267d, 0x5a3a, 0x5055, 0x476f, 0x3e8a, 
+     0x7247, 0x6961, 0x5f7c, 0x5697, 0x8a54, 0x816e, 0x7889, 0x6ea4, 
+     0xa260, 0x997b, 0x9096, 0x86b1, 0xbb6d, 0xb188, 0xa8a3, 0x9fbe, 
+     0xd37a, 0xc995, 0xc0b0, 0xb7ca, 0xeb87, 0xe2a2, 0xd8bc, 0xcfd7, 
+     0x432a, 0x3a45, 0x3060, 0x277b, 0x5b37, 0x5252, 0x486d, 0x3f87, 
+     0x7344, 0x6a5f, 0x6179, 0x5794, 0x8b51, 0x826b, 0x7986, 0x70a1, 
+     0xa45d, 0x9a78, 0x9193, 0x88ae, 0xbc6a, 0xb285, 0xa9a0, 0xa0bb, 
+     0xd477, 0xcb92, 0xc1ad, 0xb8c8, 0xec84, 0xe39f, 0xdaba, 0xd0d4, 
+     0x4427, 0x3b42, 0x315d, 0x2878, 0x5c34, 0x534f, 0x4a6a, 0x4084, 
+     0x7441, 0x6b5c, 0x6276, 0x5991, 0x8d4e, 0x8369, 0x7a83, 0x719e, 
+     0xa55b, 0x9c75, 0x9290, 0x89ab, 0xbd67, 0xb482, 0xaa9d, 0xa1b8, 
+     0xd574, 0xcc8f, 0xc3aa, 0xb9c5, 0xed81, 0xe49c, 0xdbb7, 0xd1d2 
   }, { 
-     0x3c3c, 0x5530, 0x6f25, 0x891a, 0x4043, 0x5a38, 0x732c, 0x8d21, 
-     0x444a, 0x5e3f, 0x7834, 0x9228, 0x4851, 0x6246, 0x7c3b, 0x9630, 
-     0x4d59, 0x664d, 0x8042, 0x9a37, 0x5160, 0x6b55, 0x8449, 0x9e3e, 
-     0x5567, 0x6f5c, 0x8951, 0xa346, 0x596e, 0x7363, 0x8d58, 0xa74d, 
-     0x424e, 0x5b43, 0x7538, 0x8f2d, 0x4656, 0x604b, 0x7a3f, 0x9334, 
-     0x4a5d, 0x6452, 0x7e47, 0x983b, 0x4e64, 0x6859, 0x824e, 0x9c43, 
-     0x536c, 0x6c60, 0x8655, 0xa04a, 0x5773, 0x7168, 0x8b5c, 0xa451, 
-     0x5b7a, 0x756f, 0x8f64, 0xa958, 0x5f81, 0x7976, 0x936b, 0xad60, 
-     0x4861, 0x6256, 0x7b4b, 0x9540, 0x4c69, 0x665d, 0x8052, 0x9947, 
-     0x5070, 0x6a65, 0x845a, 0x9e4e, 0x5477, 0x6e6c, 0x8861, 0xa256, 
-     0x597f, 0x7373, 0x8c68, 0xa65d, 0x5d86, 0x777b, 0x916f, 0xab64, 
-     0x618d, 0x7b82, 0x9577, 0xaf6b, 0x6694, 0x7f89, 0x997e, 0xb373, 
-     0x4e74, 0x6869, 0x815e, 0x9b53, 0x527c, 0x6c70, 0x8665, 0xa05a, 
-     0x5683, 0x7078, 0x8a6c, 0xa461, 0x5b8a, 0x747f, 0x8e74, 0xa869, 
-     0x5f92, 0x7986, 0x937b, 0xac70, 0x6399, 0x7d8e, 0x9782, 0xb177, 
-     0x67a0, 0x8195, 0x9b8a, 0xb57e, 0x6ca7, 0x859c, 0x9f91, 0xb986, 
-     0x5487, 0x6e7c, 0x8871, 0xa166, 0x588f, 0x7283, 0x8c78, 0xa66d, 
-     0x5c96, 0x768b, 0x907f, 0xaa74, 0x619d, 0x7a92, 0x9487, 0xae7b, 
-     0x65a4, 0x7f99, 0x998e, 0xb283, 0x69ac, 0x83a1, 0x9d95, 0xb78a, 
-     0x6db3, 0x87a8, 0xa19d, 0xbb91, 0x72ba, 0x8caf, 0xa5a4, 0xbf99, 
-     0x5a9a, 0x748f, 0x8e84, 0xa779, 0x5ea2, 0x7896, 0x928b, 0xac80, 
-     0x62a9, 0x7c9e, 0x9692, 0xb087, 0x67b0, 0x81a5, 0x9a9a, 0xb48e, 
-     0x6bb7, 0x85ac, 0x9fa1, 0xb996, 0x6fbf, 0x89b3, 0xa3a8, 0xbd9d, 
-     0x74c6, 0x8dbb, 0xa7b0, 0xc1a4, 0x78cd, 0x92c2, 0xabb7, 0xc5ac, 
-     0x60ad, 0x7aa2, 0x9497, 0xae8c, 0x64b5, 0x7ea9, 0x989e, 0xb293, 
-     0x69bc, 0x82b1, 0x9ca5, 0xb69a, 0x6dc3, 0x87b8, 0xa1ad, 0xbaa1, 
-     0x71ca, 0x8bbf, 0xa5b4, 0xbfa9, 0x75d2, 0x8fc6, 0xa9bb, 0xc3b0, 
-     0x7ad9, 0x93ce, 0xadc2, 0xc7b7, 0x7ee0, 0x98d5, 0xb2ca, 0xcbbf, 
-     0x66c0, 0x80b5, 0x9aaa, 0xb49f, 0x6ac7, 0x84bc, 0x9eb1, 0xb8a6, 
-     0x6fcf, 0x89c4, 0xa2b8, 0xbcad, 0x73d6, 0x8dcb, 0xa7c0, 0xc0b4, 
-     0x77dd, 0x91d2, 0xabc7, 0xc5bc, 0x7be5, 0x95d9, 0xafce, 0xc9c3, 
-     0x80ec, 0x9ae1, 0xb3d5, 0xcdca, 0x84f3, 0x9ee8, 0xb8dd, 0xd2d2 
+     0x3c3c, 0x5738, 0x7334, 0x8f30, 0x443f, 0x603b, 0x7c37, 0x9833, 
+     0x4d42, 0x693e, 0x853a, 0xa136, 0x5645, 0x7241, 0x8e3d, 0xaa39, 
+     0x5f48, 0x7b44, 0x9740, 0xb33c, 0x684b, 0x8447, 0xa043, 0xbb3f, 
+     0x714e, 0x8d4a, 0xa946, 0xc442, 0x7a51, 0x964d, 0xb149, 0xcd46, 
+     0x3c4f, 0x584c, 0x7448, 0x9044, 0x4553, 0x614f, 0x7d4b, 0x9947, 
+     0x4e56, 0x6a52, 0x864e, 0xa14a, 0x5759, 0x7355, 0x8e51, 0xaa4d, 
+     0x605c, 0x7c58, 0x9754, 0xb350, 0x695f, 0x845b, 0xa057, 0xbc53, 
+     0x7162, 0x8d5e, 0xa95a, 0xc556, 0x7a65, 0x9661, 0xb25d, 0xce5a, 
+     0x3d63, 0x5960, 0x745c, 0x9058, 0x4667, 0x6163, 0x7d5f, 0x995b, 
+     0x4e6a, 0x6a66, 0x8662, 0xa25e, 0x576d, 0x7369, 0x8f65, 0xab61, 
+     0x6070, 0x7c6c, 0x9868, 0xb464, 0x6973, 0x856f, 0xa16b, 0xbd67, 
+     0x7276, 0x8e72, 0xaa6e, 0xc66a, 0x7b79, 0x9775, 0xb371, 0xce6e, 
+     0x3d77, 0x5974, 0x7570, 0x916c, 0x467b, 0x6277, 0x7e73, 0x9a6f, 
+     0x4f7e, 0x6b7a, 0x8776, 0xa372, 0x5881, 0x747d, 0x9079, 0xac75, 
+     0x6184, 0x7d80, 0x997c, 0xb478, 0x6a87, 0x8683, 0xa17f, 0xbd7b, 
+     0x738a, 0x8f86, 0xaa82, 0xc67e, 0x7c8d, 0x9789, 0xb385, 0xcf82, 
+     0x3e8b, 0x5a88, 0x7684, 0x9180, 0x478f, 0x638b, 0x7e87, 0x9a83, 
+     0x5092, 0x6c8e, 0x878a, 0xa386, 0x5995, 0x7491, 0x908d, 0xac89, 
+     0x6198, 0x7d94, 0x9990, 0xb58c, 0x6a9b, 0x8697, 0xa293, 0xbe8f, 
+     0x739e, 0x8f9a, 0xab96, 0xc792, 0x7ca1, 0x989d, 0xb499, 0xd096, 
+     0x3f9f, 0x5a9c, 0x7698, 0x9294, 0x47a3, 0x639f, 0x7f9b, 0x9b97, 
+     0x50a6, 0x6ca2, 0x889e, 0xa49a, 0x59a9, 0x75a5, 0x91a1, 0xad9d, 
+     0x62ac, 0x7ea8, 0x9aa4, 0xb6a0, 0x6baf, 0x87ab, 0xa3a7, 0xbfa3, 
+     0x74b2, 0x90ae, 0xacaa, 0xc7a6, 0x7db5, 0x99b1, 0xb4ad, 0xd0aa, 
+     0x3fb3, 0x5bb0, 0x77ac, 0x93a8, 0x48b7, 0x64b3, 0x80af, 0x9cab, 
+     0x51ba, 0x6db6, 0x89b2, 0xa4ae, 0x5abd, 0x76b9, 0x91b5, 0xadb1, 
+     0x63c0, 0x7fbc, 0x9ab8, 0xb6b4, 0x6cc3, 0x87bf, 0xa3bb, 0xbfb7, 
+     0x74c6, 0x90c2, 0xacbe, 0xc8ba, 0x7dc9, 0x99c5, 0xb5c1, 0xd1be, 
+     0x40c7, 0x5cc4, 0x77c0, 0x93bc, 0x49cb, 0x64c7, 0x80c3, 0x9cbf, 
+     0x52ce, 0x6dca, 0x89c6, 0xa5c2, 0x5ad1, 0x76cd, 0x92c9, 0xaec5, 
+     0x63d4, 0x7fd0, 0x9bcc, 0xb7c8, 0x6cd7, 0x88d3, 0xa4cf, 0xc0cb, 
+     0x75da, 0x91d6, 0xadd2, 0xc9ce, 0x7edd, 0x9ad9, 0xb6d5, 0xd2d2 
   }, { 
-     0x3c3c, 0x2d41, 0x1e47, 0x0f4d, 0x4754, 0x385a, 0x2960, 0x1a65, 
-     0x526d, 0x4373, 0x3479, 0x257e, 0x5d86, 0x4e8c, 0x3f91, 0x3097, 
-     0x689f, 0x59a4, 0x4aaa, 0x3bb0, 0x73b8, 0x64bd, 0x55c3, 0x46c9, 
-     0x7ed0, 0x6fd6, 0x60dc, 0x51e1, 0x89e9, 0x7aef, 0x6bf5, 0x5cfa, 
-     0x4c36, 0x3d3b, 0x2e41, 0x1f47, 0x574e, 0x4854, 0x395a, 0x2a60, 
-     0x6267, 0x536d, 0x4473, 0x3678, 0x6e80, 0x5f86, 0x508c, 0x4191, 
-     0x7999, 0x6a9f, 0x5ba4, 0x4caa, 0x84b2, 0x75b7, 0x66bd, 0x57c3, 
-     0x8fcb, 0x80d0, 0x71d6, 0x62dc, 0x9ae3, 0x8be9, 0x7cef, 0x6df4, 
-     0x5d30, 0x4e36, 0x3f3b, 0x3041, 0x6849, 0x594e, 0x4a54, 0x3b5a, 
-     0x7361, 0x6467, 0x556d, 0x4673, 0x7e7a, 0x6f80, 0x6086, 0x518b, 
-     0x8993, 0x7a99, 0x6b9e, 0x5ca4, 0x95ac, 0x86b2, 0x77b7, 0x68bd, 
-     0xa0c5, 0x91ca, 0x82d0, 0x73d6, 0xabde, 0x9ce3, 0x8de9, 0x7eef, 
-     0x6e2a, 0x5f30, 0x5035, 0x413b, 0x7943, 0x6a49, 0x5b4e, 0x4c54, 
-     0x845c, 0x7561, 0x6667, 0x576d, 0x8f74, 0x807a, 0x7180, 0x6286, 
-     0x9a8d, 0x8b93, 0x7c99, 0x6d9e, 0xa5a6, 0x96ac, 0x87b1, 0x78b7, 
-     0xb0bf, 0xa1c5, 0x92ca, 0x83d0, 0xbcd8, 0xaddd, 0x9ee3, 0x8fe9, 
-     0x7e24, 0x6f2a, 0x6030, 0x5135, 0x8a3d, 0x7b43, 0x6c48, 0x5d4e, 
-     0x9556, 0x865c, 0x7761, 0x6867, 0xa06f, 0x9174, 0x827a, 0x7380, 
-     0xab87, 0x9c8d, 0x8d93, 0x7e99, 0xb6a0, 0xa7a6, 0x98ac, 0x89b1, 
-     0xc1b9, 0xb2bf, 0xa3c4, 0x94ca, 0xccd2, 0xbdd8, 0xaedd, 0x9fe3, 
-     0x8f1e, 0x8024, 0x712a, 0x622f, 0x9a37, 0x8b3d, 0x7c43, 0x6d48, 
-     0xa550, 0x9656, 0x875b, 0x7861, 0xb169, 0xa26f, 0x9374, 0x847a, 
-     0xbc82, 0xad87, 0x9e8d, 0x8f93, 0xc79a, 0xb8a0, 0xa9a6, 0x9aac, 
-     0xd2b3, 0xc3b9, 0xb4bf, 0xa5c4, 0xddcc, 0xced2, 0xbfd7, 0xb0dd, 
-     0xa019, 0x911e, 0x8224, 0x732a, 0xab31, 0x9c37, 0x8d3d, 0x7e42, 
-     0xb64a, 0xa750, 0x9856, 0x895b, 0xc163, 0xb269, 0xa36e, 0x9474, 
-     0xcc7c, 0xbd81, 0xae87, 0x9f8d, 0xd795, 0xc99a, 0xbaa0, 0xaba6, 
-     0xe3ad, 0xd4b3, 0xc5b9, 0xb6bf, 0xeec6, 0xdfcc, 0xd0d2, 0xc1d7, 
-     0xb113, 0xa218, 0x931e, 0x8424, 0xbc2c, 0xad31, 0x9e37, 0x8f3d, 
-     0xc744, 0xb84a, 0xa950, 0x9a55, 0xd25d, 0xc363, 0xb469, 0xa56e, 
-     0xdd76, 0xce7c, 0xbf81, 0xb087, 0xe88f, 0xd994, 0xca9a, 0xbba0, 
-     0xf3a8, 0xe4ad, 0xd5b3, 0xc6b9, 0xfec0, 0xefc6, 0xe0cc, 0xd2d1 
+     0x3c3c, 0x3238, 0x2835, 0x1f31, 0x4255, 0x3851, 0x2e4e, 0x254b, 
+     0x486e, 0x3e6b, 0x3567, 0x2b64, 0x4e87, 0x4484, 0x3b81, 0x317d, 
+     0x54a1, 0x4a9d, 0x419a, 0x3796, 0x5aba, 0x50b7, 0x47b3, 0x3db0, 
+     0x60d3, 0x57d0, 0x4dcc, 0x43c9, 0x66ec, 0x5de9, 0x53e6, 0x49e2, 
+     0x4f39, 0x4536, 0x3c32, 0x322f, 0x5552, 0x4b4f, 0x424c, 0x3848, 
+     0x5b6c, 0x5268, 0x4865, 0x3e61, 0x6185, 0x5882, 0x4e7e, 0x447b, 
+     0x679e, 0x5e9b, 0x5497, 0x4b94, 0x6db8, 0x64b4, 0x5ab1, 0x51ad, 
+     0x74d1, 0x6acd, 0x60ca, 0x57c7, 0x7aea, 0x70e7, 0x66e3, 0x5de0, 
+     0x6237, 0x5933, 0x4f30, 0x462c, 0x6850, 0x5f4d, 0x5549, 0x4c46, 
+     0x6f69, 0x6566, 0x5b62, 0x525f, 0x7583, 0x6b7f, 0x617c, 0x5878, 
+     0x7b9c, 0x7198, 0x6895, 0x5e92, 0x81b5, 0x77b2, 0x6eae, 0x64ab, 
+     0x87ce, 0x7dcb, 0x74c8, 0x6ac4, 0x8de8, 0x84e4, 0x7ae1, 0x70dd, 
+     0x7634, 0x6c31, 0x632e, 0x592a, 0x7c4e, 0x724a, 0x6947, 0x5f43, 
+     0x8267, 0x7863, 0x6f60, 0x655d, 0x8880, 0x7f7d, 0x7579, 0x6b76, 
+     0x8e99, 0x8596, 0x7b93, 0x718f, 0x94b3, 0x8baf, 0x81ac, 0x78a9, 
+     0x9acc, 0x91c9, 0x87c5, 0x7ec2, 0xa1e5, 0x97e2, 0x8dde, 0x84db, 
+     0x8932, 0x802f, 0x762b, 0x6c28, 0x8f4b, 0x8648, 0x7c44, 0x7341, 
+     0x9564, 0x8c61, 0x825e, 0x795a, 0x9c7e, 0x927a, 0x8877, 0x7f74, 
+     0xa297, 0x9894, 0x8e90, 0x858d, 0xa8b0, 0x9ead, 0x95aa, 0x8ba6, 
+     0xaeca, 0xa4c6, 0x9bc3, 0x91bf, 0xb4e3, 0xaadf, 0xa1dc, 0x97d9, 
+     0x9d30, 0x932c, 0x8929, 0x8025, 0xa349, 0x9945, 0x9042, 0x863f, 
+     0xa962, 0x9f5f, 0x965b, 0x8c58, 0xaf7b, 0xa578, 0x9c75, 0x9271, 
+     0xb595, 0xac91, 0xa28e, 0x988a, 0xbbae, 0xb2ab, 0xa8a7, 0x9ea4, 
+     0xc1c7, 0xb8c4, 0xaec0, 0xa5bd, 0xc7e1, 0xbedd, 0xb4da, 0xabd6, 
+     0xb02d, 0xa72a, 0x9d26, 0x9323, 0xb646, 0xad43, 0xa340, 0x993c, 
+     0xbc60, 0xb35c, 0xa959, 0xa055, 0xc279, 0xb976, 0xaf72, 0xa66f, 
+     0xc992, 0xbf8f, 0xb58b, 0xac88, 0xcfac, 0xc5a8, 0xbba5, 0xb2a1, 
+     0xd5c5, 0xcbc1, 0xc2be, 0xb8bb, 0xdbde, 0xd1db, 0xc8d7, 0xbed4, 
+     0xc42b, 0xba27, 0xb024, 0xa721, 0xca44, 0xc041, 0xb63d, 0xad3a, 
+     0xd05d, 0xc65a, 0xbd56, 0xb353, 0xd677, 0xcc73, 0xc370, 0xb96c, 
+     0xdc90, 0xd28c, 0xc989, 0xbf86, 0xe2a9, 0xd8a6, 0xcfa2, 0xc59f, 
+     0xe8c2, 0xdfbf, 0xd5bc, 0xcbb8, 0xeedc, 0xe5d8, 0xdbd5, 0xd2d1 
   }, { 
-     0x3c3c, 0x4851, 0x5567, 0x617d, 0x533d, 0x5f53, 0x6c69, 0x787f, 
-     0x6a3f, 0x7655, 0x836b, 0x8f81, 0x8141, 0x8d57, 0x9a6d, 0xa683, 
-     0x9842, 0xa458, 0xb16e, 0xbe84, 0xaf44, 0xbb5a, 0xc870, 0xd586, 
-     0xc646, 0xd25c, 0xdf72, 0xec88, 0xdd48, 0xea5d, 0xf673, 0xff89, 
-     0x3446, 0x415c, 0x4e72, 0x5a88, 0x4c48, 0x585d, 0x6573, 0x7189, 
-     0x6349, 0x6f5f, 0x7c75, 0x888b, 0x7a4b, 0x8661, 0x9377, 0x9f8d, 
-     0x914d, 0x9d63, 0xaa79, 0xb68f, 0xa84e, 0xb464, 0xc17a, 0xce90, 
-     0xbf50, 0xcb66, 0xd87c, 0xe592, 0xd652, 0xe268, 0xef7e, 0xfc94, 
-     0x2d50, 0x3a66, 0x477c, 0x5392, 0x4552, 0x5168, 0x5e7e, 0x6a94, 
-     0x5c54, 0x6869, 0x757f, 0x8195, 0x7355, 0x7f6b, 0x8c81, 0x9897, 
-     0x8a57, 0x966d, 0xa383, 0xaf99, 0xa159, 0xad6f, 0xba85, 0xc79b, 
-     0xb85a, 0xc470, 0xd186, 0xde9c, 0xcf5c, 0xdb72, 0xe888, 0xf59e, 
-     0x265a, 0x3370, 0x4086, 0x4c9c, 0x3d5c, 0x4a72, 0x5788, 0x639e, 
-     0x555e, 0x6174, 0x6e8a, 0x7aa0, 0x6c60, 0x7876, 0x858b, 0x91a1, 
-     0x8361, 0x8f77, 0x9c8d, 0xa8a3, 0x9a63, 0xa679, 0xb38f, 0xbfa5, 
-     0xb165, 0xbd7b, 0xca91, 0xd7a7, 0xc866, 0xd47c, 0xe192, 0xeea8, 
-     0x1f65, 0x2c7b, 0x3991, 0x45a7, 0x3666, 0x437c, 0x5092, 0x5ca8, 
-     0x4e68, 0x5a7e, 0x6794, 0x73aa, 0x656a, 0x7180, 0x7e96, 0x8aac, 
-     0x7c6c, 0x8882, 0x9597, 0xa1ad, 0x936d, 0x9f83, 0xac99, 0xb8af, 
-     0xaa6f, 0xb685, 0xc39b, 0xd0b1, 0xc171, 0xcd87, 0xda9d, 0xe7b3, 
-     0x186f, 0x2585, 0x329b, 0x3eb1, 0x2f71, 0x3c87, 0x499d, 0x55b3, 
-     0x4672, 0x5388, 0x609e, 0x6cb4, 0x5e74, 0x6a8a, 0x77a0, 0x83b6, 
-     0x7576, 0x818c, 0x8ea2, 0x9ab8, 0x8c78, 0x988e, 0xa5a4, 0xb1b9, 
-     0xa379, 0xaf8f, 0xbca5, 0xc8bb, 0xba7b, 0xc691, 0xd3a7, 0xe0bd, 
-     0x1179, 0x1e8f, 0x2ba5, 0x37bb, 0x287b, 0x3591, 0x42a7, 0x4ebd, 
-     0x3f7d, 0x4c93, 0x59a9, 0x65bf, 0x577e, 0x6394, 0x70aa, 0x7cc0, 
-     0x6e80, 0x7a96, 0x87ac, 0x93c2, 0x8582, 0x9198, 0x9eae, 0xaac4, 
-     0x9c84, 0xa89a, 0xb5b0, 0xc1c5, 0xb385, 0xbf9b, 0xccb1, 0xd9c7, 
-     0x0a84, 0x179a, 0x23b0, 0x30c5, 0x2185, 0x2e9b, 0x3bb1, 0x47c7, 
-     0x3887, 0x459d, 0x52b3, 0x5ec9, 0x4f89, 0x5c9f, 0x69b5, 0x75cb, 
-     0x678a, 0x73a0, 0x80b6, 0x8ccc, 0x7e8c, 0x8aa2, 0x97b8, 0xa3ce, 
-     0x958e, 0xa1a4, 0xaeba, 0xbad0, 0xac90, 0xb8a6, 0xc5bc, 0xd1d2 
+     0x3c3c, 0x3f56, 0x4271, 0x468c, 0x5541, 0x585b, 0x5b76, 0x5f91, 
+     0x6e46, 0x7161, 0x757b, 0x7896, 0x874b, 0x8a66, 0x8e81, 0x919b, 
+     0xa051, 0xa36b, 0xa786, 0xaaa1, 0xb956, 0xbd71, 0xc08b, 0xc3a6, 
+     0xd25b, 0xd676, 0xd991, 0xdcab, 0xeb61, 0xef7b, 0xf296, 0xf6b1, 
+     0x3640, 0x3a5b, 0x3d76, 0x4090, 0x4f45, 0x5360, 0x567b, 0x5a96, 
+     0x694b, 0x6c65, 0x6f80, 0x739b, 0x8250, 0x856b, 0x8885, 0x8ca0, 
+     0x9b55, 0x9e70, 0xa28b, 0xa5a5, 0xb45b, 0xb775, 0xbb90, 0xbeab, 
+     0xcd60, 0xd17b, 0xd495, 0xd7b0, 0xe665, 0xea80, 0xed9b, 0xf0b5, 
+     0x3145, 0x3560, 0x387a, 0x3b95, 0x4a4a, 0x4e65, 0x5180, 0x549a, 
+     0x634f, 0x676a, 0x6a85, 0x6ea0, 0x7d55, 0x806f, 0x838a, 0x87a5, 
+     0x965a, 0x9975, 0x9c8f, 0xa0aa, 0xaf5f, 0xb27a, 0xb695, 0xb9af, 
+     0xc865, 0xcb7f, 0xcf9a, 0xd2b5, 0xe16a, 0xe585, 0xe89f, 0xebba, 
+     0x2c4a, 0x2f64, 0x337f, 0x369a, 0x454f, 0x496a, 0x4c84, 0x4f9f, 
+     0x5e54, 0x626f, 0x658a, 0x68a4, 0x7759, 0x7b74, 0x7e8f, 0x82aa, 
+     0x915f, 0x9479, 0x9794, 0x9baf, 0xaa64, 0xad7f, 0xb099, 0xb4b4, 
+     0xc369, 0xc684, 0xca9f, 0xcdb9, 0xdc6f, 0xdf89, 0xe3a4, 0xe6bf, 
+     0x274e, 0x2a69, 0x2e84, 0x319e, 0x4054, 0x436e, 0x4789, 0x4aa4, 
+     0x5959, 0x5d74, 0x608e, 0x63a9, 0x725e, 0x7679, 0x7994, 0x7cae, 
+     0x8b63, 0x8f7e, 0x9299, 0x96b4, 0xa569, 0xa883, 0xab9e, 0xafb9, 
+     0xbe6e, 0xc189, 0xc4a3, 0xc8be, 0xd773, 0xda8e, 0xdea9, 0xe1c3, 
+     0x2253, 0x256e, 0x2888, 0x2ca3, 0x3b58, 0x3e73, 0x428e, 0x45a8, 
+     0x545e, 0x5778, 0x5b93, 0x5eae, 0x6d63, 0x717e, 0x7498, 0x77b3, 
+     0x8668, 0x8a83, 0x8d9e, 0x90b8, 0x9f6d, 0xa388, 0xa6a3, 0xaabe, 
+     0xb973, 0xbc8d, 0xbfa8, 0xc3c3, 0xd278, 0xd593, 0xd8ad, 0xdcc8, 
+     0x1d58, 0x2072, 0x238d, 0x27a8, 0x365d, 0x3978, 0x3c92, 0x40ad, 
+     0x4f62, 0x527d, 0x5698, 0x59b2, 0x6868, 0x6b82, 0x6f9d, 0x72b8, 
+     0x816d, 0x8588, 0x88a2, 0x8bbd, 0x9a72, 0x9e8d, 0xa1a8, 0xa4c2, 
+     0xb377, 0xb792, 0xbaad, 0xbec8, 0xcd7d, 0xd097, 0xd3b2, 0xd7cd, 
+     0x175c, 0x1b77, 0x1e92, 0x22ac, 0x3162, 0x347c, 0x3797, 0x3bb2, 
+     0x4a67, 0x4d82, 0x509c, 0x54b7, 0x636c, 0x6687, 0x6aa2, 0x6dbc, 
+     0x7c72, 0x7f8c, 0x83a7, 0x86c2, 0x9577, 0x9892, 0x9cac, 0x9fc7, 
+     0xae7c, 0xb297, 0xb5b2, 0xb8cc, 0xc781, 0xcb9c, 0xceb7, 0xd1d2 
   } 
 };
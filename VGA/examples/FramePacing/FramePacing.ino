@@ -0,0 +1,35 @@
+// Frame Pacing
+// a ball moved 100 times a second whatever the frame rate, drawn once a
+// frame when there's time, with the frame timings shown
+
+#include <VGA.h>
+
+int x=160,y=120,dx=1,dy=1;   // where the ball is, and where it was drawn
+int ox=160,oy=120;
+
+void update(){
+  x+=dx;y+=dy;
+  if(x<=4 || x>=315)dx=-dx;
+  if(y<=44 || y>=235)dy=-dy;
+}
+
+void render(){
+  VGA.fillCircle(ox,oy,4,0);
+  VGA.fillCircle(x,y,4,255);
+  ox=x;oy=y;
+  char buf[48];
+  const VgaFrameStats &s=VGA.fstats;
+  sprintf(buf,"frame %5dus jitter %4dus",s.frametime,s.jitter);
+  VGA.drawText(buf,0,0,255,0);
+  sprintf(buf,"skipped %lu missed %lu",(unsigned long)s.skipped,(unsigned long)s.missed);
+  VGA.drawText(buf,0,8,255,0);
+}
+
+void setup() {
+  VGA.begin(320,240,VGA_COLOUR);
+  VGA.setFrameRate(100);
+}
+
+void loop(){
+  VGA.runFrame(update,render);
+}
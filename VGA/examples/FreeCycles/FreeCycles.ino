@@ -0,0 +1,30 @@
+// Free Cycles
+// measures how much of each frame is left for the sketch with each way of
+// waiting for the line start (see setLineWait), and shows it on screen
+
+#include <VGA.h>
+
+void setup() {
+  VGA.begin(320,240,VGA_COLOUR);
+}
+
+void show(const char *name, int scheme){
+  VGA.setLineWait(scheme);
+  VGA.freeCycles(60);          // a second for the window to settle
+  uint32_t n=VGA.freeCycles(60);
+  VGA.print(name);
+  VGA.print(n);
+  VGA.print(" cycles a frame free, ");
+  VGA.print(VGA.lwlate);
+  VGA.println(" late lines");
+}
+
+void loop(){
+  VGA.clear();
+  VGA.moveCursor(0,0);
+  show("wait line:   ",VGA_WAIT_LINE);
+  show("wait window: ",VGA_WAIT_WINDOW);
+  VGA.print("window ");
+  VGA.println(VGA.lwindow);
+  delay(5000);
+}
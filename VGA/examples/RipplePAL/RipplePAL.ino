@@ -0,0 +1,36 @@
+// Ripple PAL
+// 3d graph of sinc function
+// demonstrates colour cycling with a colour map
+
+#include <VGA.h>
+
+uint8_t map[256];
+
+void setup() {
+  VGA.beginPAL();
+  for(int i=0;i<256;i++)map[i]=i;
+  VGA.setColourMap(map);
+}
+
+void loop(){
+  
+  for(int x=0;x<320;x++){
+    int my=240;
+    for(float Z=-15.02;Z<15.0;Z+=0.01){
+      float X=(x-159.98)/16.0;
+      float R=sqrt(X*X+Z*Z);
+      float Y=150.0*(1.0+sin(R)/R); // sinc(x) == sin(x)/x
+      int y=320.0-(Z*4.0)-Y;
+      if(y<my && y>=0){
+        uint16_t c=Y;
+        while(c>255)c-=255;
+        VGA.putCPixelFast(x,y,c);
+        my=y;
+      }
+    }
+  }
+  for(;;){ // cycle colours 1-255, leaving black alone
+    VGA.waitSync();
+    for(int i=1;i<256;i++)if(++map[i]==0)map[i]=1;
+  }
+}
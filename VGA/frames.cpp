@@ -0,0 +1,80 @@
+#include "VGA.h"
+
+// Frame pacing for sketches (see runFrame). A frame starts when vertical
+// blanking does. Each runFrame waits for the next one, calls update once for
+// every fstep microseconds that have gone by (or once a frame), and calls
+// render if the last render would still be done before the beam gets back
+// to the bottom of the screen.
+
+#define _V_MAXUPDATES 4 // update calls in one runFrame, before giving up
+#define _V_MAXSKIPS 3   // renders skipped in a row, before rendering anyway
+
+static int _v_fvb;         // vblanks counted at the last runFrame
+static uint32_t _v_ft;     // when it was
+static uint32_t _v_facc;   // time not yet updated for
+static int _v_fskips;      // renders skipped since the last one
+
+// Vertical blanking intervals begun, the one ending frame n counted as n+1
+static int _v_vblanks()
+{
+  int f,l;
+  do{f=*(volatile int *)&VGA.framecount;l=*(volatile int *)&VGA.line;}
+  while(f!=*(volatile int *)&VGA.framecount);
+  return f+(l>=VGA.ysize);
+}
+
+// Microseconds in n lines
+static uint32_t _v_lineus(int n)
+{
+  return (uint32_t)n*VGA.xclocks*VGA.yscale/84;
+}
+
+void Vga::setFrameRate(int hz)
+{
+  fstep=hz>0?1000000/hz:0;
+  memset(&fstats,0,sizeof(fstats));
+  _v_fskips=0;
+}
+
+// Returns 1 if render was called, 0 if not, -1 if not running
+int Vga::runFrame(void (*update)(), void (*render)())
+{
+  if(!up)return -1;
+  VgaFrameStats &s=fstats;
+  uint32_t period=_v_lineus(ytotal),step=fstep?fstep:period;
+  int v=_v_vblanks();
+  if(!s.frames || v<_v_fvb){_v_fvb=v;s.frames=0;} // first, or begun again
+  while(v==_v_fvb)v=_v_vblanks();
+  uint32_t now=micros();
+  if(s.frames){
+    uint32_t d=now-_v_ft;
+    int e=(int)(d-period*(v-_v_fvb));
+    s.frametime=d;
+    s.jitter+=((e<0?-e:e)-s.jitter)/8;
+    s.missed+=v-_v_fvb-1;
+    _v_facc+=d;
+  }
+  else _v_facc=step;      // the first frame gets one update
+  _v_ft=now;_v_fvb=v;s.frames++;
+
+  int n;
+  for(n=0;_v_facc>=step && n<_V_MAXUPDATES;n++){
+    _v_facc-=step;
+    if(update)update();
+  }
+  s.updates+=n;
+  if(_v_facc>=step){s.dropped+=_v_facc/step;_v_facc%=step;}
+
+  if(!render)return 0;
+  int l=*(volatile int *)&line;
+  uint32_t left=_v_lineus(l<ysize?ysize-l:ytotal-l+ysize);
+  if((uint32_t)s.rendertime>left && _v_fskips<_V_MAXSKIPS){
+    s.skipped++;_v_fskips++;
+    return 0;
+  }
+  uint32_t t=micros();
+  render();
+  s.rendertime=micros()-t;
+  s.renders++;_v_fskips=0;
+  return 1;
+}
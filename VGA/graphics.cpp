@@ -1,6 +1,9 @@
 #include "VGA.h"
+#include "raster.h"
+
 
 void Vga::clear(int c){
+  if(qbuf){record(VGA_QCLEAR,&c,1);return;}
     if(mode==VGA_MONO){
 	for(int y=0;y<ysize;y++){
 	      memset(pb+y*pw,(c&1)?0xff:0,xsize/8);
@@ -9,93 +12,58 @@ void Vga::clear(int c){
     else if(mode&VGA_COLOUR){
       memset(cb,c,cbsize);  
     }
+    else if(mode==VGA_4BPP){
+      memset(cb,(c&15)*0x11,cbsize);
+    }
   
 }
 
 void Vga::drawPixel(int x, int y, int c)
 {
-    if((x<0)||(x>=xsize)||(y<0)||(y>=ysize))return;
-    if(mode==VGA_MONO){
-      if(c>=0)  pbb[y*pbw+(x^15)]=c;
-      else pbb[y*pbw+(x^15)]^=c;
-    }
-    else if(mode&VGA_COLOUR){
-      if(c>=0)  cb[y*cw+x]=c;
-      else cb[y*cw+x]^= -c;      
-    }
-}
-template <typename T> int _v_sgn(T val) {
-    return (T(0) < val) - (val < T(0));
+  if(qbuf){int a[]={x,y,c};record(VGA_QPIXEL,a,3);return;}
+    if((x<0)||(x>=vxsize)||(y<0)||(y>=ysize)||!raster)return;
+    raster->pixel(*this,x,y,c);
 }
 
 void Vga::drawLine(int x0, int y0, int x1, int y1,int c)
 {
-   int dx=abs(x1-x0), dy=abs(y1-y0),sx=_v_sgn(x1-x0),sy=_v_sgn(y1-y0);
-   int err=dx-dy; 
-   if((x0!=x1)||(y0!=y1))drawPixel(x1,y1,c);
-   do{ drawPixel(x0,y0,c);
-       int e2=2*err;
-       if (e2 > -dy){err-=dy;x0+=sx;}
-       if (e2 <  dx){err+=dx;y0+=sy;}
-   }   while ((x0!=x1)||(y0!=y1));
+  if(qbuf){int a[]={x0,y0,x1,y1,c};record(VGA_QLINE,a,5);return;}
+  if(raster)raster->line(*this,x0,y0,x1,y1,c,true);
 }
 
 void Vga::drawHLine(int y,int x0, int x1, int col)
 {
-  for(int i=x0;i<=x1;i++)drawPixel(i,y,col);
+  if(qbuf){int a[]={y,x0,x1,col};record(VGA_QHLINE,a,4);return;}
+  if((y<0)||(y>=ysize))return;
+  if(x0<0)x0=0;
+  if(x1>=vxsize)x1=vxsize-1;
+  if(x0>x1||!raster)return;
+  raster->span(*this,y,x0,x1,col);
 }
 
 void Vga::drawLinex(int x0, int y0, int x1, int y1,int c) 
 { // Draw line, missing the last point
-   int dx=abs(x1-x0), dy=abs(y1-y0),sx=_v_sgn(x1-x0),sy=_v_sgn(y1-y0);
-   int err=dx-dy; 
-   while ((x0!=x1)||(y0!=y1)){ 
-       drawPixel(x0,y0,c);
-       int e2=2*err;
-       if (e2 > -dy){err-=dy;x0+=sx;}
-       if (e2 <  dx){err+=dx;y0+=sy;}
-   }   
+  if(qbuf){int a[]={x0,y0,x1,y1,c};record(VGA_QLINEX,a,5);return;}
+  if(raster)raster->line(*this,x0,y0,x1,y1,c,false);
 }
 
 void Vga::drawTri(int x0,int y0,int x1,int y1,int x2,int y2,int col)
 { 
+  if(qbuf){int a[]={x0,y0,x1,y1,x2,y2,col};record(VGA_QTRI,a,7);return;}
   drawLine(x0,y0,x1,y1,col);
   drawLine(x1,y1,x2,y2,col);
   drawLine(x2,y2,x0,y0,col);  
 }
   
-#define _V_P(x,y) if(y>=0 && y<ysize){if(x<xmin[y])xmin[y]=x;if(x>xmax[y])xmax[y]=x;}
 void Vga::fillTri(int x0,int y0,int x1,int y1,int x2,int y2,int col)
-{ //TODO - this can be done without needing an array
-  short xmin[ysize],xmax[ysize];
-  for(int i=0;i<ysize;i++){xmin[i]=xsize;xmax[i]= -1;}
-  int dx,dy,sx,sy,err,x3=x0,y3=y0;
-   dx=abs(x1-x0);dy=abs(y1-y0);sx=_v_sgn(x1-x0);sy=_v_sgn(y1-y0);err=dx-dy; 
-   while ((x0!=x1)||(y0!=y1)){ 
-       _V_P(x0,y0)
-       int e2=2*err;
-       if (e2 > -dy){err-=dy;x0+=sx;}
-       if (e2 <  dx){err+=dx;y0+=sy;}
-   } 
-   dx=abs(x2-x1);dy=abs(y2-y1);sx=_v_sgn(x2-x1);sy=_v_sgn(y2-y1);err=dx-dy; 
-   while ((x1!=x2)||(y1!=y2)){ 
-       _V_P(x1,y1)
-       int e2=2*err;
-       if (e2 > -dy){err-=dy;x1+=sx;}
-       if (e2 <  dx){err+=dx;y1+=sy;}
-   } 
-   dx=abs(x3-x2);dy=abs(y3-y2);sx=_v_sgn(x3-x2);sy=_v_sgn(y3-y2);err=dx-dy; 
-   while ((x2!=x3)||(y2!=y3)){ 
-       _V_P(x2,y2)
-       int e2=2*err;
-       if (e2 > -dy){err-=dy;x2+=sx;}
-       if (e2 <  dx){err+=dx;y2+=sy;}
-   } 
-   for(int i=0;i<ysize;i++)if(xmin[i]<=xmax[i])drawHLine(i,xmin[i],xmax[i],col);
+{
+  if(qbuf){int a[]={x0,y0,x1,y1,x2,y2,col};record(VGA_QFILLTRI,a,7);return;}
+  if(raster)raster->filltri(*this,x0,y0,x1,y1,x2,y2,col);
 }
 
 void Vga::drawRect(int x0, int y0, int x1, int y1, int col)
 {
+  if(qbuf){int a[]={x0,y0,x1,y1,col};record(VGA_QRECT,a,5);return;}
   drawLinex(x0,y0,x0,y1,col);
   drawLinex(x0,y1,x1,y1,col);
   drawLinex(x1,y1,x1,y0,col);
@@ -103,158 +71,98 @@ void Vga::drawRect(int x0, int y0, int x1, int y1, int col)
 }
 
 void Vga::fillRect(int x0, int y0, int x1, int y1, int col){
-  int xa=min(min(xsize-1,x0),x1),xb=max(max(0,x0),x1);
-  for(int y=min(min(ysize-1,y0),y1);y<=max(max(0,y0),y1);y++)
-    drawHLine(y,xa,xb,col);
+  if(qbuf){int a[]={x0,y0,x1,y1,col};record(VGA_QFILLRECT,a,5);return;}
+  int xa=min(x0,x1),xb=max(x0,x1);
+  int ya=max(min(y0,y1),0),yb=min(max(y0,y1),ysize-1);
+  for(int y=ya;y<=yb;y++)drawHLine(y,xa,xb,col);
 }
 
 // These circle and ellipse functions taken from 
 // http://members.chello.at/~easyfilter/bresenham.html
 // by Zingl Alois
 void Vga::drawCircle(int xm, int ym, int r, int col){
-   int x = -r, y = 0, err = 2-2*r;                /* bottom left to top right */
-   do {                                          
-      drawPixel(xm-x, ym+y,col);                        /*   I. Quadrant +x +y */
-      drawPixel(xm-y, ym-x,col);                        /*  II. Quadrant -x +y */
-      drawPixel(xm+x, ym-y,col);                        /* III. Quadrant -x -y */
-      drawPixel(xm+y, ym+x,col);                        /*  IV. Quadrant +x -y */
-      r = err;                                   
-      if (r <= y) err += ++y*2+1;                             /* e_xy+e_y < 0 */
-      if (r > x || err > y)                  /* e_xy+e_x > 0 or no 2nd y-step */
-         err += ++x*2+1;                                     /* -> x-step now */
-   } while (x < 0); 
+  if(qbuf){int a[]={xm,ym,r,col};record(VGA_QCIRCLE,a,4);return;}
+  if(raster)raster->circle(*this,xm,ym,r,col);
 }
 
 void Vga::fillCircle(int xm, int ym, int r, int col){
-   short xmin[ysize],xmax[ysize];
-   for(int i=0;i<ysize;i++){xmin[i]=xsize;xmax[i]= -1;}
-   int x = -r, y = 0, err = 2-2*r;                /* bottom left to top right */
-   do {                                          
-      _V_P(xm-x, ym+y);                        /*   I. Quadrant +x +y */
-      _V_P(xm-y, ym-x);                        /*  II. Quadrant -x +y */
-      _V_P(xm+x, ym-y);                        /* III. Quadrant -x -y */
-      _V_P(xm+y, ym+x);                        /*  IV. Quadrant +x -y */
-      r = err;                                   
-      if (r <= y) err += ++y*2+1;                             /* e_xy+e_y < 0 */
-      if (r > x || err > y)                  /* e_xy+e_x > 0 or no 2nd y-step */
-         err += ++x*2+1;                                     /* -> x-step now */
-   } while (x < 0); 
-   for(int i=0;i<ysize;i++)if(xmin[i]<=xmax[i])drawHLine(i,xmin[i],xmax[i],col);
+  if(qbuf){int a[]={xm,ym,r,col};record(VGA_QFILLCIRCLE,a,4);return;}
+  if(raster)raster->fillcircle(*this,xm,ym,r,col);
 }
 
 void Vga::drawEllipse(int x0, int y0, int x1, int y1, int col)
-{                              /* rectangular parameter enclosing the ellipse */
-   long a = abs(x1-x0), b = abs(y1-y0), b1 = b&1;                 /* diameter */
-   double dx = 4*(1.0-a)*b*b, dy = 4*(b1+1)*a*a;           /* error increment */
-   double err = dx+dy+b1*a*a, e2;                          /* error of 1.step */
-
-   if (x0 > x1) { x0 = x1; x1 += a; }        /* if called with swapped points */
-   if (y0 > y1) y0 = y1;                                  /* .. exchange them */
-   y0 += (b+1)/2; y1 = y0-b1;                               /* starting pixel */
-   a = 8*a*a; b1 = 8*b*b;                   
-                                            
-   do {                                     
-      drawPixel(x1, y0,col);                                  /*   I. Quadrant */
-      drawPixel(x0, y0,col);                                  /*  II. Quadrant */
-      drawPixel(x0, y1,col);                                  /* III. Quadrant */
-      drawPixel(x1, y1,col);                                  /*  IV. Quadrant */
-      e2 = 2*err;
-      if (e2 <= dy) { y0++; y1--; err += dy += a; }                 /* y step */
-      if (e2 >= dx || 2*err > dy) { x0++; x1--; err += dx += b1; }  /* x step */
-   } while (x0 <= x1);
-
-   while (y0-y1 <= b) {                /* too early stop of flat ellipses a=1 */
-      drawPixel(x0-1, y0,col);                    /* -> finish tip of ellipse */
-      drawPixel(x1+1, y0++,col);
-      drawPixel(x0-1, y1,col);
-      drawPixel(x1+1, y1--,col);
-   }
+{
+  if(qbuf){int a[]={x0,y0,x1,y1,col};record(VGA_QELLIPSE,a,5);return;}
+  if(raster)raster->ellipse(*this,x0,y0,x1,y1,col);
 }
 
 void Vga::fillEllipse(int x0, int y0, int x1, int y1, int col)
-{                              /* rectangular parameter enclosing the ellipse */
-   long a = abs(x1-x0), b = abs(y1-y0), b1 = b&1;                 /* diameter */
-   double dx = 4*(1.0-a)*b*b, dy = 4*(b1+1)*a*a;           /* error increment */
-   double err = dx+dy+b1*a*a, e2;                          /* error of 1.step */
-   short xmin[ysize],xmax[ysize];
-   for(int i=0;i<ysize;i++){xmin[i]=xsize;xmax[i]= -1;}
-
-   if (x0 > x1) { x0 = x1; x1 += a; }        /* if called with swapped points */
-   if (y0 > y1) y0 = y1;                                  /* .. exchange them */
-   y0 += (b+1)/2; y1 = y0-b1;                               /* starting pixel */
-   a = 8*a*a; b1 = 8*b*b;                   
-                                            
-   do {                                     
-      _V_P(x1, y0);                                  /*   I. Quadrant */
-      _V_P(x0, y0);                                  /*  II. Quadrant */
-      _V_P(x0, y1);                                  /* III. Quadrant */
-      _V_P(x1, y1);                                  /*  IV. Quadrant */
-      e2 = 2*err;
-      if (e2 <= dy) { y0++; y1--; err += dy += a; }                 /* y step */
-      if (e2 >= dx || 2*err > dy) { x0++; x1--; err += dx += b1; }  /* x step */
-   } while (x0 <= x1);
+{
+  if(qbuf){int a[]={x0,y0,x1,y1,col};record(VGA_QFILLELLIPSE,a,5);return;}
+  if(raster)raster->fillellipse(*this,x0,y0,x1,y1,col);
+}
 
-   while (y0-y1 <= b) {                /* too early stop of flat ellipses a=1 */
-      _V_P(x0-1, y0);                    /* -> finish tip of ellipse */
-      _V_P(x1+1, y0++);
-      _V_P(x0-1, y1);
-      _V_P(x1+1, y1--);
-   }
-   
-   for(int i=0;i<ysize;i++)if(xmin[i]<=xmax[i])drawHLine(i,xmin[i],xmax[i],col);
+// Returns -1, drawing nothing, if n is over VGA_POLYMAX
+int Vga::fillPolygon(const int16_t *xy, int n, int col, int rule)
+{
+  if(n>VGA_POLYMAX)return -1;
+  if(qbuf){int a[]={n,col,rule};if(n>0)record(VGA_QPOLY,a,3,xy,4*n);return 0;}
+  if(raster && n>=3)raster->fillpoly(*this,xy,n,col,rule);
+  return 0;
 }
 
 
 
+// The area is moved a line at a time, starting from the end the lines are
+// moving towards so that no source line is overwritten before it is read.
 void Vga::scroll(int x, int y, int w, int h, int dx, int dy,int col){
-  if(mode&VGA_COLOUR){
-    if(dy<=0){
-      if(dx<=0){      
-	for(int i=x;i<x+w+dx;i++)for(int j=y;j<y+h+dy;j++)
-	  putCPixelFast(i,j,getCPixelFast(i-dx,j-dy));
-      }
-      else{
-	for(int i=x+w-1;i>=x+dx;i--)for(int j=y;j<y+h+dy;j++)
-	  putCPixelFast(i,j,getCPixelFast(i-dx,j-dy));
-      }
-    }
-    else{
-     if(dx<=0){      
-	for(int i=x;i<x+w+dx;i++)for(int j=y+h-1;j>=y+dy;j--)
-	  putCPixelFast(i,j,getCPixelFast(i-dx,j-dy));
-      }
-      else{
-	for(int i=x+w-1;i>=x+dx;i--)for(int j=y+h-1;j>=y+dy;j--)
-	  putCPixelFast(i,j,getCPixelFast(i-dx,j-dy));
-      }
-    }
-  }
-  else 
-  if(mode==VGA_MONO){
-    if(dy<=0){
-      if(dx<=0){      
-	for(int i=x;i<x+w+dx;i++)for(int j=y;j<y+h+dy;j++)
-	  putPPixelFast(i,j,getPPixelFast(i-dx,j-dy));
-      }
-      else{
-	for(int i=x+w-1;i>=x+dx;i--)for(int j=y;j<y+h+dy;j++)
-	  putPPixelFast(i,j,getPPixelFast(i-dx,j-dy));
-      }
-    }
-    else{
-     if(dx<=0){      
-	for(int i=x;i<x+w+dx;i++)for(int j=y+h-1;j>=y+dy;j--)
-	  putPPixelFast(i,j,getPPixelFast(i-dx,j-dy));
-      }
-      else{
-	for(int i=x+w-1;i>=x+dx;i--)for(int j=y+h-1;j>=y+dy;j--)
-	  putPPixelFast(i,j,getPPixelFast(i-dx,j-dy));
-      }
+  if(qbuf){int a[]={x,y,w,h,dx,dy,col};record(VGA_QSCROLL,a,7);return;}
+  int n=w-abs(dx),sx=x+max(-dx,0),tx=x+max(dx,0);
+  if(n>0 && h-abs(dy)>0){
+    int j0=dy>0?y+h-1:y,j1=dy>0?y+dy-1:y+h+dy,sj=dy>0?-1:1;
+    for(int j=j0;j!=j1;j+=sj){
+      if(mode&VGA_COLOUR)memmove(cb+j*cw+tx,cb+(j-dy)*cw+sx,n);
+      else if(mode==VGA_MONO)_v_pmove(pb+j*pw,tx,pb+(j-dy)*pw,sx,n);
+      else if(mode==VGA_4BPP)_v_nmove(cb+j*cw,tx,cb+(j-dy)*cw,sx,n);
     }
   }
   if(col== -256)return;
-  if(dy>0)fillRect(x,y,x+w-1,y+dy-1,col);
-  else if(dy<0)fillRect(x,y+h+dy,x+w-1,y+h-1,col);
-  if(dx>0)fillRect(x,y,x+dx-1,y+h-1,col); 
-  else if(dx<0)fillRect(x+w+dx,y,x+w-1,y+h-1,col);
+  // the edges left behind, each pixel once
+  int ya=y,yb=y+h-1;
+  if(dy>0){fillRect(x,y,x+w-1,y+dy-1,col);ya=y+dy;}
+  else if(dy<0){fillRect(x,y+h+dy,x+w-1,y+h-1,col);yb=y+h+dy-1;}
+  if(ya>yb)return;
+  if(dx>0)fillRect(x,ya,x+dx-1,yb,col);
+  else if(dx<0)fillRect(x+w+dx,ya,x+w-1,yb,col);
+}
+
+static const _v_raster _v_raster_mono={
+  _v_pixel<_v_pbb>,_v_span<_v_pw>,_v_line<_v_pbb>,
+  _v_circle<_v_pbb>,_v_ellipse<_v_pbb>,_v_text<_v_pbb>,
+  _v_filltri<_v_pw>,_v_fillcircle<_v_pw>,_v_fillellipse<_v_pw>,
+  _v_fillpoly<_v_pw>
+};
+
+static const _v_raster _v_raster_colour={
+  _v_pixel<_v_cb>,_v_span<_v_cb>,_v_line<_v_cb>,
+  _v_circle<_v_cb>,_v_ellipse<_v_cb>,_v_text<_v_cb>,
+  _v_filltri<_v_cb>,_v_fillcircle<_v_cb>,_v_fillellipse<_v_cb>,
+  _v_fillpoly<_v_cb>
+};
+
+static const _v_raster _v_raster_4bpp={
+  _v_pixel<_v_nb>,_v_span<_v_nb>,_v_line<_v_nb>,
+  _v_circle<_v_nb>,_v_ellipse<_v_nb>,_v_text<_v_nb>,
+  _v_filltri<_v_nb>,_v_fillcircle<_v_nb>,_v_fillellipse<_v_nb>,
+  _v_fillpoly<_v_nb>
+};
+
+// Called once the mode and frame buffer are set up. Mono plots single pixels
+// through the bit-band alias but fills spans a word at a time.
+void Vga::bindraster()
+{
+  if(mode==VGA_MONO)raster=&_v_raster_mono;
+  else if(mode&VGA_COLOUR)raster=&_v_raster_colour;
+  else if(mode==VGA_4BPP)raster=&_v_raster_4bpp;
+  else raster=0;
 }
@@ -0,0 +1,125 @@
+#include "VGA.h"
+
+// Line renderers for VGA_LINES and VGA_4BPP modes. These run in the video
+// interrupt, one line ahead of the beam, so they must be quick.
+
+// Tile map: each map byte picks an 8x8 tile of 64 colour bytes, and each
+// line copies one 8 byte row of every tile across the screen.
+static void _v_tileline(int line, uint8_t *buf)
+{
+  if(line==0){VGA.tmx=VGA.tsx;VGA.tmy=VGA.tsy;}
+  int ty=((line>>3)+VGA.tmy)%VGA.tmh;
+  const uint8_t *row=VGA.tmap+ty*VGA.tmw;
+  const uint8_t *t=VGA.ttiles+((line&7)<<3);
+  uint8_t *d=buf;
+  int x=VGA.tmx,n=(VGA.xsize+7)>>3;
+  while(n--){
+    memcpy(d,t+(row[x]<<6),8); // two word loads, tiles needn't be aligned
+    d+=8;
+    if(++x==VGA.tmw)x=0;
+  }
+}
+
+void Vga::setTileMap(const uint8_t *map, int w, int h, const uint8_t *tiles)
+{
+  lrender=0;
+  if(!map || w<=0 || h<=0 || !tiles){tmap=0;return;}
+  tmap=map;tmw=w;tmh=h;ttiles=tiles;
+  tsx=tmx=0;tsy=tmy=0;
+  lrender=_v_tileline;
+}
+
+// VGA_4BPP: every byte of the frame buffer, two pixels, maps to a halfword
+// of two colours, so a line is one table lookup and store per 2 pixels.
+// Setting a palette entry rewrites the 32 table entries holding it.
+static uint16_t _v_pal2[256];
+static const uint8_t _v_defpal[16]={ // as CGA: black, blue, green, cyan, red,
+  0x00,0x02,0x10,0x12,0x80,0x82,0x88,0xb6, // magenta, brown, light grey, and
+  0x49,0x4b,0x5d,0x5f,0xe9,0xeb,0xfd,0xff  // the bright versions
+};
+
+static void _v_nibline(int line, uint8_t *buf)
+{
+  int r=line+VGA.yoff;if(r>=VGA.ysize)r-=VGA.ysize;
+  const uint8_t *s=VGA.cbf+r*VGA.cw;
+  uint32_t *d=(uint32_t *)buf;
+  for(int n=(VGA.xsize+3)>>2;n--;s+=2)*d++=_v_pal2[s[0]]|(uint32_t)_v_pal2[s[1]]<<16;
+}
+
+void Vga::setPalette(int i, int c)
+{
+  i&=15;c&=255;
+  pal[i]=c;
+  for(int j=0;j<16;j++){
+    uint16_t *p=_v_pal2+i*16+j;*p=(*p&0xff00)|c; // left pixel is i
+    p=_v_pal2+j*16+i;*p=(*p&0x00ff)|(c<<8);     // right pixel is i
+  }
+}
+
+void Vga::setPalette(const uint8_t *p)
+{
+  if(!p)p=_v_defpal;
+  for(int i=0;i<16;i++)setPalette(i,p[i]);
+}
+
+// Sprites. At line 0 the list is latched and sorted by top line, so moving
+// or changing a sprite mid-frame never tears it. Each line then adds the
+// sprites that start on it to a bit mask of those showing, and draws the
+// mask in list order, so later sprites are on top. The cost per line is
+// bounded by the number of sprites on that line.
+static int _v_sn,_v_snext;
+static uint32_t _v_sact;
+static int16_t _v_sx[VGA_SPRITES],_v_sy[VGA_SPRITES];
+static int _v_sw[VGA_SPRITES],_v_sh[VGA_SPRITES];
+static int16_t _v_sk[VGA_SPRITES];
+static const uint8_t *_v_sb[VGA_SPRITES];
+static uint8_t _v_sord[VGA_SPRITES];
+
+static void _v_spriteframe()
+{
+  const VgaSprite *l=VGA.spr;
+  int n=0;
+  _v_snext=0;_v_sact=0;
+  for(int i=0;i<VGA.sprn;i++){
+    const VgaSprite &s=l[i];
+    if(!s.bits || s.w<=0 || s.y+s.h<=0 || s.y>=VGA.ysize ||
+       s.x+s.w<=0 || s.x>=VGA.xsize)continue;
+    _v_sx[i]=s.x;_v_sy[i]=s.y;_v_sw[i]=s.w;_v_sh[i]=s.h;_v_sb[i]=s.bits;
+    _v_sk[i]=s.key>=0 && s.key<=255?s.key:-1;  // no other key can match
+    int j=n++;
+    for(;j>0 && _v_sy[_v_sord[j-1]]>s.y;j--)_v_sord[j]=_v_sord[j-1];
+    _v_sord[j]=i;
+  }
+  _v_sn=n;
+}
+
+static void _v_spriteline(int line, uint8_t *buf)
+{
+  if(line==0)_v_spriteframe();
+  while(_v_snext<_v_sn && max((int)_v_sy[_v_sord[_v_snext]],0)==line)
+    _v_sact|=1u<<_v_sord[_v_snext++];
+  for(uint32_t m=_v_sact;m;m&=m-1){
+    int i=__builtin_ctz(m);
+    int r=line-_v_sy[i];
+    if(r>=_v_sh[i]){_v_sact&=~(1u<<i);continue;}
+    int x=_v_sx[i],n=_v_sw[i];
+    const uint8_t *p=_v_sb[i]+r*n;
+    if(x<0){p-=x;n+=x;x=0;}
+    if(x+n>VGA.xsize)n=VGA.xsize-x;
+    if(n<=0)continue;
+    uint8_t *d=buf+x;
+    if(_v_sk[i]<0)memcpy(d,p,n);
+    else {
+      uint8_t k=_v_sk[i];
+      while(n--){uint8_t c=*p++;if(c!=k)*d=c;d++;}
+    }
+  }
+}
+
+void _v_renderline(int line, uint8_t *buf)
+{
+  if(VGA.lrender)VGA.lrender(line,buf);
+  else if(VGA.mode==VGA_4BPP)_v_nibline(line,buf);
+  else memset(buf,0,VGA.xsize);
+  if(VGA.spr || _v_sact)_v_spriteline(line,buf);
+}
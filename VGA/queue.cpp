@@ -0,0 +1,97 @@
+#include "VGA.h"
+
+// Draw command queue (see beginQueue). While qbuf is set the drawing calls
+// in graphics.cpp and text.cpp add themselves here instead of drawing. The
+// format is the same on the Due and in extras/HostBench, so a queue sent
+// from a sketch can be replayed and timed on a PC.
+
+// the number of int16 arguments each command has, by opcode
+static const uint8_t _v_qargs[]={0,1,3,5,5,4,7,7,5,5,4,4,5,5,3,5,7};
+
+void Vga::beginQueue(uint8_t *buf, int size)
+{
+  qlen=0;qover=0;
+  qsize=buf && size>0?size:0;
+  qbuf=qsize?buf:0;
+}
+
+// Stops recording. Returns the bytes recorded, or -1 if some didn't fit.
+int Vga::endQueue()
+{
+  int r=qover?-1:qlen;
+  qbuf=0;
+  return r;
+}
+
+// Appends op, the n arguments as 16 bits each, then len bytes of data. Once
+// a command doesn't fit nothing more is added, so what is there is in order.
+void Vga::record(int op, const int *a, int n, const void *data, int len)
+{
+  if(qover || qlen+1+2*n+len>qsize){qover=1;return;}
+  uint8_t *p=qbuf+qlen;
+  *p++=op;
+  for(int i=0;i<n;i++){*p++=a[i];*p++=a[i]>>8;}
+  if(len)memcpy(p,data,len);
+  qlen+=1+2*n+len;
+}
+
+// Draws the n bytes of commands at q. Returns the number of commands drawn,
+// or -1 if q ends part way through one or has one that isn't known.
+int Vga::runQueue(const uint8_t *q, int n)
+{
+  uint8_t *rec=qbuf;qbuf=0;  // not recorded again
+  const uint8_t *e=q+n;
+  int a[7],done=0;
+  while(q<e){
+    int op=*q++;
+    if(op==0 || op>=(int)sizeof(_v_qargs) || e-q<2*_v_qargs[op]){done= -1;break;}
+    for(int i=0;i<_v_qargs[op];i++,q+=2)a[i]=(int16_t)(q[0]|q[1]<<8);
+    const uint8_t *z;
+    switch(op){
+    case VGA_QCLEAR:clear(a[0]);break;
+    case VGA_QPIXEL:drawPixel(a[0],a[1],a[2]);break;
+    case VGA_QLINE:drawLine(a[0],a[1],a[2],a[3],a[4]);break;
+    case VGA_QLINEX:drawLinex(a[0],a[1],a[2],a[3],a[4]);break;
+    case VGA_QHLINE:drawHLine(a[0],a[1],a[2],a[3]);break;
+    case VGA_QTRI:drawTri(a[0],a[1],a[2],a[3],a[4],a[5],a[6]);break;
+    case VGA_QFILLTRI:fillTri(a[0],a[1],a[2],a[3],a[4],a[5],a[6]);break;
+    case VGA_QRECT:drawRect(a[0],a[1],a[2],a[3],a[4]);break;
+    case VGA_QFILLRECT:fillRect(a[0],a[1],a[2],a[3],a[4]);break;
+    case VGA_QCIRCLE:drawCircle(a[0],a[1],a[2],a[3]);break;
+    case VGA_QFILLCIRCLE:fillCircle(a[0],a[1],a[2],a[3]);break;
+    case VGA_QELLIPSE:drawEllipse(a[0],a[1],a[2],a[3],a[4]);break;
+    case VGA_QFILLELLIPSE:fillEllipse(a[0],a[1],a[2],a[3],a[4]);break;
+    case VGA_QPOLY:        // the points follow, at any alignment, so copy them
+      if(a[0]<0 || e-q<4*a[0]){done= -1;break;}
+      if(a[0]<=VGA_POLYMAX){
+        int16_t xy[2*VGA_POLYMAX];
+        memcpy(xy,q,4*a[0]);
+        fillPolygon(xy,a[0],a[1],a[2]);
+      }
+      q+=4*a[0];break;
+    case VGA_QTEXT:        // the text follows, with its 0
+      z=(const uint8_t *)memchr(q,0,e-q);
+      if(!z){done= -1;break;}
+      drawText((char *)q,a[0],a[1],a[2],a[3],a[4]);
+      q=z+1;break;
+    case VGA_QSCROLL:scroll(a[0],a[1],a[2],a[3],a[4],a[5],a[6]);break;
+    }
+    if(done<0)break;
+    done++;
+  }
+  qbuf=rec;
+  return done;
+}
+
+// Draws what has been recorded when the frame ends, and starts recording
+// again. With two buffers it is drawn first and then shown by flip().
+// Returns as endQueue.
+int Vga::flipQueue()
+{
+  if(!qbuf)return -1;
+  int r=qover?-1:qlen;
+  if(dbuf){runQueue(qbuf,qlen);flip();}
+  else{flip();runQueue(qbuf,qlen);}
+  qlen=0;qover=0;
+  return r;
+}
@@ -0,0 +1,721 @@
+// Mode specialised drawing routines for the Due VGA library
+//
+// Every primitive here is a template over a pixel format policy. A policy
+// has two unchecked operations, plot() and span(), which store straight into
+// the frame buffer. Vga::bindraster() (graphics.cpp) picks one instantiation
+// of each primitive when the mode is set up, so no mode tests or function
+// calls are left inside the drawing loops.
+//
+// Only graphics.cpp should include this file.
+
+#ifndef _VGA_RASTER_H
+#define _VGA_RASTER_H
+
+#include "VGA.h"
+
+// Fill n bytes of the colour buffer from p with c, or XOR them with -c if c
+// is negative. Stores are a word at a time once p is word aligned.
+static inline void _v_cspan(uint8_t *p, int n, int c)
+{
+  uint32_t v;
+  uint32_t *w;
+  if(c>=0){
+    v=(c&255)*0x01010101u;
+    while(n && ((uintptr_t)p&3)){*p++=v;n--;}
+    w=(uint32_t *)p;
+    while(n>=16){w[0]=v;w[1]=v;w[2]=v;w[3]=v;w+=4;n-=16;}
+    while(n>=4){*w++=v;n-=4;}
+    p=(uint8_t *)w;
+    while(n--)*p++=v;
+  }
+  else{
+    v=((-c)&255)*0x01010101u;
+    while(n && ((uintptr_t)p&3)){*p++^=v;n--;}
+    w=(uint32_t *)p;
+    while(n>=16){w[0]^=v;w[1]^=v;w[2]^=v;w[3]^=v;w+=4;n-=16;}
+    while(n>=4){*w++^=v;n-=4;}
+    p=(uint8_t *)w;
+    while(n--)*p++^=v;
+  }
+}
+
+// Set, clear or invert pixels x0..x1 of the mono line at p, 16 at a time.
+// Pixel x is bit 15-(x&15) of word x>>4 (the bit pbb[x^15] aliases), so a
+// word holds its pixels left to right from the top bit down. As with
+// drawPixel, col>=0 writes bit 0 of col and col<0 XORs bit 0 of col.
+static inline void _v_pspan(uint16_t *p, int x0, int x1, int c)
+{
+  uint16_t set,inv;
+  if(c>=0){set=(c&1)?0xffff:0;inv=0;}
+  else{if(!(c&1))return;set=0;inv=0xffff;}
+  uint16_t m0=0xffff>>(x0&15),m1=0xffff<<(15-(x1&15));
+  int n=(x1>>4)-(x0>>4);
+  p+=x0>>4;
+  if(n==0)m0&=m1;
+  if(inv)*p^=m0;
+  else *p=(*p&~m0)|(set&m0);
+  if(n==0)return;
+  p++;
+  if(n>1)_v_cspan((uint8_t *)p,2*(n-1),inv?-255:set&255);
+  p+=n-1;
+  if(inv)*p^=m1;
+  else *p=(*p&~m1)|(set&m1);
+}
+
+// Copy n mono pixels from pixel sx of the line at s to pixel x of the line
+// at d, 16 at a time. Each destination word is assembled from the two
+// source words it straddles, and the words are visited in the order that is
+// safe when s and d are the same line.
+static inline void _v_pmove(uint16_t *d, int x, const uint16_t *s, int sx, int n)
+{
+  int o=sx-x;                          // source pixel of destination pixel 0
+  int k0=x>>4,k1=(x+n-1)>>4,k;
+  uint16_t m0=0xffff>>(x&15),m1=0xffff<<(15-((x+n-1)&15));
+  if(k0==k1)m0&=m1;
+  int a=(16*k0+o)>>4,b=o&15;           // a may be -1 if the bits are masked off
+  uint16_t v0=((uint32_t)(a>=0?s[a]:0)<<16|s[a+1])<<b>>16;
+  if(o>=0){                            // moving left, or another line
+    d[k0]=(d[k0]&~m0)|(v0&m0);
+    if(k0==k1)return;
+    for(k=k0+1,a++;k<k1;k++,a++)d[k]=((uint32_t)s[a]<<16|s[a+1])<<b>>16;
+  }
+  else{                                // moving right along the same line
+    if(k0==k1){d[k0]=(d[k0]&~m0)|(v0&m0);return;}
+    a+=k1-k0;
+  }
+  uint16_t v1=((uint32_t)s[a]<<16|s[a+1])<<b>>16;
+  d[k1]=(d[k1]&~m1)|(v1&m1);
+  if(o<0){
+    for(k=k1-1,a--;k>k0;k--,a--)d[k]=((uint32_t)s[a]<<16|s[a+1])<<b>>16;
+    d[k0]=(d[k0]&~m0)|(v0&m0);
+  }
+}
+
+// VGA_4BPP pixels, two a byte with the left one in the high nibble
+static inline int _v_nget(const uint8_t *s, int x){return x&1?s[x>>1]&15:s[x>>1]>>4;}
+static inline void _v_nset(uint8_t *d, int x, int c)
+{
+  uint8_t *p=d+(x>>1);
+  if(x&1)*p=(*p&0xf0)|c;
+  else *p=(*p&0x0f)|(c<<4);
+}
+
+// Moves n 4 bit pixels from pixel sx of line s to pixel x of line d, which
+// may be the same line. When both start on the same half of a byte all but
+// the end pixels are whole bytes.
+static inline void _v_nmove(uint8_t *d, int x, const uint8_t *s, int sx, int n)
+{
+  if(n<=0)return;
+  if(!((x^sx)&1)){
+    int a= -1,b= -1;                  // read the ends before anything moves
+    if(x&1){a=_v_nget(s,sx);x++;sx++;n--;}
+    if(n>0 && (n&1)){b=_v_nget(s,sx+n-1);n--;}
+    memmove(d+(x>>1),s+(sx>>1),n>>1);
+    if(a>=0)_v_nset(d,x-1,a);
+    if(b>=0)_v_nset(d,x+n,b);
+  }
+  else if(d==s && x>sx)for(int i=n-1;i>=0;i--)_v_nset(d,x+i,_v_nget(s,sx+i));
+  else for(int i=0;i<n;i++)_v_nset(d,x+i,_v_nget(s,sx+i));
+}
+
+// Pixel format policies. Coordinates are already on screen, and spans run
+// left to right (x0<=x1) or top to bottom (y0<=y1).
+
+// VGA_MONO, one store per pixel through the bit-band alias pbb
+struct _v_pbb {
+  static inline void plot(Vga &v, int x, int y, int c){
+    if(c>=0)v.pbb[y*v.pbw+(x^15)]=c;
+    else v.pbb[y*v.pbw+(x^15)]^=c;
+  }
+  static inline void span(Vga &v, int y, int x0, int x1, int c){
+    for(int x=x0;x<=x1;x++)plot(v,x,y,c);
+  }
+  static inline void vspan(Vga &v, int x, int y0, int y1, int c){
+    int i=y0*v.pbw+(x^15),n=y1-y0+1;
+    if(c>=0)for(;n--;i+=v.pbw)v.pbb[i]=c;
+    else for(;n--;i+=v.pbw)v.pbb[i]^=c;
+  }
+};
+
+// VGA_MONO, masked read-modify-write of the 16-bit words of pb
+struct _v_pw {
+  static inline void plot(Vga &v, int x, int y, int c){
+    uint16_t *p=v.pb+y*v.pw+(x>>4);
+    uint16_t m=0x8000>>(x&15);
+    if(c>=0){if(c&1)*p|=m;else *p&=~m;}
+    else if(c&1)*p^=m;
+  }
+  static inline void span(Vga &v, int y, int x0, int x1, int c){
+    _v_pspan(v.pb+y*v.pw,x0,x1,c);
+  }
+  static inline void vspan(Vga &v, int x, int y0, int y1, int c){
+    uint16_t *p=v.pb+y0*v.pw+(x>>4);
+    uint16_t m=0x8000>>(x&15);
+    int n=y1-y0+1;
+    if(c<0){if(c&1)for(;n--;p+=v.pw)*p^=m;}
+    else if(c&1)for(;n--;p+=v.pw)*p|=m;
+    else for(;n--;p+=v.pw)*p&=~m;
+  }
+};
+
+// VGA_COLOUR, VGA_PAL and VGA_NTSC, one byte per pixel in cb
+struct _v_cb {
+  static inline void plot(Vga &v, int x, int y, int c){
+    if(c>=0)v.cb[y*v.cw+x]=c;
+    else v.cb[y*v.cw+x]^= -c;
+  }
+  static inline void span(Vga &v, int y, int x0, int x1, int c){
+    _v_cspan(v.cb+y*v.cw+x0,x1-x0+1,c);
+  }
+  static inline void vspan(Vga &v, int x, int y0, int y1, int c){
+    uint8_t *p=v.cb+y0*v.cw+x;
+    int n=y1-y0+1;
+    if(c>=0)for(;n--;p+=v.cw)*p=c;
+    else for(;n--;p+=v.cw)*p^= -c;
+  }
+};
+
+// VGA_4BPP, nibble plots at the ends of a span and whole bytes between
+struct _v_nb {
+  static inline void plot(Vga &v, int x, int y, int c){
+    uint8_t *p=v.cb+y*v.cw+(x>>1);
+    int s=x&1?0:4;
+    if(c>=0)*p=(*p&~(15<<s))|((c&15)<<s);
+    else *p^=((-c)&15)<<s;
+  }
+  static inline void span(Vga &v, int y, int x0, int x1, int c){
+    if(c<0 && !((-c)&15))return;
+    if(x0&1)plot(v,x0++,y,c);
+    if(!(x1&1) && x1>=x0)plot(v,x1--,y,c);
+    if(x0<x1)_v_cspan(v.cb+y*v.cw+(x0>>1),(x1-x0+1)>>1,c>=0?(c&15)*0x11:-(((-c)&15)*0x11));
+  }
+  static inline void vspan(Vga &v, int x, int y0, int y1, int c){
+    for(int y=y0;y<=y1;y++)plot(v,x,y,c);
+  }
+};
+
+// Plot, skipping the bounds test when the caller (C=false) has already
+// established that the whole shape is on screen.
+template <class P, bool C> inline void _v_put(Vga &v, int x, int y, int c)
+{
+  if(C && (((unsigned)x>=(unsigned)v.vxsize)||((unsigned)y>=(unsigned)v.ysize)))
+    return;
+  P::plot(v,x,y,c);
+}
+
+template <class P> void _v_pixel(Vga &v, int x, int y, int c)
+{
+  P::plot(v,x,y,c);
+}
+
+template <class P> void _v_span(Vga &v, int y, int x0, int x1, int c)
+{
+  P::span(v,y,x0,x1,c);
+}
+
+template <typename T> inline int _v_sgn(T val) {
+    return (T(0) < val) - (val < T(0));
+}
+
+// Lines
+//
+// drawLine's Bresenham loop (err=dx-dy, x step if 2*err>-dy, y step if
+// 2*err<dx) has a closed form. Call the longer axis major, with length dM,
+// and the other minor, with length dm. Then pixel t (0<=t<=dM) is t steps
+// along the major axis and
+//   k(t) = (2*dm*t + dM-1) / (2*dM)
+// steps along the minor axis. So the line can be clipped to the screen
+// exactly, before any drawing, by solving for the range of t that keeps
+// both coordinates on screen. The pixels drawn are the same as before.
+
+// Minor axis positions of the pixels of a mostly horizontal line come in
+// runs of at least this length on average before it is drawn as spans
+#define _V_RUNSPAN 4
+
+// Clip t=0..tn along a line from (M0,m0) stepping by sM on the major axis and
+// sm on the minor axis, with screen sizes Ms and ms. Returns false if no part
+// is visible, otherwise the visible range of t in ta..tb.
+static inline bool _v_clipline(int M0, int m0, int sM, int sm, int dM, int dm,
+			       int Ms, int ms, int tn, int &ta, int &tb)
+{
+  ta=0;tb=tn;
+  // major axis: M0+sM*t in 0..Ms-1
+  if(sM>0){ta=max(ta,-M0);tb=min(tb,Ms-1-M0);}
+  else{ta=max(ta,M0-(Ms-1));tb=min(tb,M0);}
+  if(ta>tb)return false;
+  // minor axis: m0+sm*k(t) in 0..ms-1, with k(t) in ka..kb
+  long long ka,kb;
+  if(sm>0){ka= -m0;kb=ms-1-m0;}
+  else{ka=m0-(ms-1);kb=m0;}
+  if(kb<0)return false;
+  if(ka>0){ // first t with k(t)>=ka
+    long long t=(2*(long long)dM*ka-dM+1+2*dm-1)/(2*dm);
+    if(t>ta)ta=t>tb?tb+1:(int)t;
+  }
+  { // last t with k(t)<=kb
+    long long t=(2*(long long)dM*(kb+1)-dM)/(2*dm);
+    if(t<tb)tb=(int)t;
+  }
+  return ta<=tb;
+}
+
+// Bresenham line; 'last' says whether the end point (x1,y1) is drawn
+template <class P>
+void _v_line(Vga &v, int x0, int y0, int x1, int y1, int c, bool last)
+{
+  int dx=abs(x1-x0), dy=abs(y1-y0),sx=_v_sgn(x1-x0),sy=_v_sgn(y1-y0);
+  if(!last && !dx && !dy)return;         // drawLinex of a point draws nothing
+  if(!dy){                                                    // horizontal
+    int xa=x0,xb=last?x1:x1-sx;
+    if(xa>xb){int t=xa;xa=xb;xb=t;}
+    if((y0<0)||(y0>=v.ysize))return;
+    if(xa<0)xa=0;
+    if(xb>=v.vxsize)xb=v.vxsize-1;
+    if(xa<=xb)P::span(v,y0,xa,xb,c);
+    return;
+  }
+  if(!dx){                                                      // vertical
+    int ya=y0,yb=last?y1:y1-sy;
+    if(ya>yb){int t=ya;ya=yb;yb=t;}
+    if((x0<0)||(x0>=v.vxsize))return;
+    if(ya<0)ya=0;
+    if(yb>=v.ysize)yb=v.ysize-1;
+    if(ya<=yb)P::vspan(v,x0,ya,yb,c);
+    return;
+  }
+
+  bool xmajor=dx>=dy;
+  int dM=xmajor?dx:dy,dm=xmajor?dy:dx,tn=last?dM:dM-1;
+  int ta=0,tb=tn;
+  if(((unsigned)x0>=(unsigned)v.vxsize)||((unsigned)x1>=(unsigned)v.vxsize)||
+     ((unsigned)y0>=(unsigned)v.ysize)||((unsigned)y1>=(unsigned)v.ysize)){
+    bool vis=xmajor?
+      _v_clipline(x0,y0,sx,sy,dM,dm,v.vxsize,v.ysize,tn,ta,tb):
+      _v_clipline(y0,x0,sy,sx,dM,dm,v.ysize,v.vxsize,tn,ta,tb);
+    if(!vis)return;
+  }
+
+  // position and error term at t=ta: r=(2*dm*t+dM-1) mod 2*dM
+  int k,r,n=tb-ta+1;
+  if(ta){
+    long long num=2*(long long)dm*ta+dM-1;
+    k=num/(2*dM);r=num%(2*dM);
+  }
+  else{k=0;r=dM-1;}
+  int d2m=2*dm,d2M=2*dM;
+  if(xmajor){
+    int x=x0+sx*ta,y=y0+sy*k;
+    if(dx>=_V_RUNSPAN*dy){                       // whole runs at a time
+      while(n>0){
+	int run=(d2M-r+d2m-1)/d2m;
+	if(run>n)run=n;
+	int xe=x+sx*(run-1);
+	if(sx>0)P::span(v,y,x,xe,c);else P::span(v,y,xe,x,c);
+	x=xe+sx;y+=sy;n-=run;r+=run*d2m-d2M;
+      }
+    }
+    else for(;n--;x+=sx){
+      P::plot(v,x,y,c);
+      r+=d2m;if(r>=d2M){r-=d2M;y+=sy;}
+    }
+  }
+  else{
+    int y=y0+sy*ta,x=x0+sx*k;
+    for(;n--;y+=sy){
+      P::plot(v,x,y,c);
+      r+=d2m;if(r>=d2M){r-=d2M;x+=sx;}
+    }
+  }
+}
+
+// These circle and ellipse functions taken from
+// http://members.chello.at/~easyfilter/bresenham.html
+// by Zingl Alois
+template <class P, bool C> void _v_circle_(Vga &v, int xm, int ym, int r, int c)
+{
+   int x = -r, y = 0, err = 2-2*r;                /* bottom left to top right */
+   do {
+      _v_put<P,C>(v,xm-x, ym+y,c);                     /*   I. Quadrant +x +y */
+      _v_put<P,C>(v,xm-y, ym-x,c);                     /*  II. Quadrant -x +y */
+      _v_put<P,C>(v,xm+x, ym-y,c);                     /* III. Quadrant -x -y */
+      _v_put<P,C>(v,xm+y, ym+x,c);                     /*  IV. Quadrant +x -y */
+      r = err;
+      if (r <= y) err += ++y*2+1;                             /* e_xy+e_y < 0 */
+      if (r > x || err > y)                  /* e_xy+e_x > 0 or no 2nd y-step */
+         err += ++x*2+1;                                     /* -> x-step now */
+   } while (x < 0);
+}
+
+template <class P> void _v_circle(Vga &v, int xm, int ym, int r, int c)
+{
+  int ra=abs(r);
+  if((xm-ra>=0)&&(xm+ra<v.vxsize)&&(ym-ra>=0)&&(ym+ra<v.ysize))
+    _v_circle_<P,false>(v,xm,ym,r,c);
+  else _v_circle_<P,true>(v,xm,ym,r,c);
+}
+
+// Zingl's ellipse with the error terms in integers of type T instead of
+// doubles, which the Due has to emulate. The terms are exact, so the pixels
+// are the ones the double version gave wherever that was exact itself.
+// 32 bits are enough while neither diameter exceeds _V_ELLIPSE32.
+#define _V_ELLIPSE32 512
+
+template <class P, bool C, class T>
+void _v_ellipse_(Vga &v, int x0, int y0, int x1, int y1, int c)
+{                              /* rectangular parameter enclosing the ellipse */
+   T a = abs(x1-x0), b = abs(y1-y0), b1 = b&1;                    /* diameter */
+   T dx = 4*(1-a)*b*b, dy = 4*(b1+1)*a*a;                  /* error increment */
+   T err = dx+dy+b1*a*a, e2;                               /* error of 1.step */
+
+   if (x0 > x1) { x0 = x1; x1 += a; }        /* if called with swapped points */
+   if (y0 > y1) y0 = y1;                                  /* .. exchange them */
+   y0 += (b+1)/2; y1 = y0-b1;                               /* starting pixel */
+   a = 8*a*a; b1 = 8*b*b;
+
+   do {
+      _v_put<P,C>(v,x1, y0,c);                               /*   I. Quadrant */
+      _v_put<P,C>(v,x0, y0,c);                               /*  II. Quadrant */
+      _v_put<P,C>(v,x0, y1,c);                               /* III. Quadrant */
+      _v_put<P,C>(v,x1, y1,c);                               /*  IV. Quadrant */
+      e2 = 2*err;
+      if (e2 <= dy) { y0++; y1--; err += dy += a; }                 /* y step */
+      if (e2 >= dx || 2*err > dy) { x0++; x1--; err += dx += b1; }  /* x step */
+   } while (x0 <= x1);
+
+   while (y0-y1 <= b) {                /* too early stop of flat ellipses a=1 */
+      _v_put<P,C>(v,x0-1, y0,c);                  /* -> finish tip of ellipse */
+      _v_put<P,C>(v,x1+1, y0++,c);
+      _v_put<P,C>(v,x0-1, y1,c);
+      _v_put<P,C>(v,x1+1, y1--,c);
+   }
+}
+
+template <class P, class T>
+void _v_ellipset(Vga &v, int x0, int y0, int x1, int y1, int c)
+{
+  // the tip loop can step one pixel outside the bounding rectangle
+  if((min(x0,x1)>=1)&&(max(x0,x1)<v.vxsize-1)&&
+     (min(y0,y1)>=1)&&(max(y0,y1)<v.ysize-1))
+    _v_ellipse_<P,false,T>(v,x0,y0,x1,y1,c);
+  else _v_ellipse_<P,true,T>(v,x0,y0,x1,y1,c);
+}
+
+template <class P> void _v_ellipse(Vga &v, int x0, int y0, int x1, int y1, int c)
+{
+  if(max(abs(x1-x0),abs(y1-y0))<=_V_ELLIPSE32)
+    _v_ellipset<P,int32_t>(v,x0,y0,x1,y1,c);
+  else _v_ellipset<P,int64_t>(v,x0,y0,x1,y1,c);
+}
+
+// One 8x8 character. Font pixel (i,j) goes to (x+i*ax+j*bx, y+i*ay+j*by).
+template <class P, bool C>
+void _v_glyph(Vga &v, uint8_t t, int x, int y, int ax, int ay, int bx, int by,
+	      int c, int b)
+{
+  const uint8_t *g=_vga_font8x8+8*t;
+  for(int j=0;j<8;j++){
+    int px=x+j*bx,py=y+j*by;
+    uint8_t f=g[j];
+    for(int i=0;i<8;i++){
+      if(f&0x80)_v_put<P,C>(v,px,py,c);
+      else if(b!= -256)_v_put<P,C>(v,px,py,b);
+      f<<=1;px+=ax;py+=ay;
+    }
+  }
+}
+
+template <class P>
+void _v_text(Vga &v, const char *text, int x, int y, int c, int b, int dir)
+{
+  int ax,ay,bx,by;
+  switch(dir){
+  case -1:
+  case 0: ax=1;ay=0;bx=0;by=1;break;
+  case 1: ax=0;ay= -1;bx=1;by=0;break;
+  case 2: ax= -1;ay=0;bx=0;by= -1;break;
+  case 3: ax=0;ay=1;bx= -1;by=0;break;
+  default: return;
+  }
+  int ex=7*(ax+bx),ey=7*(ay+by); // offset of the opposite corner
+  uint8_t t;
+  while((t=(uint8_t)*text++)){
+    if(((unsigned)x<(unsigned)v.vxsize)&&((unsigned)(x+ex)<(unsigned)v.vxsize)&&
+       ((unsigned)y<(unsigned)v.ysize)&&((unsigned)(y+ey)<(unsigned)v.ysize))
+      _v_glyph<P,false>(v,t,x,y,ax,ay,bx,by,c,b);
+    else _v_glyph<P,true>(v,t,x,y,ax,ay,bx,by,c,b);
+    if(dir==0)x+=8;else if(dir==1)y-=8;else if(dir==2)x-=8;else y+=8;
+  }
+}
+
+// Filled shapes
+//
+// These visit only the rows the shape covers and hand each row to the span
+// writer as soon as its extent is known, so there are no per-row arrays and
+// the cost is proportional to the area drawn.
+
+// Clip one row of a filled shape and draw it
+template <class P> inline void _v_row(Vga &v, int y, int xa, int xb, int c)
+{
+  if((unsigned)y>=(unsigned)v.ysize)return;
+  if(xa<0)xa=0;
+  if(xb>=v.vxsize)xb=v.vxsize-1;
+  if(xa<=xb)P::span(v,y,xa,xb,c);
+}
+
+// One edge of a filled shape, walked a row at a time from top to bottom. It
+// covers the same pixels as drawLine between its end points. An edge that
+// drawLine would run upwards is walked from its bottom end with the minor
+// axis rounding reversed (bias dM instead of dM-1, see the line comment),
+// which gives the same pixels as running the loop forwards.
+struct _v_edge {
+  int ys,ye;      // first and last row still to walk
+  int x,sx;       // x at the current row (start of the run), step
+  int t,dM,d2M,d2m,r;
+  bool xmajor;
+
+  // set up the edge (xa,ya)->(xb,yb), starting at row y0>=min(ya,yb);
+  // returns false if the edge covers no rows from y0 on
+  bool init(int xa, int ya, int xb, int yb, int y0){
+    int bias= -1;
+    if(ya>yb){int tx=xa,ty=ya;xa=xb;ya=yb;xb=tx;yb=ty;bias=0;}
+    ys=max(ya,y0);ye=yb;
+    if(ys>ye)return false;
+    int dx=abs(xb-xa),dy=yb-ya;
+    sx=_v_sgn(xb-xa);
+    xmajor=dx>=dy;
+    dM=xmajor?dx:dy;
+    d2M=2*dM;d2m=2*(xmajor?dy:dx);
+    bias+=dM;
+    long long j=ys-ya;
+    if(!dy){x=xa;t=0;r=0;}
+    else if(xmajor){   // first t on row j, and the error term there
+      long long lo=j?(d2M*j-bias+d2m-1)/d2m:0;
+      t=lo;r=d2m*lo+bias-d2M*j;x=xa+sx*t;
+    }
+    else{
+      long long num=d2m*j+bias;
+      x=xa+sx*(int)(num/d2M);r=num%d2M;
+    }
+    return true;
+  }
+
+  // extent of the edge on row ys, then move on to the next row
+  void next(int &xl, int &xr){
+    int xa=x,xb=x;
+    if(!d2m)xb=x+sx*dM;                              // horizontal or vertical
+    else if(xmajor){
+      int run=(d2M-r+d2m-1)/d2m;
+      if(t+run>dM)run=dM-t+1;
+      xb=x+sx*(run-1);
+      x=xb+sx;t+=run;r+=run*d2m-d2M;
+    }
+    else{r+=d2m;if(r>=d2M){r-=d2M;x+=sx;}}
+    if(xa>xb){int tt=xa;xa=xb;xb=tt;}
+    if(xa<xl)xl=xa;
+    if(xb>xr)xr=xb;
+    ys++;
+  }
+};
+
+// The hull of the three edges as drawTri draws them. With the corners
+// sorted by y, rows down to the middle corner are spanned by the long edge
+// and the first short edge, and rows from it on by the long edge and the
+// second; the middle row itself touches all three.
+template <class P>
+void _v_filltri(Vga &v, int x0, int y0, int x1, int y1, int x2, int y2, int c)
+{
+  if((x0==x1)&&(x1==x2)&&(y0==y1)&&(y1==y2))return;
+  // keep each edge's direction so its pixels match drawTri
+  int ex[3][4]={{x0,y0,x1,y1},{x1,y1,x2,y2},{x2,y2,x0,y0}};
+  int top=0,bot=0;
+  if(y1<y0)top=1;else if(y1>y0)bot=1;
+  if(y2<min(y0,y1))top=2;else if(y2>=max(y0,y1))bot=2;
+  if(top==bot)bot=(top+1)%3;                            // all on one row
+  int mid=3-top-bot;
+  int yt=min(min(y0,y1),y2),ym=max(min(y0,y1),min(max(y0,y1),y2));
+  int yb=max(max(y0,y1),y2);
+  // edge i runs from corner i to corner i+1
+  int el=(bot==(top+1)%3)?top:bot;       // long edge, joining top and bottom
+  int e1=(mid==(top+1)%3)?top:mid;       // short edge, top to middle
+  int e2=(bot==(mid+1)%3)?mid:bot;       // short edge, middle to bottom
+  int ya=max(yt,0),ye=min(yb,v.ysize-1);
+  if(ya>ye)return;
+  _v_edge l=_v_edge(),s=_v_edge();
+  bool lon=((ex[el][0]!=ex[el][2])||(ex[el][1]!=ex[el][3])) &&
+    l.init(ex[el][0],ex[el][1],ex[el][2],ex[el][3],ya);
+  bool son=((ex[e1][0]!=ex[e1][2])||(ex[e1][1]!=ex[e1][3])) &&
+    s.init(ex[e1][0],ex[e1][1],ex[e1][2],ex[e1][3],ya);
+  int y=ya;
+  for(;y<=min(ym-1,ye);y++){
+    int xl=0x7fffffff,xr= -0x7fffffff;
+    if(lon)l.next(xl,xr);
+    if(son)s.next(xl,xr);
+    _v_row<P>(v,y,xl,xr,c);
+  }
+  if(y>ye)return;
+  int xl=0x7fffffff,xr= -0x7fffffff;
+  if(y==ym){                        // the middle row, where the edges meet
+    if(lon)l.next(xl,xr);
+    if(son && s.ys==y && s.ys<=s.ye)s.next(xl,xr);
+  }
+  son=((ex[e2][0]!=ex[e2][2])||(ex[e2][1]!=ex[e2][3])) &&
+    s.init(ex[e2][0],ex[e2][1],ex[e2][2],ex[e2][3],y);
+  if(y==ym){
+    if(son)s.next(xl,xr);
+    _v_row<P>(v,y,xl,xr,c);
+    y++;
+  }
+  for(;y<=ye;y++){
+    xl=0x7fffffff;xr= -0x7fffffff;
+    if(lon)l.next(xl,xr);
+    if(son)s.next(xl,xr);
+    _v_row<P>(v,y,xl,xr,c);
+  }
+}
+
+// The circle drawCircle draws is symmetric about its diagonals, so each row
+// ym+y and ym-y runs from xm-u to xm+u, where u is the x offset of the first
+// point of the walk on that row.
+template <class P> void _v_fillcircle(Vga &v, int xm, int ym, int r, int c)
+{
+   if(r<0)return;
+   int x = -r, y = 0, err = 2-2*r, yd= -1;
+   do {
+      if(y!=yd){
+	yd=y;
+	_v_row<P>(v,ym+y,xm+x,xm-x,c);
+	if(y)_v_row<P>(v,ym-y,xm+x,xm-x,c);
+      }
+      if(ym-y<0 && ym+y>=v.ysize)     /* rows left are all off screen */
+	return;
+      r = err;
+      if (r <= y) err += ++y*2+1;
+      if (r > x || err > y) err += ++x*2+1;
+   } while (x < 0);
+   if(y!=yd){                                     /* the point (xm,ym+-r) */
+      _v_row<P>(v,ym+y,xm,xm,c);
+      if(y)_v_row<P>(v,ym-y,xm,xm,c);
+   }
+}
+
+// drawEllipse's walk moves outwards from the middle row, and reaches each
+// row first at its widest, so a row is drawn the first time it is visited.
+// y0 walks the lower half and y1 the upper half; they share the middle row
+// when the height is even.
+template <class P, class T>
+void _v_fillellipse_(Vga &v, int x0, int y0, int x1, int y1, int c)
+{
+   T a = abs(x1-x0), b = abs(y1-y0), b1 = b&1;
+   T dx = 4*(1-a)*b*b, dy = 4*(b1+1)*a*a;
+   T err = dx+dy+b1*a*a, e2;
+
+   if (x0 > x1) { x0 = x1; x1 += a; }
+   if (y0 > y1) y0 = y1;
+   y0 += (b+1)/2; y1 = y0-b1;
+   a = 8*a*a; b1 = 8*b*b;
+   int yd0=y0-1,yd1=y1+1;                    /* rows done so far, each half */
+
+   do {
+      if(y0!=yd0){yd0=y0;_v_row<P>(v,y0,x0,x1,c);}
+      if(y1!=yd1 && y1!=yd0){yd1=y1;_v_row<P>(v,y1,x0,x1,c);}
+      e2 = 2*err;
+      if (e2 <= dy) { y0++; y1--; err += dy += a; }
+      if (e2 >= dx || 2*err > dy) { x0++; x1--; err += dx += b1; }
+   } while (x0 <= x1);
+
+   int xa=min(x0-1,x1+1),xb=max(x0-1,x1+1);
+   while (y0-y1 <= b) {                        /* tip of flat ellipses a=1 */
+      if(y0!=yd0){yd0=y0;_v_row<P>(v,y0,xa,xb,c);}
+      y0++;
+      if(y1!=yd1 && y1!=yd0){yd1=y1;_v_row<P>(v,y1,xa,xb,c);}
+      y1--;
+   }
+}
+
+template <class P> void _v_fillellipse(Vga &v, int x0, int y0, int x1, int y1, int c)
+{
+  if(max(abs(x1-x0),abs(y1-y0))<=_V_ELLIPSE32)
+    _v_fillellipse_<P,int32_t>(v,x0,y0,x1,y1,c);
+  else _v_fillellipse_<P,int64_t>(v,x0,y0,x1,y1,c);
+}
+
+// One edge of a polygon, stepped a row at a time. The polygon covers the
+// integer points inside it, with points on a left or top edge in and those
+// on a right or bottom edge out, so polygons that share an edge tile with no
+// gaps or overlap (which matters for XOR colours). x+r/dy is the exact
+// crossing on the current row, and the first pixel at or to the right of it
+// is key().
+struct _v_pedge {  // 16 bytes, so VGA_POLYMAX of them fit on the stack
+  int q;            // step per row, q+rem/dy
+  int16_t x,y0;     // crossing on the current row, and the first row
+  uint16_t r,rem,dy;// 0<=r<dy, 0<=rem<dy; covers rows y0..y0+dy-1
+  int8_t w;         // +1 if the edge runs down, -1 if up
+  int key() const {return x+(r>0);}
+  int y1() const {return y0+dy;}
+  // move k rows on from the start of the edge
+  void start(int k){
+    long long t=(long long)k*rem;
+    x+=(int)((long long)k*q+t/dy);r=t%dy;
+  }
+  void step(){int n=r+rem;x+=q;if(n>=dy){n-=dy;x++;}r=n;}
+};
+
+// Sorted edge table and active edge list, both on the stack and sized for
+// VGA_POLYMAX corners, and the spans between crossings handed straight to
+// the span writer. rule is VGA_EVENODD or VGA_NONZERO.
+template <class P>
+void _v_fillpoly(Vga &v, const int16_t *xy, int n, int c, int rule)
+{
+  if(n>VGA_POLYMAX)return;
+  _v_pedge e[VGA_POLYMAX];
+  uint8_t act[VGA_POLYMAX];
+  int ne=0,ymin=0x7fffffff,ymax= -0x7fffffff;
+  for(int i=0;i<n;i++){
+    int j=(i+1<n)?i+1:0;
+    int xa=xy[2*i],ya=xy[2*i+1],xb=xy[2*j],yb=xy[2*j+1],w=1;
+    if(ya==yb)continue;                           // horizontal, no crossings
+    if(ya>yb){int t=xa;xa=xb;xb=t;t=ya;ya=yb;yb=t;w= -1;}
+    _v_pedge &p=e[ne++];
+    int dy=yb-ya,q=(xb-xa)/dy,rem=(xb-xa)%dy;
+    if(rem<0){q--;rem+=dy;}
+    p.q=q;p.rem=rem;p.dy=dy;
+    p.x=xa;p.r=0;p.y0=ya;p.w=w;
+    ymin=min(ymin,ya);ymax=max(ymax,yb);
+  }
+  // edge table, by first row
+  for(int i=1;i<ne;i++){
+    _v_pedge t=e[i];int j=i;
+    for(;j>0 && e[j-1].y0>t.y0;j--)e[j]=e[j-1];
+    e[j]=t;
+  }
+  int y=max(ymin,0),ye=min(ymax,v.ysize),next=0,na=0;
+  while(y<ye){
+    int j=0;                                      // drop finished edges
+    for(int i=0;i<na;i++)if(e[act[i]].y1()>y)act[j++]=act[i];
+    na=j;
+    for(;next<ne && e[next].y0<=y;next++)         // and add new ones
+      if(e[next].y1()>y){e[next].start(y-e[next].y0);act[na++]=next;}
+    if(!na){
+      if(next>=ne)break;
+      y=e[next].y0;continue;
+    }
+    for(int i=1;i<na;i++){                        // keep them in x order
+      int a=act[i],k=e[a].key();
+      for(j=i;j>0 && e[act[j-1]].key()>k;j--)act[j]=act[j-1];
+      act[j]=a;
+    }
+    int wind=0,xs=0;
+    for(int i=0;i<na;i++){
+      _v_pedge &p=e[act[i]];
+      bool in=rule==VGA_NONZERO?wind!=0:(wind&1);
+      wind+=p.w;
+      bool now=rule==VGA_NONZERO?wind!=0:(wind&1);
+      if(!in && now)xs=p.key();
+      else if(in && !now)_v_row<P>(v,y,xs,p.key()-1,c);
+      p.step();
+    }
+    y++;
+  }
+}
+
+#endif
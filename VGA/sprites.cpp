@@ -0,0 +1,140 @@
+#include "VGA.h"
+#include "raster.h"
+
+// Sprites in the frame buffer modes. Each sprite drawn keeps a copy of the
+// pixels under it. updateSprites() finds the sprites that have changed, and
+// any that overlap them, and at the start of the next blanking interval puts
+// their backgrounds back (top sprite first) and draws them again (bottom
+// sprite first). Sprites that have not changed are left alone.
+
+struct _v_fbspr {
+  VgaSprite s;        // the sprite as it was drawn
+  int x,y,w,h;        // the part on screen, w=0 if none
+  uint8_t *save;int cap; // the pixels under it, and the size of save
+  bool on;            // s and the rectangle are valid
+};
+static _v_fbspr _v_fs[VGA_SPRITES];
+
+static void _v_fbclip(Vga &v, const VgaSprite &s, int &x, int &y, int &w, int &h)
+{
+  x=max(s.x,0);y=max(s.y,0);
+  w=min(s.x+s.w,v.vxsize)-x;h=min(s.y+s.h,v.ysize)-y;
+  if(!s.bits || w<=0 || h<=0)w=h=0;
+}
+
+static bool _v_fboverlap(const _v_fbspr &a, int x, int y, int w, int h)
+{
+  return a.w && w && a.x<x+w && x<a.x+a.w && a.y<y+h && y<a.y+a.h;
+}
+
+// mono rows are saved as words, one more than the pixels need for _v_pmove
+static inline int _v_fbwords(int w){return ((w+15)>>4)+1;}
+
+static void _v_fbsave(Vga &v, _v_fbspr &f)
+{
+  if(v.mode==VGA_MONO){
+    int k=_v_fbwords(f.w);
+    uint16_t *d=(uint16_t *)f.save;
+    for(int r=0;r<f.h;r++)_v_pmove(d+r*k,0,v.pb+(f.y+r)*v.pw,f.x,f.w);
+  }
+  else for(int r=0;r<f.h;r++)memcpy(f.save+r*f.w,v.cb+(f.y+r)*v.cw+f.x,f.w);
+}
+
+static void _v_fbrestore(Vga &v, _v_fbspr &f)
+{
+  if(v.mode==VGA_MONO){
+    int k=_v_fbwords(f.w);
+    const uint16_t *s=(const uint16_t *)f.save;
+    for(int r=0;r<f.h;r++)_v_pmove(v.pb+(f.y+r)*v.pw,f.x,s+r*k,0,f.w);
+  }
+  else for(int r=0;r<f.h;r++)memcpy(v.cb+(f.y+r)*v.cw+f.x,f.save+r*f.w,f.w);
+}
+
+static void _v_fbdraw(Vga &v, const _v_fbspr &f)
+{
+  const VgaSprite &s=f.s;
+  for(int r=0;r<f.h;r++){
+    const uint8_t *p=s.bits+(f.y-s.y+r)*s.w+(f.x-s.x);
+    if(v.mode==VGA_MONO){
+      int i=(f.y+r)*v.pbw;
+      for(int x=f.x;x<f.x+f.w;x++,p++)if(*p!=s.key)v.pbb[i+(x^15)]=*p&1;
+    }
+    else {
+      uint8_t *d=v.cb+(f.y+r)*v.cw+f.x;
+      if(s.key<0)memcpy(d,p,f.w);
+      else for(int n=f.w;n--;d++,p++)if(*p!=s.key)*d=*p;
+    }
+  }
+}
+
+int Vga::updateSprites()
+{
+  if(mode & VGA_LINES)return 0; // drawn line by line, see lines.cpp
+  if(!up || dbuf || (mode!=VGA_MONO && !(mode&VGA_COLOUR)))return -1;
+  int i,j,r=0,n=spr?sprn:0;
+  for(i=sprdrawn;i<VGA_SPRITES;i++)_v_fs[i].on=0;
+
+  // what has changed, and where each sprite will be
+  uint32_t dirty=0;
+  int nx[VGA_SPRITES],ny[VGA_SPRITES],nw[VGA_SPRITES],nh[VGA_SPRITES];
+  for(i=0;i<VGA_SPRITES;i++){
+    const _v_fbspr &f=_v_fs[i];
+    nw[i]=nh[i]=nx[i]=ny[i]=0;
+    if(i>=n){if(f.on)dirty|=1u<<i;continue;}
+    const VgaSprite &s=spr[i];
+    _v_fbclip(*this,s,nx[i],ny[i],nw[i],nh[i]);
+    if(!f.on || s.x!=f.s.x || s.y!=f.s.y || s.w!=f.s.w || s.h!=f.s.h ||
+       s.key!=f.s.key || s.bits!=f.s.bits)dirty|=1u<<i;
+  }
+  if(!dirty)return 0;
+
+  // and whatever overlaps it, old place or new, so the backgrounds stack up
+  for(bool more=true;more;){
+    more=false;
+    for(i=0;i<n;i++){
+      if(dirty&(1u<<i) || !_v_fs[i].on)continue;
+      for(j=0;j<VGA_SPRITES;j++){
+	if(!(dirty&(1u<<j)))continue;
+	if(_v_fboverlap(_v_fs[i],_v_fs[j].x,_v_fs[j].y,_v_fs[j].w,_v_fs[j].h) ||
+	   _v_fboverlap(_v_fs[i],nx[j],ny[j],nw[j],nh[j])){
+	  dirty|=1u<<i;more=true;break;
+	}
+      }
+    }
+  }
+
+  flip(); // with one buffer this waits for the end of the frame
+  for(i=VGA_SPRITES-1;i>=0;i--){
+    _v_fbspr &f=_v_fs[i];
+    if(!(dirty&(1u<<i)) || !f.on)continue;
+    if(f.w)_v_fbrestore(*this,f);
+    f.on=0;
+  }
+  for(i=0;i<n;i++){
+    _v_fbspr &f=_v_fs[i];
+    if(!(dirty&(1u<<i)))continue;
+    f.s=spr[i];f.x=nx[i];f.y=ny[i];f.w=nw[i];f.h=nh[i];
+    int size=mode==VGA_MONO?_v_fbwords(f.w)*2*f.h:f.w*f.h;
+    if(size>f.cap){
+      uint8_t *p=(uint8_t *)realloc(f.save,size);
+      if(!p){r= -2;continue;}
+      f.save=p;f.cap=size;
+    }
+    if(f.w){_v_fbsave(*this,f);_v_fbdraw(*this,f);}
+    f.on=1;
+  }
+  sprdrawn=n;
+  return r;
+}
+
+void Vga::hideSprites()
+{
+  if((mode & VGA_LINES) || !up || dbuf)return;
+  flip();
+  for(int i=sprdrawn-1;i>=0;i--){
+    _v_fbspr &f=_v_fs[i];
+    if(f.on && f.w)_v_fbrestore(*this,f);
+    f.on=0;
+  }
+  sprdrawn=0;
+}
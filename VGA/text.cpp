@@ -1,33 +1,10 @@
 #include "VGA.h"
+#include <stdio.h>
 
 void Vga::drawText(char *text, int x, int y, int c, int b, int dir)
 {
-  uint8_t t;
-  while(t=(uint8_t)*text++){
-    for(int j=0;j<8;j++)for(int i=0;i<8;i++){
-      switch(dir){
-      case -1:
-      case 0:     
-	  if(_vga_font8x8[8*t+j]&(128>>i))drawPixel(x+i,y+j,c);
-	  else if(b!= -256) drawPixel(x+i,y+j,b);
-	  break;
-      case 1:
-	  if(_vga_font8x8[8*t+j]&(128>>i))drawPixel(x+j,y-i,c);
-	  else if(b!= -256) drawPixel(x+j,y-i,b);
-	  break;
-      case 2:
-	  if(_vga_font8x8[8*t+j]&(128>>i))drawPixel(x-i,y-j,c);
-	  else if(b!= -256) drawPixel(x-i,y-j,b);
-	  break;
-      case 3:
-	  if(_vga_font8x8[8*t+j]&(128>>i))drawPixel(x-j,y+i,c);
-	  else if(b!= -256) drawPixel(x-j,y+i,b);
-	  break;
-      default: break;
-      }
-    }
-    if(dir==0)x+=8;else if(dir==1)y-=8;else if(dir==2)x-=8;else y+=8;  
-  }
+  if(qbuf){int a[]={x,y,c,b,dir};record(VGA_QTEXT,a,5,text,strlen(text)+1);return;}
+  if(raster)raster->text(*this,text,x,y,c,b,dir);
 }
 
 
@@ -38,8 +15,10 @@ void Vga::moveCursor(int column, int line)
 }
 
 void Vga::setPrintWindow(int left, int top, int width, int height){
-  if(left<0)left=0;if(left>=tw)left=tw-1;
-  if(top<0)top=0;if(top>=th)top=th-1;
+  if(left<0)left=0;
+  if(left>=tw)left=tw-1;
+  if(top<0)top=0;
+  if(top>=th)top=th-1;
   if(left+width>tw)width=tw-left;
   if(top+height>th)height=th-top;
   
@@ -48,8 +27,12 @@ void Vga::setPrintWindow(int left, int top, int width, int height){
   tx=0;ty=0;
 }
   
+// Text goes straight to the frame buffer even while a queue is open (see
+// beginQueue), so clearing and scrolling the window must too.
 void Vga::clearPrintWindow(){
+    uint8_t *rec=qbuf;qbuf=0;
     fillRect(twx*8,twy*8,(twx+tww)*8-1,(twy+twh)*8-1,paper);
+    qbuf=rec;
     tx=0;ty=0;
 }
 void Vga::scrollPrintWindow()
@@ -67,8 +50,17 @@ void Vga::scrollPrintWindow()
       memmove(a,b,cw*(ysize-8));
       memset(a+cw*(ysize-8),paper,cw*8);
     }
+    else if (mode==VGA_4BPP){
+      uint8_t *a=cb,*b=cb+8*cw;
+      memmove(a,b,cw*(ysize-8));
+      memset(a+cw*(ysize-8),(paper&15)*0x11,cw*8);
+    }
+  }
+  else {
+    uint8_t *rec=qbuf;qbuf=0;
+    scroll(twx*8,twy*8,tww*8,twh*8,0,-8,paper);
+    qbuf=rec;
   }
-  else scroll(twx*8,twy*8,tww*8,twh*8,0,-8,paper);
   tx=0;ty=twh-1;
 }
 
@@ -97,17 +89,43 @@ size_t Vga::write(uint8_t c){
       a+=cw;
     }
   }
+  else if(mode==VGA_4BPP){
+    uint8_t *a=(uint8_t *)cb+(twy+ty)*8*cw+(twx+tx)*4;
+    for(int j=0;j<8;j++){
+      for(int i=0;i<4;i++){
+	uint8_t f=_vga_font8x8[8*c+j]<<(2*i);
+	a[i]=((f&128?ink:paper)&15)<<4|((f&64?ink:paper)&15);
+      }
+      a+=cw;
+    }
+  }
     
     tx++;if(tx==tww){
       tx=0;ty++;
       if(ty==twh)scrollPrintWindow();
     }
-  
+  return 1;
 }
 
 size_t Vga::write(const uint8_t *buffer, size_t size)
 {
   int rv=0;
-  for(int i=0;i<size;i++)rv+=write(buffer[i]);
+  for(size_t i=0;i<size;i++)rv+=write(buffer[i]);
   return rv;
 }
+
+// The last frame's profile (see setProfiling) as 7 lines of text at x,y, in
+// ink on paper. Draw it after the rest of the frame so nothing covers it.
+void Vga::drawProfile(int x, int y)
+{
+  char s[24];
+  const VgaProfile &p=prof;
+  sprintf(s,"free  %3d%%     ",p.free);drawText(s,x,y,ink,paper);
+  sprintf(s,"frame %-9lu",(unsigned long)p.frame);drawText(s,x,y+8,ink,paper);
+  sprintf(s,"tc4   %-9lu",(unsigned long)p.tc4);drawText(s,x,y+16,ink,paper);
+  sprintf(s,"pwm   %-9lu",(unsigned long)p.pwm);drawText(s,x,y+24,ink,paper);
+  sprintf(s,"dmac  %-9lu",(unsigned long)p.dmac);drawText(s,x,y+32,ink,paper);
+  sprintf(s,"tc5   %-9lu",(unsigned long)p.tc5);drawText(s,x,y+40,ink,paper);
+  sprintf(s,"worst %-5lu@%-3d",(unsigned long)p.worst,p.worstline);
+  drawText(s,x,y+48,ink,paper);
+}
@@ -0,0 +1,54 @@
+#include "VGA.h"
+
+// Frame buffer layout and allocation, for begin(), beginPAL() and
+// beginNTSC(). extras/HostBench builds this file too, so the PC lays the
+// buffers out exactly as the Due does.
+
+int Vga::allocvideomem()
+{
+  if(mode==VGA_MONO){
+    pw=((xsize+31)/32)*2+2;
+    pbsize=pw*ysize;
+    pb=(uint16_t *)calloc(pbsize,2);
+    if(pb==0)return -2;
+
+    pbb=_v_bitbandof(pb);
+    pbw=pw*16;
+    pbf=pb;pbbf=pbb;
+    if(dbuf){                  // a second buffer, to show while pb is drawn on
+      pbf=(uint16_t *)calloc(pbsize,2);
+      if(pbf)pbbf=_v_bitbandof(pbf);
+      else{pbf=pb;dbuf=0;}
+    }
+  }
+  if((mode & VGA_COLOUR) || mode==VGA_4BPP){
+    if(mode==VGA_4BPP)cw=((xsize+7)&~7)>>1; // two pixels a byte
+    else cw=vxsize>xsize?(vxsize+3)&~3:xsize;
+    cbsize=cw*ysize;
+    cb=(uint8_t *)calloc(cbsize,1);
+    if(cb==0)return -2;
+    cbf=cb;
+    if(dbuf){
+      cbf=(uint8_t *)calloc(cbsize,1);
+      if(!cbf){cbf=cb;dbuf=0;}
+    }
+  }
+  if(mode & VGA_LINES){          // just two lines, filled by lrender
+    if(mode==VGA_LINES)dbuf=0; // and no frame buffer to have two of
+    int n=(xsize+7)&~7;        // whole tiles, see lines.cpp
+    lbuf[0]=(uint8_t *)calloc(n,2);
+    if(lbuf[0]==0)return -2;
+    lbuf[1]=lbuf[0]+n;
+  }
+  return 0;
+}
+
+void Vga::freevideomem()
+{
+  if(pbf && pbf!=pb)free(pbf);
+  if(cbf && cbf!=cb)free(cbf);
+  pbf=0;cbf=0;dbuf=0;
+  if(lbuf[0]){free(lbuf[0]);lbuf[0]=lbuf[1]=0;}
+  if(pb){free(pb);pb=0;}
+  if(cb){free(cb);cb=0;}
+}
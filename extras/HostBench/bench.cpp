@@ -0,0 +1,444 @@
+// DueVGA host benchmark
+// Runs every drawing primitive against an in-memory frame buffer in the mono
+// (800x600), colour and 4bpp (320x240) layouts and reports calls/sec and
+// pixels/sec. The pixel counts are nominal (the area the call asks for,
+// before clipping), so they stay comparable when the drawing code changes.
+//
+// Each primitive is driven by its own pseudo-random sequence, the same on
+// every run, and a hash of the frame buffer is printed after it. If an
+// optimisation is meant to give identical output the hashes must not change.
+//
+// Usage: vgabench [scale [name]]
+//   scale multiplies the iteration counts (default 1)
+//   name runs only the primitives whose name starts with it
+//        vgabench -q file [mono|colour|4bpp [times]]
+//   times the replay of a draw command queue saved from a sketch
+//
+// Then it times the line renderers of VGA_LINES and VGA_4BPP (320x240), one
+// whole frame of lines at a time, and hashes the lines of the last frame.
+//
+// The queue lines check that recording and replaying the calls, and text
+// printed while recording, give the same picture as drawing straight away.
+//
+// After that it times the ellipse walk with the old double error
+// terms against the integer ones drawEllipse now uses.
+
+#include <stdio.h>
+#include <time.h>
+#include "VGA.h"
+#include "raster.h"
+
+static uint32_t seed;
+static int rnd(int n){seed=seed*1103515245+12345;return (int)((seed>>8)%n);}
+static int rnd(int a, int b){return a+rnd(b-a);}
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC,&ts);
+  return ts.tv_sec+ts.tv_nsec*1e-9;
+}
+
+static uint32_t fbhash()
+{
+  const uint8_t *p;int n;
+  if(VGA.mode==VGA_MONO){p=(const uint8_t *)VGA.pb;n=VGA.pbsize*2;}
+  else {p=VGA.cb;n=VGA.cbsize;}
+  uint32_t h=2166136261u;
+  while(n--)h=(h^*p++)*16777619u;
+  return h;
+}
+
+// a colour suitable for the mode, including the XOR (negative) colours
+static int rndcol()
+{
+  if(VGA.mode==VGA_MONO)return rnd(3)-1;
+  if(VGA.mode==VGA_4BPP)return rnd(32)-16;
+  return rnd(512)-256;
+}
+
+// coordinates may lie a little off-screen, to exercise the clipping
+static int rx(){return rnd(-VGA.xsize/8,VGA.xsize+VGA.xsize/8);}
+static int ry(){return rnd(-VGA.ysize/8,VGA.ysize+VGA.ysize/8);}
+
+static long b_drawLine(){
+  int x0=rx(),y0=ry(),x1=rx(),y1=ry();
+  VGA.drawLine(x0,y0,x1,y1,rndcol());
+  return max(abs(x1-x0),abs(y1-y0))+1;
+}
+static long b_fillRect(){
+  int x0=rx(),y0=ry(),x1=rx(),y1=ry();
+  VGA.fillRect(x0,y0,x1,y1,rndcol());
+  return (long)(abs(x1-x0)+1)*(abs(y1-y0)+1);
+}
+static long b_fillTri(){
+  int x0=rx(),y0=ry(),x1=rx(),y1=ry(),x2=rx(),y2=ry();
+  VGA.fillTri(x0,y0,x1,y1,x2,y2,rndcol());
+  return labs((long)(x1-x0)*(y2-y0)-(long)(x2-x0)*(y1-y0))/2+1;
+}
+static long b_fillPolygon(){ // a 12 point star, either rule
+  int16_t xy[24];
+  int x=rx(),y=ry(),r=rnd(VGA.ysize/4)+1;
+  static const int8_t u[12][2]={{0,-64},{16,-28},{55,-32},{32,0},{55,32},{16,28},
+				{0,64},{-16,28},{-55,32},{-32,0},{-55,-32},{-16,-28}};
+  for(int i=0;i<12;i++){xy[2*i]=x+u[i][0]*r/64;xy[2*i+1]=y+u[i][1]*r/64;}
+  VGA.fillPolygon(xy,12,rndcol(),rnd(2)?VGA_NONZERO:VGA_EVENODD);
+  return 4L*r*r/3+1;
+}
+static long b_drawCircle(){
+  int x=rx(),y=ry(),r=rnd(VGA.ysize/4);
+  VGA.drawCircle(x,y,r,rndcol());
+  return 710L*r/113+1;
+}
+static long b_fillCircle(){
+  int x=rx(),y=ry(),r=rnd(VGA.ysize/4);
+  VGA.fillCircle(x,y,r,rndcol());
+  return 355L*r*r/113+1;
+}
+static long b_fillCircleSmall(){ // eg map markers
+  int x=rx(),y=ry(),r=rnd(2,9);
+  VGA.fillCircle(x,y,r,rndcol());
+  return 355L*r*r/113+1;
+}
+static long b_drawEllipse(){
+  int x0=rx(),y0=ry(),x1=rx(),y1=ry();
+  VGA.drawEllipse(x0,y0,x1,y1,rndcol());
+  return 355L*(abs(x1-x0)+abs(y1-y0))/226+1;
+}
+static long b_fillEllipse(){
+  int x0=rx(),y0=ry(),x1=rx(),y1=ry();
+  VGA.fillEllipse(x0,y0,x1,y1,rndcol());
+  return 355L*abs(x1-x0)*abs(y1-y0)/452+1;
+}
+static long b_scroll(){
+  int w=rnd(VGA.xsize/2,VGA.xsize+1),h=rnd(VGA.ysize/2,VGA.ysize+1);
+  int x=rnd(VGA.xsize-w+1),y=rnd(VGA.ysize-h+1);
+  VGA.scroll(x,y,w,h,rnd(-8,9),rnd(-8,9),rndcol()&255);
+  return (long)w*h;
+}
+static long b_drawText(){
+  static char s[]="Due VGA Library";
+  int fg=rndcol(),bg=rnd(2)?-256:rndcol();
+  VGA.drawText(s,rx(),ry(),fg,bg,rnd(5)-1);
+  return 64L*(sizeof(s)-1);
+}
+static long b_write(){
+  VGA.write((uint8_t)rnd(32,127));
+  if(rnd(64)==0)VGA.write(10);
+  return 64;
+}
+static long b_updateSprites(){ // 16 16x16 markers, one moving per call
+  static uint8_t bits[16*16];
+  static VgaSprite s[16];
+  if(!VGA.sprdrawn){
+    for(int i=0;i<256;i++)bits[i]=(i&15)<4?2:VGA.mode==VGA_MONO?rnd(2):rnd(256);
+    for(int i=0;i<16;i++){s[i].x=rx();s[i].y=ry();s[i].w=s[i].h=16;s[i].key=2;s[i].bits=bits;}
+    VGA.setSprites(s,16);
+  }
+  VgaSprite &m=s[rnd(16)];
+  m.x+=rnd(-8,9);m.y+=rnd(-8,9);
+  VGA.updateSprites();
+  return 2*16*16;
+}
+
+// drawEllipse's walk as it was, with double error terms, and as it is now in
+// raster.h. Both plot into a checksum instead of the frame buffer, so this
+// times the walk alone and checks that the two visit the same points.
+struct _b_sum {
+  static uint32_t h;
+  static inline void plot(Vga &v, int x, int y, int c){h=(h^(x*65599+y))*16777619u;}
+};
+uint32_t _b_sum::h;
+
+static void dblellipse(int x0, int y0, int x1, int y1)
+{
+   long a = abs(x1-x0), b = abs(y1-y0), b1 = b&1;
+   double dx = 4*(1.0-a)*b*b, dy = 4*(b1+1)*a*a;
+   double err = dx+dy+b1*a*a, e2;
+
+   if (x0 > x1) { x0 = x1; x1 += a; }
+   if (y0 > y1) y0 = y1;
+   y0 += (b+1)/2; y1 = y0-b1;
+   a = 8*a*a; b1 = 8*b*b;
+
+   do {
+      _b_sum::plot(VGA,x1,y0,0);
+      _b_sum::plot(VGA,x0,y0,0);
+      _b_sum::plot(VGA,x0,y1,0);
+      _b_sum::plot(VGA,x1,y1,0);
+      e2 = 2*err;
+      if (e2 <= dy) { y0++; y1--; err += dy += a; }
+      if (e2 >= dx || 2*err > dy) { x0++; x1--; err += dx += b1; }
+   } while (x0 <= x1);
+
+   while (y0-y1 <= b) {
+      _b_sum::plot(VGA,x0-1,y0,0);
+      _b_sum::plot(VGA,x1+1,y0++,0);
+      _b_sum::plot(VGA,x0-1,y1,0);
+      _b_sum::plot(VGA,x1+1,y1--,0);
+   }
+}
+
+static void intellipse(int x0, int y0, int x1, int y1)
+{
+  if(max(abs(x1-x0),abs(y1-y0))<=_V_ELLIPSE32)
+    _v_ellipse_<_b_sum,false,int32_t>(VGA,x0,y0,x1,y1,0);
+  else _v_ellipse_<_b_sum,false,int64_t>(VGA,x0,y0,x1,y1,0);
+}
+
+// diameters from lo to hi, below and above the 32 bit limit
+static void walk(const char *name, int lo, int hi, int calls)
+{
+  void (*fn[2])(int,int,int,int)={dblellipse,intellipse};
+  double t[2];uint32_t h[2];
+  for(int i=0;i<2;i++){
+    seed=12345;_b_sum::h=0;
+    double t0=now();
+    for(int j=0;j<calls;j++)fn[i](0,0,rnd(lo,hi),rnd(lo,hi));
+    t[i]=now()-t0;h[i]=_b_sum::h;
+    if(t[i]<=0)t[i]=1e-9;
+  }
+  printf("walk    %-12s %8d calls %12.0f double %12.0f integer calls/s  %s\n",
+	 name,calls,calls/t[0],calls/t[1],h[0]==h[1]?"same points":"POINTS DIFFER");
+}
+
+// VGA_LINES renderers. A setup function installs the renderer, and frame(f)
+// is called before each frame, as a sketch would between frames.
+static uint8_t tiles[256*64] __attribute__((aligned(4)));
+static uint8_t tmap[64*32];
+
+static void l_tilesetup(){
+  for(unsigned i=0;i<sizeof(tiles);i++)tiles[i]=rnd(256);
+  for(unsigned i=0;i<sizeof(tmap);i++)tmap[i]=rnd(256);
+  VGA.setTileMap(tmap,64,32,tiles);
+}
+static void l_tileframe(int f){
+  tmap[rnd(sizeof(tmap))]=rnd(256);
+  VGA.setTileScroll(f,f*3);
+}
+
+// 32 16x16 sprites over the tiles, moving every frame
+static uint8_t sbits[16*16];
+static VgaSprite sprites[32];
+static void l_spritesetup(){
+  l_tilesetup();
+  for(int i=0;i<256;i++)sbits[i]=(i&15)<4?0:rnd(256);
+  for(int i=0;i<32;i++){
+    VgaSprite &s=sprites[i];
+    s.x=rx();s.y=ry();s.w=16;s.h=16;s.key=i&1?0:-1;s.bits=sbits;
+  }
+  VGA.setSprites(sprites,32);
+}
+static void l_spriteframe(int f){
+  l_tileframe(f);
+  for(int i=0;i<32;i++){sprites[i].x+=rnd(-4,5);sprites[i].y+=rnd(-4,5);}
+}
+
+// the 4bpp frame buffer through a palette that cycles every frame
+static void l_4bppsetup(){
+  for(int i=0;i<200;i++)b_fillTri();
+}
+static void l_4bppframe(int f){
+  for(int i=1;i<16;i++)VGA.setPalette(i,VGA.pal[i]+1);
+}
+
+struct LineBench {
+  const char *name;
+  int mode;
+  void (*setup)();
+  void (*frame)(int f);
+  int frames; // at scale 1
+};
+
+static const LineBench linebenches[]={
+  {"tiles",      VGA_LINES,l_tilesetup,  l_tileframe, 2000},
+  {"sprites",    VGA_LINES,l_spritesetup,l_spriteframe,2000},
+  {"4bpp",       VGA_4BPP, l_4bppsetup,  l_4bppframe, 2000},
+};
+
+static void runlines(double scale, const char *only)
+{
+  for(unsigned i=0;i<sizeof(linebenches)/sizeof(linebenches[0]);i++){
+    const LineBench &b=linebenches[i];
+    if(only && strncmp(b.name,only,strlen(only)))continue;
+    int n=(int)(b.frames*scale);if(n<1)n=1;
+    seed=12345;
+    for(const char *p=b.name;*p;p++)seed=seed*31+*p;
+    if(VGA.begin(320,240,b.mode)){printf("%s begin failed\n",b.name);continue;}
+    VGA.setSprites(0,0);
+    b.setup();
+    double t0=now();
+    for(int f=0;f<n;f++){
+      b.frame(f);
+      for(int y=0;y<VGA.ysize;y++)_v_renderline(y,VGA.lbuf[y&1]);
+    }
+    double t=now()-t0;
+    if(t<=0)t=1e-9;
+    uint32_t h=2166136261u;
+    b.frame(n);
+    for(int y=0;y<VGA.ysize;y++){
+      const uint8_t *p=VGA.lbuf[y&1];
+      _v_renderline(y,VGA.lbuf[y&1]);
+      for(int x=0;x<VGA.xsize;x++)h=(h^p[x])*16777619u;
+    }
+    long lines=(long)n*VGA.ysize;
+    printf("%-7s %-12s %8ld lines %12.0f lines/s %10.2f Mpix/s  hash %08x\n",
+	   "lines",b.name,lines,lines/t,lines*VGA.xsize/t*1e-6,h);
+  }
+}
+
+struct Bench {
+  const char *name;
+  long (*fn)();
+  int calls;  // iterations at scale 1
+};
+
+static const Bench benches[]={
+  {"drawLine",   b_drawLine,   20000},
+  {"fillRect",   b_fillRect,   2000},
+  {"fillTri",    b_fillTri,    2000},
+  {"fillPolygon",b_fillPolygon,2000},
+  {"drawCircle", b_drawCircle, 10000},
+  {"fillCircle", b_fillCircle, 2000},
+  {"fillCircle8",b_fillCircleSmall,20000},
+  {"drawEllipse",b_drawEllipse,10000},
+  {"fillEllipse",b_fillEllipse,2000},
+  {"scroll",     b_scroll,     200},
+  {"drawText",   b_drawText,   5000},
+  {"write",      b_write,      50000},
+  {"sprites",    b_updateSprites,20000},
+};
+
+static void run(const char *layout, double scale, const char *only)
+{
+  for(unsigned i=0;i<sizeof(benches)/sizeof(benches[0]);i++){
+    const Bench &b=benches[i];
+    if(only && strncmp(b.name,only,strlen(only)))continue;
+    if(b.fn==b_updateSprites && (VGA.mode&VGA_LINES))continue; // see "lines"
+    int n=(int)(b.calls*scale);if(n<1)n=1;
+    VGA.clear(0);
+    VGA.unsetPrintWindow();VGA.moveCursor(0,0);
+    seed=12345;
+    for(const char *p=b.name;*p;p++)seed=seed*31+*p;
+    long pixels=0;
+    double t0=now();
+    for(int j=0;j<n;j++)pixels+=b.fn();
+    double t=now()-t0;
+    if(t<=0)t=1e-9;
+    printf("%-7s %-12s %8d calls %12.0f calls/s %10.2f Mpix/s  hash %08x\n",
+	   layout,b.name,n,n/t,pixels/t*1e-6,fbhash());
+  }
+}
+
+// A mix of the primitives above drawn straight away, then recorded with
+// beginQueue and drawn by runQueue. The two must give the same picture.
+static uint8_t qbuf[1<<20];
+
+static void runqueue(const char *layout, double scale, const char *only)
+{
+  if(only && strncmp("queue",only,strlen(only)))return;
+  const int nb=11; // drawLine to drawText, which queue
+  int n=(int)(2000*scale);if(n<1)n=1;
+  double t[3];uint32_t h[2];int bytes=0;
+  for(int pass=0;pass<2;pass++){
+    VGA.clear(0);
+    if(pass)VGA.beginQueue(qbuf,sizeof(qbuf));
+    seed=54321;
+    double t0=now();
+    for(int j=0;j<n;j++)benches[rnd(nb)].fn();
+    t[pass]=now()-t0;
+    if(pass){
+      bytes=VGA.endQueue();
+      VGA.clear(0);
+      t0=now();
+      VGA.runQueue(qbuf,bytes);
+      t[2]=now()-t0;
+    }
+    h[pass]=fbhash();
+  }
+  for(int i=0;i<3;i++)if(t[i]<=0)t[i]=1e-9;
+  printf("%-7s %-12s %8d calls %8d bytes %12.0f direct %12.0f record %12.0f replay calls/s  %s\n",
+	 layout,"queue",n,bytes,n/t[0],n/t[1],n/t[2],
+	 bytes<0?"QUEUE FULL":h[0]==h[1]?"same picture":"PICTURE DIFFERS");
+}
+
+// Printing past the bottom of a text window while a queue is open. Text and
+// the window's own clearing and scrolling draw straight away, so replaying
+// the queue afterwards must give the same picture as with no queue at all.
+static void runqueuetext(const char *layout, const char *only)
+{
+  if(only && strncmp("queue",only,strlen(only)))return;
+  uint32_t h[2];int bytes=0;
+  char s[24];
+  for(int pass=0;pass<2;pass++){
+    VGA.clear(0);
+    VGA.setInk(1);VGA.setPaper(6);
+    VGA.setPrintWindow(2,2,12,4);
+    if(pass)VGA.beginQueue(qbuf,sizeof(qbuf));
+    VGA.fillRect(0,0,7,7,3);              // recorded, outside the window
+    VGA.clearPrintWindow();
+    for(int i=0;i<10;i++){sprintf(s,"line %d\n",i);VGA.print(s);}
+    VGA.drawLine(0,100,100,100,5);         // recorded, below it
+    if(pass){bytes=VGA.endQueue();VGA.runQueue(qbuf,bytes);}
+    else{VGA.fillRect(0,0,7,7,3);VGA.drawLine(0,100,100,100,5);}
+    h[pass]=fbhash();
+  }
+  VGA.setPrintWindow(0,0,VGA.tw,VGA.th);VGA.setInk(255);VGA.setPaper(0);
+  printf("%-7s %-12s %8d bytes  %s\n",layout,"queuetext",bytes,
+	 bytes<0?"QUEUE FULL":h[0]==h[1]?"same picture":"PICTURE DIFFERS");
+}
+
+// vgabench -q file [mono|colour|4bpp [times]]: replays a queue saved from a
+// sketch (the bytes recorded between beginQueue and endQueue or flipQueue)
+static int replay(int argc, char **argv)
+{
+  FILE *f=fopen(argv[2],"rb");
+  if(!f){printf("can't open %s\n",argv[2]);return 1;}
+  int n=fread(qbuf,1,sizeof(qbuf),f);
+  fclose(f);
+  const char *m=argc>3?argv[3]:"colour";
+  int times=argc>4?atoi(argv[4]):100;if(times<1)times=1;
+  int r;
+  if(!strcmp(m,"mono"))r=VGA.begin(800,600,VGA_MONO);
+  else if(!strcmp(m,"4bpp"))r=VGA.begin(320,240,VGA_4BPP);
+  else r=VGA.begin(320,240,VGA_COLOUR);
+  if(r){printf("begin failed\n");return 1;}
+  int cmds=0;
+  double t0=now();
+  for(int i=0;i<times;i++){VGA.clear(0);cmds=VGA.runQueue(qbuf,n);}
+  double t=now()-t0;if(t<=0)t=1e-9;
+  printf("replay  %-12s %8d bytes %8d commands %10.1f us/replay  hash %08x%s\n",
+	 m,n,cmds,t/times*1e6,fbhash(),cmds<0?"  (bad queue)":"");
+  VGA.end();
+  return cmds<0;
+}
+
+int main(int argc, char **argv)
+{
+  double scale=1;
+  const char *only=0;
+  if(argc>2 && !strcmp(argv[1],"-q"))return replay(argc,argv);
+  if(argc>1)scale=atof(argv[1]);
+  if(argc>2)only=argv[2];
+
+  if(VGA.begin(800,600,VGA_MONO)){printf("mono begin failed\n");return 1;}
+  run("mono",scale,only);
+  runqueue("mono",scale,only);
+  runqueuetext("mono",only);
+  if(VGA.begin(320,240,VGA_COLOUR)){printf("colour begin failed\n");return 1;}
+  run("colour",scale,only);
+  runqueue("colour",scale,only);
+  runqueuetext("colour",only);
+  if(VGA.begin(320,240,VGA_4BPP)){printf("4bpp begin failed\n");return 1;}
+  run("4bpp",scale,only);
+  runqueue("4bpp",scale,only);
+  runqueuetext("4bpp",only);
+  runlines(scale,only);
+  if(!only || !strncmp("ellipse",only,strlen(only))){
+    int n=(int)(20000*scale);if(n<1)n=1;
+    walk("ellipse",0,_V_ELLIPSE32+1,n);
+    walk("ellipse>32b",_V_ELLIPSE32+1,2000,n/4+1);
+  }
+  VGA.end();
+  return 0;
+}
@@ -0,0 +1,50 @@
+// Minimal Arduino.h for building the DueVGA drawing code on a PC.
+// Only what VGA.h, graphics.cpp and text.cpp need is provided here.
+
+#ifndef _HOST_ARDUINO_H
+#define _HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+
+// Just enough of the PIO description for _v_digitalWriteDirect to compile
+typedef struct { volatile uint32_t PIO_SODR, PIO_CODR; } Pio;
+typedef struct { Pio *pPort; uint32_t ulPin; } PinDescription;
+extern const PinDescription g_APinDescription[];
+
+// The SAM3X maps every bit of SRAM to a 32-bit word in the bit-band alias
+// region. A PC has no such thing, so pbb is replaced by a small proxy that
+// turns alias word n into bit (n&7) of byte (n>>3) of the pixel buffer.
+#define _V_BITBAND_EMULATED
+class _v_bitband {
+public:
+  class ref {
+  public:
+    ref(uint8_t *p, uint8_t m):p(p),m(m){}
+    operator int() const {return (*p&m)?1:0;}
+    ref &operator=(int c){if(c&1)*p|=m;else *p&=~m;return *this;}
+    ref &operator=(const ref &r){return *this=int(r);}
+    ref &operator^=(int c){return *this=int(*this)^c;}
+  private:
+    uint8_t *p;
+    uint8_t m;
+  };
+  _v_bitband():base(0){}
+  _v_bitband(void *p):base((uint8_t *)p){}
+  ref operator[](int n) const {return ref(base+(n>>3),1<<(n&7));}
+  ref operator*() const {return (*this)[0];}
+  operator bool() const {return base!=0;}
+private:
+  uint8_t *base;
+};
+static inline _v_bitband _v_bitbandof(void *p){return _v_bitband(p);}
+
+#endif
@@ -0,0 +1,23 @@
+// Minimal Print.h for building the DueVGA drawing code on a PC.
+
+#ifndef _HOST_PRINT_H
+#define _HOST_PRINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+class Print {
+public:
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size){
+    size_t n=0;
+    while(size--)n+=write(*buffer++);
+    return n;
+  }
+  size_t print(const char *s){return write((const uint8_t *)s,strlen(s));}
+  size_t println(const char *s){return print(s)+print("\r\n");}
+  virtual ~Print(){}
+};
+
+#endif
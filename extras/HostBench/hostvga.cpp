@@ -0,0 +1,96 @@
+// Host stand-in for VGA/VGA.cpp
+// Provides the VGA object and the begin/end functions without touching any
+// SAM3X peripherals. The frame buffers are plain heap memory, allocated and
+// laid out by the library's own videomem.cpp, so graphics.cpp and text.cpp
+// run unmodified against them.
+
+#include "VGA.h"
+
+Vga VGA;
+
+static Pio _h_pio;
+const PinDescription g_APinDescription[]={{&_h_pio,0}};
+
+// There is no frame to wait for, so the buffers swap straight away
+void Vga::flip()
+{
+  if(!up || !dbuf)return;
+  uint16_t *p=pb;pb=pbf;pbf=p;
+  _v_bitband b=pbb;pbb=pbbf;pbbf=b;
+  uint8_t *c=cb;cb=cbf;cbf=c;
+}
+
+int Vga::begin(int x, int y, int m, int vx)
+{
+  if(up)VGA.end();
+
+  dbuf=(m&VGA_DOUBLE)!=0;flipping=0;
+  m&=~VGA_DOUBLE;
+  if(m!=VGA_MONO && m!=VGA_COLOUR && m!=VGA_LINES && m!=VGA_4BPP) return -4;
+  if(m==VGA_COLOUR && y>380)return -3;
+
+  xsize=x;ysize=y;mode=m;
+  vxsize=(m==VGA_COLOUR && vx>x)?vx:x;
+  tww=tw=xsize/8;twh=th=ysize/8;twx=twy=tx=ty=0;
+  ink=255;paper=0;
+  synced=0;framecount=0;line=ysize;linedouble=0;
+  xpan=xoff=0;yscroll=yoff=0;ywrap= -1;dl=dlr=0;dln=0;sprdrawn=0;
+  lmissed=lmissline=0;lwlate=0;
+  yscale=1;ytotal=ysize+1;
+
+  int r;
+  r=allocvideomem(); if(r)return r;
+  bindraster();
+  if(mode==VGA_4BPP)setPalette(0);
+
+  up=1;
+  return 0;
+}
+
+int Vga::beginPAL(int vx)
+{
+  if(up)VGA.end();
+  mode=VGA_PAL;dbuf=flipping=0;
+  xsize=320;ysize=240;tww=tw=40;twh=th=30;twx=twy=tx=ty=0;
+  vxsize=vx>xsize?vx:xsize;
+  ink=255;paper=0;
+  synced=0;framecount=0;
+  yscale=1;ytotal=312;line=ysize;linedouble=0;
+  xpan=xoff=0;yscroll=yoff=0;ywrap= -1;dl=dlr=0;dln=0;sprdrawn=0;
+
+  int r;
+  r=allocvideomem(); if(r)return r;
+  bindraster();
+  up=1;
+  return 0;
+}
+
+int Vga::beginNTSC(int vx)
+{
+  if(up)VGA.end();
+  mode=VGA_NTSC;dbuf=flipping=0;
+  xsize=320;ysize=200;tww=tw=40;twh=th=25;twx=twy=tx=ty=0;
+  vxsize=vx>xsize?vx:xsize;
+  ink=255;paper=0;
+  synced=0;framecount=0;
+  yscale=1;ytotal=262;line=ysize;linedouble=0;
+  xpan=xoff=0;yscroll=yoff=0;ywrap= -1;dl=dlr=0;dln=0;sprdrawn=0;
+
+  int r;
+  r=allocvideomem(); if(r)return r;
+  bindraster();
+  up=1;
+  return 0;
+}
+
+void Vga::end()
+{
+  if(!up)return;
+  up=0;
+
+  freevideomem();
+  raster=0;profiling=0;
+
+  xsize=vxsize=ysize=ytotal=0;
+  mode=line=linedouble=yscale=0;
+}
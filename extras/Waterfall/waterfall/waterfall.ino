@@ -43,6 +43,18 @@ void ADC_Handler(){
   } 
 }
 
+// The waterfall is a ring of 160 lines in frame buffer lines 16-175, with the
+// oldest at line 16+wf. The display list shows it oldest first between the
+// fixed title and frequency axis, so nothing has to be scrolled.
+int wf=0;
+VgaRegion dlist[3];
+
+void showwaterfall(){
+  dlist[0].line=16;     dlist[0].addr=VGA.cb+(16+wf)*VGA.cw; dlist[0].stride=VGA.cw;
+  dlist[1].line=176-wf; dlist[1].addr=VGA.cb+16*VGA.cw;      dlist[1].stride=VGA.cw;
+  dlist[2].line=176;    dlist[2].addr=VGA.cb+176*VGA.cw;     dlist[2].stride=VGA.cw;
+}
+
 void setup(){
 
   VGA.begin(316,200,VGA_COLOUR);
@@ -97,6 +109,8 @@ void setup(){
   VGA.drawText("Frequency (Hz)",104,190,255);
   
   arm_rfft_init_q15(&S,&C,512,false,true);
+  showwaterfall();
+  VGA.setDisplayList(dlist,3);
 }
 
 int nn=0;
@@ -116,9 +130,9 @@ void loop(){
   
   arm_rfft_q15(&S,out,outsq);
   arm_cmplx_mag_squared_q15(outsq,out,256);
-  for(int i=0;i<240;i++) {VGA.drawPixel(i+40,175,(cmap[out[1+(i)]&0xff]));}
   VGA.waitSync();
-  VGA.scroll(40,16,240,160,0,-1);
-  //VGA.waitSync();
+  for(int i=0;i<240;i++) {VGA.drawPixel(i+40,16+wf,(cmap[out[1+(i)]&0xff]));}
+  wf++;if(wf==160)wf=0;
+  showwaterfall();
 
 }